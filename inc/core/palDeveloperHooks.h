@@ -32,14 +32,18 @@
 #pragma once
 
 #include "pal.h"
+#include "palCmdAllocator.h"
 #include "palCmdBuffer.h"
+#include "palPipeline.h"
 
 namespace Pal
 {
 
 // Forward declarations.
+class ICmdAllocator;
 class ICmdBuffer;
 class IImage;
+class IQueue;
 
 namespace Developer
 {
@@ -57,6 +61,15 @@ enum class CallbackType : uint32
     BarrierBegin,           ///< This callback is to inform that a barrier is about to be executed.
     BarrierEnd,             ///< This callback is to inform that a barrier is done being executed.
     DrawDispatch,           ///< This callback is to inform that a draw or dispatch command is being recorded.
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+    CmdBufferBegin,         ///< This callback is to inform that a command buffer has begun recording.
+    CmdBufferEnd,           ///< This callback is to inform that a command buffer has finished recording.
+    QueueSubmitBegin,       ///< This callback is to inform that a queue submission is starting.
+    QueueSubmitEnd,         ///< This callback is to inform that a queue submission has finished on the CPU.
+    CreatePipeline,         ///< This callback is to inform that a pipeline object has been initialized.
+    CmdAllocatorChunkMiss,  ///< This callback is to inform that a command allocator had to create a new allocation
+                            ///  because no idle chunk was available.
+#endif
     Count,                  ///< The number of info types.
 };
 
@@ -373,5 +386,61 @@ struct DrawDispatchData
     };
 };
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+/// The callbacks below measure driver CPU overhead. They are only issued if PAL was built with
+/// PAL_DEVELOPER_CPU_EVENTS; otherwise the code which generates them is compiled out. All timestamps and durations are
+/// in units of Util::GetPerfCpuTime() ticks (@see Util::GetPerfFrequency).
+
+/// Information for CmdBufferBegin and CmdBufferEnd callbacks.
+struct CmdBufferCpuData
+{
+    ICmdBuffer* pCmdBuffer;     ///< The command buffer that began or ended recording.
+    int64       cpuTimestamp;   ///< CPU time at which Begin() or End() finished.
+    uint32      numCmdStreams;  ///< Number of command streams owned by the command buffer.
+    uint32      numChunks;      ///< Total command chunks used by all command streams.  Always zero for CmdBufferBegin.
+    uint64      numDwords;      ///< Total command DWORDs written to all command streams.  Always zero for
+                                ///  CmdBufferBegin.
+    uint32      numDraws;       ///< Number of draws recorded.  Always zero for CmdBufferBegin.
+    uint32      numDispatches;  ///< Number of dispatches recorded.  Always zero for CmdBufferBegin.
+    uint32      numBarriers;    ///< Number of CmdBarrier() calls recorded.  Always zero for CmdBufferBegin.
+};
+
+/// Information for QueueSubmitBegin and QueueSubmitEnd callbacks.
+struct QueueSubmitCpuData
+{
+    IQueue* pQueue;                     ///< The queue being submitted to.
+    int64   cpuTimestamp;               ///< CPU time at which the submission started or finished.
+    uint32  cmdBufferCount;             ///< Number of command buffers in the submission.
+    uint32  gpuMemRefCount;             ///< Number of per-submit GPU memory references (resource list size).
+    int64   updateResourceListCpuTime;  ///< Time spent building the OS resource list.  Only valid for QueueSubmitEnd;
+                                        ///  zero if the submission was batched and has not reached the OS yet.
+};
+
+/// Information for CreatePipeline callbacks.
+struct PipelineCpuData
+{
+    PipelineHash internalPipelineHash;  ///< Internal hash of the pipeline ELF binary.
+    uint64       palRuntimeHash;        ///< PAL runtime hash of the pipeline.
+    bool         isCompute;             ///< True for compute pipelines, false for graphics pipelines.
+    int64        cpuTimestamp;          ///< CPU time at which pipeline initialization finished.
+    int64        elfParseCpuTime;       ///< Time spent loading the ELF and deserializing its metadata.
+    int64        hwlInitCpuTime;        ///< Time spent in hardware-specific init (register setup and code upload).
+    bool         objectCacheHit;        ///< True if the pipeline's state was copied from the pipeline object cache.
+    uint32       objectCacheHits;       ///< Total pipeline object cache hits on this device so far.
+    uint32       objectCacheMisses;     ///< Total pipeline object cache misses on this device so far.
+    bool         diskCacheHit;          ///< True if the pipeline's metadata was loaded from the on-disk pipeline cache.
+};
+
+/// Information for CmdAllocatorChunkMiss callbacks.
+struct CmdAllocatorChunkMissData
+{
+    ICmdAllocator* pCmdAllocator;   ///< The command allocator which missed.
+    CmdAllocType   allocType;       ///< Type of data the chunk was requested for.
+    bool           systemMemory;    ///< True if the chunk was requested from system memory.
+    int64          cpuTimestamp;    ///< CPU time at which the new chunk was obtained.
+    int64          allocCpuTime;    ///< Time spent searching for and allocating the chunk.
+};
+#endif
+
 } // Developer
 } // Pal
@@ -510,6 +510,24 @@ struct PalPublicSettings
     bool disableSkipFceOptimization;
     /// Sets the minimum BPP of surfaces which will have DCC enabled
     uint32 dccBitsPerPixelThreshold;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+    /// Enables the pipeline object cache.  Client pipelines created from an identical ELF binary and create info will
+    /// share their hardware-specific state and GPU memory with a cached prototype instead of re-parsing the ELF and
+    /// rebuilding their register images.  Pipelines which use indirect functions are never cached.
+    bool enablePipelineObjectCache;
+    /// Directory holding the on-disk pipeline cache used when shaderCacheMode is ShaderCacheOnDisk.  The cache stores
+    /// the deserialized metadata of each pipeline ELF binary so that pipelines seen in a previous run skip most of the
+    /// ELF parsing.  An empty string disables the on-disk cache.
+    char pipelineDiskCacheDirectory[MaxPathStrLen];
+    /// Maximum size of the on-disk pipeline cache file, in bytes.  The least recently used entries are evicted once
+    /// the file grows past this size.  Zero means the size is not limited.
+    uint64 pipelineDiskCacheMaxSize;
+    /// Grows the shader rings (scratch, GS/VS, tessellation) eagerly when a pipeline which needs larger rings is
+    /// created, instead of at the next submit.  The grown rings are built into a standby ring set which each queue
+    /// switches to at its next submit boundary, so that the submit path does not need to idle the queues and reallocate
+    /// the rings.  Retired ring sets are kept alive until the queues are next idled, which costs extra GPU memory.
+    bool eagerShaderRingGrowth;
+#endif
 };
 
 /// Defines the modes that the GPU Profiling layer can use when its buffer fills.
@@ -1227,6 +1245,20 @@ enum class ImageTexOptLevel : uint32
     Count
 };
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+/// Declares the largest shader ring requirements which the client expects any of its pipelines to have.  PAL sizes the
+/// shader rings for these requirements when the device is finalized so that creating such pipelines later does not
+/// force the rings to be grown (and the queues to be idled) at submit time.  Zero means no expectation.
+///
+/// @see DeviceFinalizeInfo::shaderRingSizeHints
+struct ShaderRingSizeHints
+{
+    uint32 scratchMemorySize; ///< Largest scratch memory size per thread, in bytes, of any graphics or compute shader.
+    uint32 gsVsRingItemSize;  ///< Largest GS to VS ring item size, in DWORDs, of any pipeline using a geometry shader.
+    bool   tessellation;      ///< Whether any pipeline is expected to use tessellation.
+};
+#endif
+
 /// Specifies properties for @ref IDevice finalization.  Input structure to IDevice::Finalize().
 struct DeviceFinalizeInfo
 {
@@ -1297,6 +1329,11 @@ struct DeviceFinalizeInfo
     /// Specify the texture optimization level which only applies to internally-created views by PAL (e.g., for BLTs),
     /// client-created views must use the texOptLevel parameter in ImageViewInfo.
     ImageTexOptLevel internalTexOptLevel;
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+    /// Expected maximum shader ring requirements of the client's pipelines.  May be left zeroed.
+    ShaderRingSizeHints shaderRingSizeHints;
+#endif
 };
 
 /// Reports the compatibility and available features when using two particular devices in a multi-GPU system.  Output
@@ -115,6 +115,19 @@ extern void ConvertColor(
     const float*   pColorIn,
     uint32*        pColorOut);
 
+/// Converts an array of floating-point colors in RGBA order which all share the same format. The results are identical
+/// to calling ConvertColor on each color, but the format only needs to be examined once.
+///
+/// @param [in]  format     Format of all of the colors.
+/// @param [in]  colorCount Number of colors to convert.
+/// @param [in]  pColorsIn  Array of colorCount * 4 floats.
+/// @param [out] pColorsOut Array of colorCount * 4 uint32s which receives the converted colors.
+extern void ConvertColors(
+    SwizzledFormat format,
+    uint32         colorCount,
+    const float*   pColorsIn,
+    uint32*        pColorsOut);
+
 /// Packs a clear color value in RGBA order to a single element of the provided format and stores it in the
 /// memory provided. Swizzling is enabled by default to maintain backwards compatability. There will be
 /// no swizzling functionality going forwards.
@@ -123,6 +136,20 @@ extern void PackRawClearColor(
     const uint32*  pColor,
     void*          pBufferMemory);
 
+/// Packs an array of clear colors in RGBA order which all share the same format into consecutive elements of the
+/// memory provided. The results are identical to calling PackRawClearColor on each color, but the format only needs
+/// to be examined once.
+///
+/// @param [in]  format        Format of all of the colors.
+/// @param [in]  colorCount    Number of colors to pack.
+/// @param [in]  pColors       Array of colorCount * 4 uint32s.
+/// @param [out] pBufferMemory Receives colorCount packed elements, BytesPerPixel(format.format) bytes each.
+extern void PackRawClearColors(
+    SwizzledFormat format,
+    uint32         colorCount,
+    const uint32*  pColors,
+    void*          pBufferMemory);
+
 /// Swizzles the color according to the provided format swizzle.
 extern void SwizzleColor(SwizzledFormat format, const uint32* pColorIn, uint32* pColorOut);
 
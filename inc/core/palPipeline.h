@@ -472,6 +472,11 @@ public:
 
     /// Returns a list of GPU memory allocations used by this pipeline.
     ///
+    /// Starting with interface version 465 a pipeline may be backed by more than one allocation when PAL shares
+    /// identical pipeline code between pipelines, so clients must query the number of entries first.  In that case the
+    /// first entry holds the pipeline's code and data, which may be shared with other pipelines that have identical code
+    /// and data, and the second entry, if present, holds the pipeline's private register and performance data.
+    ///
     /// @param [in,out] pNumEntries    Input value specifies the available size in pAllocInfoList; output value
     ///                                reports the number of GPU memory allocations.
     /// @param [out]    pAllocInfoList If pAllocInfoList=nullptr, then pNumEntries is ignored on input.  On output it
@@ -480,7 +485,7 @@ public:
     ///                                of entries in the pAllocInfoList array.  On output, pNumEntries reflects the
     ///                                number of entries in pAllocInfoList that are valid.
     /// @returns Success if the allocation info was successfully written to the buffer.
-    ///          + ErrorInvalidValue if the caller provides a buffer size that is different from the size needed.
+    ///          + ErrorInvalidValue if the caller provides a buffer that is smaller than the size needed.
     ///          + ErrorInvalidPointer if pNumEntries is nullptr.
     virtual Result QueryAllocationInfo(
         size_t*                    pNumEntries,
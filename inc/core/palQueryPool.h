@@ -113,8 +113,16 @@ enum QueryResultFlags : uint32
                                     ///  available a zero will be written.
     QueryResultPartial      = 0x8,  ///< Partial results of queries are written even if the final results aren't
                                     ///  available. If this flag isn't set then the destination will be left untouched.
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+    QueryResultAccumulate   = 0x10, ///< Results are added to the values present in the destination, if availability
+                                    ///  data is enabled it will be ANDed with the present availability data.
+    QueryResultWaitBackoff  = 0x20  ///< Only meaningful with QueryResultWait.  Rather than busy-spinning on queries
+                                    ///  the GPU has not finished, the calling thread backs off between polls: first by
+                                    ///  yielding, then by sleeping for progressively longer (but bounded) intervals.
+#else
     QueryResultAccumulate   = 0x10  ///< Results are added to the values present in the destination, if availability
                                     ///  data is enabled it will be ANDed with the present availability data.
+#endif
 };
 
 /**
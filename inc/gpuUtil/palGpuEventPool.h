@@ -31,8 +31,8 @@
 
 #pragma once
 
-#include "palDeque.h"
 #include "palPlatform.h"
+#include "palVector.h"
 
 // Forward declarations.
 namespace Pal
@@ -51,14 +51,16 @@ namespace GpuUtil
 * A GpuEventPool is a container for a set of GpuEvent objects. Its main purpose is to provide client with a utility to
 * efficiently manage PAL's GpuEvents.
 *
+* Events are carved out of slabs: each slab is a single CPU allocation holding the storage for several GpuEvent
+* objects, and the pool grows by whole slabs when it runs dry.  Acquiring and recycling events are simple index
+* operations on a flat event list; no per-event allocation happens once the pool has reached its working size.
+*
 * @warning GpuEventPool is not thread safe.  Acquire event or recycle event from different threads should use
 *          different pool objects.
 ***********************************************************************************************************************
 */
 class GpuEventPool
 {
-    typedef Util::Deque<Pal::IGpuEvent*, Pal::IPlatform> GpuEventDeque;
-
 public:
     /// Constructor.
     ///
@@ -78,10 +80,10 @@ public:
     /// @param [in] defaultCapacity  The default number of gpu events pre-allocated in the pool for efficiency.
     Pal::Result Init(Pal::uint32 defaultCapacity);
 
-    /// Reset the pool by moving all allocated GpuEvent objects back to available list.
+    /// Reset the pool by marking all allocated GpuEvent objects as available again.
     Pal::Result Reset();
 
-    /// Provide an unused GpuEvent from available list, or allocate a new one if available list is empty.
+    /// Provide an unused GpuEvent from the pool, or allocate a new slab of events if every event is busy.
     ///
     /// @param [in] ppEvent  The provided available event.
     Pal::Result AcquireEvent(Pal::IGpuEvent**const ppEvent);
@@ -90,8 +92,13 @@ private:
     Pal::IPlatform*const m_pPlatform;
     Pal::IDevice*const   m_pDevice;
 
-    GpuEventDeque m_availableEvents;
-    GpuEventDeque m_busyEvents;
+    Pal::Result CreateSlab(Pal::uint32 numEvents);
+
+    // Events [0, m_numBusyEvents) of m_events are busy and the rest are available.
+    Util::Vector<Pal::IGpuEvent*, 16, Pal::IPlatform> m_events;
+    Util::Vector<void*, 4, Pal::IPlatform>            m_slabs;
+    Pal::uint32                                       m_numBusyEvents;
+    size_t                                            m_eventSize;
 
     PAL_DISALLOW_DEFAULT_CTOR(GpuEventPool);
     PAL_DISALLOW_COPY_AND_ASSIGN(GpuEventPool);
@@ -237,8 +237,7 @@ void TextWriter<Allocator>::DrawDebugText(
 
         // Pack the raw draw colors into the destination format.
         const Pal::SwizzledFormat imgFormat = dstImage.GetImageCreateInfo().swizzledFormat;
-        Pal::uint32 foregroundColor[4] = {};
-        Pal::uint32 backgroundColor[4] = {};
+        Pal::uint32 colors[2][4] = {}; // Indexed by WhiteColor and BlackColor, like each ColorTable below.
 
         // Convert the raw color into the destination format.
         if (Pal::Formats::IsUnorm(imgFormat.format)   || Pal::Formats::IsSnorm(imgFormat.format)   ||
@@ -251,8 +250,8 @@ void TextWriter<Allocator>::DrawDebugText(
                 { 0.0f, 0.0f, 0.0f, 1.0f },     // Black
             };
 
-            Pal::Formats::ConvertColor(imgFormat, &ColorTable[WhiteColor][0], &foregroundColor[0]);
-            Pal::Formats::ConvertColor(imgFormat, &ColorTable[BlackColor][0], &backgroundColor[0]);
+            // Both colors share the image's format, so convert the whole table in one call.
+            Pal::Formats::ConvertColors(imgFormat, 2, &ColorTable[0][0], &colors[0][0]);
         }
         else if (Pal::Formats::IsSint(imgFormat.format))
         {
@@ -261,8 +260,7 @@ void TextWriter<Allocator>::DrawDebugText(
                 { 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF, 0x7FFFFFFF },     // White
                 { 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF },     // Black
             };
-            memcpy(&foregroundColor[0], &ColorTable[WhiteColor][0], sizeof(foregroundColor));
-            memcpy(&backgroundColor[0], &ColorTable[BlackColor][0], sizeof(backgroundColor));
+            memcpy(&colors[0][0], &ColorTable[0][0], sizeof(colors));
         }
         else
         {
@@ -274,15 +272,14 @@ void TextWriter<Allocator>::DrawDebugText(
                 { 0x00000000, 0x00000000, 0x00000000, 0xFFFFFFFF },     // Black
             };
 
-            memcpy(&foregroundColor[0], &ColorTable[WhiteColor][0], sizeof(foregroundColor));
-            memcpy(&backgroundColor[0], &ColorTable[BlackColor][0], sizeof(backgroundColor));
+            memcpy(&colors[0][0], &ColorTable[0][0], sizeof(colors));
         }
 
         Pal::uint32 swizzledForegroundColor[4] = {};
         Pal::uint32 swizzledBackgroundColor[4] = {};
 
-        Pal::Formats::SwizzleColor(imgFormat, foregroundColor, swizzledForegroundColor);
-        Pal::Formats::SwizzleColor(imgFormat, backgroundColor, swizzledBackgroundColor);
+        Pal::Formats::SwizzleColor(imgFormat, colors[WhiteColor], swizzledForegroundColor);
+        Pal::Formats::SwizzleColor(imgFormat, colors[BlackColor], swizzledBackgroundColor);
 
         Pal::Formats::PackRawClearColor(imgFormat, swizzledForegroundColor, &info.foregroundColor[0]);
         Pal::Formats::PackRawClearColor(imgFormat, swizzledBackgroundColor, &info.backgroundColor[0]);
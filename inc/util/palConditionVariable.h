@@ -33,8 +33,6 @@
 
 #include "palUtil.h"
 
-#include <pthread.h>
-
 namespace Util
 {
 
@@ -49,7 +47,7 @@ class Mutex;
 class ConditionVariable
 {
 public:
-    ConditionVariable() : m_osCondVariable() { }
+    ConditionVariable() : m_sequence(0) { }
 
     /// Releases any OS-specific objects if they haven't previously been released in an explicit Destroy() call.
     ~ConditionVariable();
@@ -79,7 +77,7 @@ public:
     void WakeAll();
 
 private:
-    pthread_cond_t     m_osCondVariable; // Linux-specific ConditionVariable structure.
+    volatile uint32 m_sequence; // Futex word which is bumped by every wake.
 
     PAL_DISALLOW_COPY_AND_ASSIGN(ConditionVariable);
 };
@@ -33,6 +33,7 @@
 
 #include "palAssert.h"
 #include "palSysMemory.h"
+#include <type_traits>
 
 namespace Util
 {
@@ -100,9 +101,9 @@ private:
  *
  * @warning This class is not thread-safe for push, pop, or iteration!
  *
- * @note This class is only designed to work with native types and POD-style structures. If it is needed to have a Deque
- *       of complex objects with nontrivial destructors, copy constructors or assign operators, then a specialized
- *       implementation of CleanupElement() will need to be explicitly defined.
+ * @note Elements are constructed in place inside the deque's blocks and destroyed when they are popped, so types with
+ *       nontrivial constructors, destructors or move semantics are supported. Move-only types should be pushed with the
+ *       rvalue overloads or Emplace*().
  ***********************************************************************************************************************
  */
 template<typename T, typename Allocator>
@@ -169,9 +170,43 @@ public:
     ///          failed because of an internal failure to allocate system memory.
     Result PushBack(const T& data);
 
+    /// Moves the specified item onto the front of the deque.
+    ///
+    /// @param [in] data Item to be added to the front of the deque.
+    ///
+    /// @returns @ref Success if the item was successfully added to the deque or @ref ErrorOutOfMemory if the operation
+    ///          failed because of an internal failure to allocate system memory.
+    Result PushFront(T&& data);
+
+    /// Moves the specified item onto the back of the deque.
+    ///
+    /// @param [in] data Item to be added to the back of the deque.
+    ///
+    /// @returns @ref Success if the item was successfully added to the deque or @ref ErrorOutOfMemory if the operation
+    ///          failed because of an internal failure to allocate system memory.
+    Result PushBack(T&& data);
+
+    /// Constructs a new item in place at the front of the deque.
+    ///
+    /// @param [in] args Arguments forwarded to the constructor of T.
+    ///
+    /// @returns @ref Success if the item was successfully added to the deque or @ref ErrorOutOfMemory if the operation
+    ///          failed because of an internal failure to allocate system memory.
+    template<typename... Args>
+    Result EmplaceFront(Args&&... args);
+
+    /// Constructs a new item in place at the back of the deque.
+    ///
+    /// @param [in] args Arguments forwarded to the constructor of T.
+    ///
+    /// @returns @ref Success if the item was successfully added to the deque or @ref ErrorOutOfMemory if the operation
+    ///          failed because of an internal failure to allocate system memory.
+    template<typename... Args>
+    Result EmplaceBack(Args&&... args);
+
     /// Pops the first item off the front of the deque, returning the popped value.
     ///
-    /// @param [out] pOut Item popped off the front of the deque.
+    /// @param [out] pOut Item popped off the front of the deque. It is move-assigned from the removed item.
     ///
     /// @returns @ref Success if the item was successfully popped from the deque or @ref ErrorUnavailable if the deque
     ///          is empty.
@@ -179,7 +214,7 @@ public:
 
     /// Pops the first item off the back of the deque, returning the popped value.
     ///
-    /// @param [out] pOut Item popped off the back of the deque.
+    /// @param [out] pOut Item popped off the back of the deque. It is move-assigned from the removed item.
     ///
     /// @returns @ref Success if the item was successfully popped from the deque or @ref ErrorUnavailable if the deque
     ///          is empty.
@@ -189,10 +224,19 @@ private:
     DequeBlockHeader* AllocateNewBlock();
     void FreeUnusedBlock(DequeBlockHeader* pHeader);
 
-    // Acts as a proxy for the destructor of a data element when one is popped.  If T is a native or POD type this
-    // function is safe to be empty.  However, if the objects being stored require complex move/copy/delete semantics
-    // we'd need to have a specialization explicitly declared.
-    void CleanupElement(T* pData) const { }
+    // These reserve uninitialized storage for one new element at either end of the deque. They return null if a new
+    // block was needed and could not be allocated.
+    T* AllocFrontSlot();
+    T* AllocBackSlot();
+
+    // Destroys a data element when it is popped. This does nothing for trivially destructible types.
+    void CleanupElement(T* pData) const
+    {
+        if (!std::is_trivially_destructible<T>::value)
+        {
+            pData->~T();
+        }
+    }
 
     size_t            m_numElements;      // Number of elements
 
@@ -32,6 +32,7 @@
 #pragma once
 
 #include "palDeque.h"
+#include "palInlineFuncs.h"
 #include "palSysMemory.h"
 
 namespace Util
@@ -102,12 +103,12 @@ PAL_INLINE void Deque<T, Allocator>::FreeUnusedBlock(
 }
 
 // =====================================================================================================================
-// Inserts a new data element at the front of the deque.
+// Reserves uninitialized storage for a new data element at the front of the deque, allocating a new front block if the
+// current one is full. Returns null if the allocation fails; otherwise the caller must construct the element in place.
 template<typename T, typename Allocator>
-PAL_INLINE Result Deque<T, Allocator>::PushFront(
-    const T& data)
+PAL_INLINE T* Deque<T, Allocator>::AllocFrontSlot()
 {
-    Result result = Result::ErrorOutOfMemory;
+    T* pSlot = nullptr;
 
     if ((m_pFrontHeader == nullptr) || (m_pFront == m_pFrontHeader->pStart))
     {
@@ -125,14 +126,14 @@ PAL_INLINE Result Deque<T, Allocator>::PushFront(
 
             m_pFrontHeader = pNewBlock;
             // The new front element is the last slot in the new block. We point the front element ptr off the block
-            // because it gets decremented right before copying in the data.
+            // because it gets decremented right before constructing the data.
             m_pFront = static_cast<T*>(pNewBlock->pEnd);
 
             if (m_pBackHeader == nullptr)
             {
                 m_pBackHeader = pNewBlock;
                 // If the deque is presently empty, the front and back element ptrs need to match at the end of this
-                // function. Set up m_pBack to point where m_pFront will after the data is copied in.
+                // function. Set up m_pBack to point where m_pFront will after the data is constructed.
                 m_pBack = (m_pFront - 1);
             }
         }
@@ -143,21 +144,20 @@ PAL_INLINE Result Deque<T, Allocator>::PushFront(
         // There's room at the beginning of the current block, so we can throw the new element in there.
         ++m_numElements;
         --m_pFront;
-        *m_pFront = data;
 
-        result = Result::_Success;
+        pSlot = m_pFront;
     }
 
-    return result;
+    return pSlot;
 }
 
 // =====================================================================================================================
-// Inserts a new data element at the back of the deque.
+// Reserves uninitialized storage for a new data element at the back of the deque, allocating a new back block if the
+// current one is full. Returns null if the allocation fails; otherwise the caller must construct the element in place.
 template<typename T, typename Allocator>
-PAL_INLINE Result Deque<T, Allocator>::PushBack(
-    const T& data)
+PAL_INLINE T* Deque<T, Allocator>::AllocBackSlot()
 {
-    Result result = Result::ErrorOutOfMemory;
+    T* pSlot = nullptr;
 
     if ((m_pBackHeader == nullptr) || ((m_pBack + 1) == m_pBackHeader->pEnd))
     {
@@ -175,14 +175,14 @@ PAL_INLINE Result Deque<T, Allocator>::PushBack(
 
             m_pBackHeader = pNewBlock;
             // The new back element is the first slot in the new block. We point the back element ptr off the block
-            // because it gets incremented right before copying in the data.
+            // because it gets incremented right before constructing the data.
             m_pBack = (static_cast<T*>(pNewBlock->pStart) - 1);
 
             if (m_pFrontHeader == nullptr)
             {
                 m_pFrontHeader = pNewBlock;
                 // If the deque is presently empty, the front and back element ptrs need to match at the end of this
-                // function. Set up m_pFront to point where m_pBack will after the data is copied in.
+                // function. Set up m_pFront to point where m_pBack will after the data is constructed.
                 m_pFront = static_cast<T*>(pNewBlock->pStart);
             }
         }
@@ -193,7 +193,84 @@ PAL_INLINE Result Deque<T, Allocator>::PushBack(
         // There's room at the end of the current block, so we can throw the new element in there.
         ++m_numElements;
         ++m_pBack;
-        *m_pBack = data;
+
+        pSlot = m_pBack;
+    }
+
+    return pSlot;
+}
+
+// =====================================================================================================================
+// Inserts a new data element at the front of the deque.
+template<typename T, typename Allocator>
+PAL_INLINE Result Deque<T, Allocator>::PushFront(
+    const T& data)
+{
+    return EmplaceFront(data);
+}
+
+// =====================================================================================================================
+// Moves a new data element onto the front of the deque.
+template<typename T, typename Allocator>
+PAL_INLINE Result Deque<T, Allocator>::PushFront(
+    T&& data)
+{
+    return EmplaceFront(Move(data));
+}
+
+// =====================================================================================================================
+// Inserts a new data element at the back of the deque.
+template<typename T, typename Allocator>
+PAL_INLINE Result Deque<T, Allocator>::PushBack(
+    const T& data)
+{
+    return EmplaceBack(data);
+}
+
+// =====================================================================================================================
+// Moves a new data element onto the back of the deque.
+template<typename T, typename Allocator>
+PAL_INLINE Result Deque<T, Allocator>::PushBack(
+    T&& data)
+{
+    return EmplaceBack(Move(data));
+}
+
+// =====================================================================================================================
+// Constructs a new data element in place at the front of the deque.
+template<typename T, typename Allocator>
+template<typename... Args>
+PAL_INLINE Result Deque<T, Allocator>::EmplaceFront(
+    Args&&... args)
+{
+    Result result = Result::ErrorOutOfMemory;
+
+    T*const pSlot = AllocFrontSlot();
+
+    if (pSlot != nullptr)
+    {
+        PAL_PLACEMENT_NEW(pSlot) T(static_cast<Args&&>(args)...);
+
+        result = Result::_Success;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Constructs a new data element in place at the back of the deque.
+template<typename T, typename Allocator>
+template<typename... Args>
+PAL_INLINE Result Deque<T, Allocator>::EmplaceBack(
+    Args&&... args)
+{
+    Result result = Result::ErrorOutOfMemory;
+
+    T*const pSlot = AllocBackSlot();
+
+    if (pSlot != nullptr)
+    {
+        PAL_PLACEMENT_NEW(pSlot) T(static_cast<Args&&>(args)...);
 
         result = Result::_Success;
     }
@@ -213,10 +290,10 @@ PAL_INLINE Result Deque<T, Allocator>::PopFront(
     {
         PAL_ASSERT((m_pFrontHeader != nullptr) && (m_pFront != nullptr));
 
-        // First, copy the front element into the output buffer and clean up our copy of it.
+        // First, move the front element into the output buffer and clean up our copy of it.
         if (pOut != nullptr)
         {
-            *pOut = *m_pFront;
+            *pOut = Move(*m_pFront);
         }
 
         CleanupElement(m_pFront);
@@ -270,10 +347,10 @@ PAL_INLINE Result Deque<T, Allocator>::PopBack(
     {
         PAL_ASSERT((m_pBackHeader != nullptr) && (m_pBack != nullptr));
 
-        // First, copy the back element into the output buffer and clean up our copy of it.
+        // First, move the back element into the output buffer and clean up our copy of it.
         if (pOut != nullptr)
         {
-            *pOut = *m_pBack;
+            *pOut = Move(*m_pBack);
         }
 
         CleanupElement(m_pBack);
@@ -99,6 +99,23 @@ public:
     /// @returns Success if the flush completes successfully.
     bool Flush();
 
+    /// Places an advisory lock on the file, blocking until it can be acquired.  The lock only coordinates callers
+    /// which lock the same file; it doesn't prevent any other access to the file.
+    ///
+    /// @param  exclusive  Whether to take an exclusive lock instead of a shared one.
+    ///
+    /// @returns Success if the lock was acquired.
+    Result Lock(bool exclusive);
+
+    /// Releases an advisory lock placed by Lock().
+    void Unlock();
+
+    /// Checks whether the file name this mapping was created with still refers to the mapped file.  It doesn't once
+    /// the file has been deleted, or if another file was renamed over it.
+    ///
+    /// @returns True if the mapped file has been replaced or the mapping isn't open.
+    bool IsFileReplaced() const;
+
 private:
     int         m_fileHandle;       ///< File descriptor of the file that is opened for mapping
     bool        m_writeable;        ///< Flag that indicates if this mapping is writeable
@@ -0,0 +1,240 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2014-2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palJobSystem.h
+ * @brief PAL utility collection JobSystem class declaration.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palConditionVariable.h"
+#include "palDeque.h"
+#include "palMutex.h"
+#include "palSemaphore.h"
+#include "palSysMemory.h"
+#include "palThread.h"
+#include "palVector.h"
+#include <atomic>
+
+namespace Util
+{
+
+/// Entrypoint of a job.  The job is complete when this function returns.
+typedef void (*JobFunction)(void* pData);
+
+/**
+ ***********************************************************************************************************************
+ * @brief Tracks the completion of a group of jobs.
+ *
+ * Every job submitted with a counter increments it, and decrements it once the job has finished running.  A counter can
+ * be waited on with @ref JobSystem::Wait, or used as the dependency of later jobs.  A counter must outlive all jobs
+ * which reference it.
+ ***********************************************************************************************************************
+ */
+class JobCounter
+{
+public:
+    JobCounter() : m_pending(0) { }
+    ~JobCounter() { PAL_ASSERT(IsDone()); }
+
+    /// Returns true if every job which was submitted with this counter has finished running.
+    bool IsDone() const { return (m_pending.load(std::memory_order_acquire) == 0); }
+
+private:
+    std::atomic<uint32> m_pending;
+
+    friend class JobSystem;
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(JobCounter);
+};
+
+/// Describes a job to be run by a @ref JobSystem.
+struct JobInfo
+{
+    JobFunction pfnJob;      ///< Function to run.
+    void*       pData;       ///< Argument passed to pfnJob.
+    JobCounter* pCounter;    ///< Optional counter which tracks this job's completion.
+    JobCounter* pDependency; ///< Optional counter which must be done before this job may start running.
+};
+
+/// Specifies properties for @ref JobSystem initialization.
+struct JobSystemCreateInfo
+{
+    union
+    {
+        struct
+        {
+            uint32 clientThreads :  1; ///< The JobSystem won't create any threads.  Instead, the client must call
+                                       ///  @ref JobSystem::RunWorker once for every worker index from threads it owns.
+            uint32 ccxAffinity   :  1; ///< Pin the JobSystem's own worker threads to the CPU's core complexes (CCX), and
+                                       ///  prefer stealing work from workers on the same CCX.  Ignored on CPUs which
+                                       ///  don't report CCX affinity masks.
+            uint32 reserved      : 30; ///< Reserved for future use.
+        };
+        uint32 u32All;                 ///< Flags packed as a 32-bit uint.
+    } flags;                           ///< JobSystem creation flags.
+
+    uint32 numWorkers;     ///< Number of workers.  Zero selects one worker per logical core, minus one for the
+                           ///  submitting thread.
+    uint32 jobQueueSize;   ///< Number of jobs each worker can queue locally before spilling into the shared queue.
+                           ///  Rounded up to a power of two.  Zero selects a default.
+};
+
+/**
+ ***********************************************************************************************************************
+ * @brief Work-stealing thread pool.
+ *
+ * Every worker owns a fixed-size Chase-Lev deque: jobs submitted from a worker thread are pushed to and popped from the
+ * bottom of that worker's deque without locking, while idle workers steal from the top of other workers' deques.  Jobs
+ * submitted from any other thread, and jobs which don't fit in a worker's deque, go to a mutex-protected shared queue.
+ *
+ * Jobs may depend on a @ref JobCounter.  Such a job is held back until the counter is done, and is then queued by the
+ * thread which finished the counter's last job.  Threads which wait on a counter run queued jobs while they wait, and
+ * sleep when there are none.
+ *
+ * @warning Init(), Shutdown() and the destructor are not thread safe.  Submit() and Wait() may be called from any
+ *          thread.
+ ***********************************************************************************************************************
+ */
+class JobSystem
+{
+public:
+    /// Constructor.
+    ///
+    /// @param [in] pAllocator  The allocator that will allocate memory if required.
+    template <typename Allocator>
+    explicit JobSystem(Allocator*const pAllocator)
+        :
+        m_allocator(pAllocator),
+        m_pWorkers(nullptr),
+        m_numWorkers(0),
+        m_clientThreads(false),
+        m_sharedJobs(&m_allocator),
+        m_numSharedJobs(0),
+        m_deferredJobs(&m_allocator),
+        m_numWaiters(0),
+        m_numSleeping(0),
+        m_shutdown(false),
+        m_workerKeyValid(false)
+    { }
+
+    /// Destructor.  Shuts the JobSystem down if the client didn't.
+    ~JobSystem();
+
+    /// Initializes the JobSystem and, unless clientThreads is set, starts its worker threads.
+    ///
+    /// @param [in] createInfo  Properties of the JobSystem.
+    ///
+    /// @returns @ref Success if successful, otherwise an appropriate error.
+    Result Init(const JobSystemCreateInfo& createInfo);
+
+    /// Stops all workers once the jobs which are already queued have run.  In clientThreads mode this makes
+    /// RunWorker() return; the client must then join its threads before destroying the JobSystem.
+    void Shutdown();
+
+    /// Queues a job.  If the job's dependency isn't done yet, the job is held back until it is.
+    ///
+    /// @param [in] info  Description of the job.
+    ///
+    /// @returns @ref Success if the job was queued (or run immediately because no queue space could be allocated), or
+    ///          @ref ErrorInvalidValue if info has no job function.
+    Result Submit(const JobInfo& info);
+
+    /// Runs queued jobs on the calling thread until the given counter is done, sleeping while there are none to run.
+    ///
+    /// @param [in] pCounter  Counter to wait on.
+    void Wait(const JobCounter* pCounter);
+
+    /// Runs a worker on the calling thread until Shutdown() is called.  Only valid in clientThreads mode, where it
+    /// must be called exactly once for every worker index.
+    ///
+    /// @param [in] workerIndex  Index of the worker to run, less than NumWorkers().
+    void RunWorker(uint32 workerIndex);
+
+    /// Returns the number of workers in this JobSystem.
+    uint32 NumWorkers() const { return m_numWorkers; }
+
+private:
+    // A job as stored in the queues.  The dependency has already been satisfied by the time a job is queued.
+    struct Job
+    {
+        JobFunction pfnJob;
+        void*       pData;
+        JobCounter* pCounter;
+    };
+
+    // A job held back until its dependency is done.  The dependency is reset to null once the job may be queued.
+    struct DeferredJob
+    {
+        Job         job;
+        JobCounter* pDependency;
+    };
+
+    struct Worker;
+
+    static void WorkerThreadFunc(void* pParameter);
+
+    void    WorkerLoop(Worker* pWorker);
+    bool    RunOneJob(Worker* pWorker);
+    bool    FindJob(Worker* pWorker, Job* pJob);
+    bool    HasQueuedJobs() const;
+    void    Enqueue(const Job& job);
+    void    Execute(const Job& job);
+    void    FinishCounter(JobCounter* pCounter);
+    void    ReleaseDeferredJobs();
+    void    WakeWorkers(uint32 count);
+    Worker* CurrentWorker() const;
+
+    IndirectAllocator m_allocator;
+    Worker*           m_pWorkers;
+    uint32            m_numWorkers;
+    bool              m_clientThreads;
+
+    // Jobs submitted from non-worker threads, or which overflowed a worker's deque.
+    Mutex                         m_sharedLock;
+    Deque<Job, IndirectAllocator> m_sharedJobs;
+    std::atomic<uint32>           m_numSharedJobs;
+
+    // Jobs whose dependency isn't done yet.  Counters only reach zero under m_deferredLock, which is also the lock that
+    // threads blocked in Wait() sleep on.
+    Mutex                                      m_deferredLock;
+    Vector<DeferredJob, 16, IndirectAllocator> m_deferredJobs;
+    ConditionVariable                          m_waitCondition;  // Woken when a counter is done or a job is queued.
+    std::atomic<uint32>                        m_numWaiters;     // Number of threads waiting on m_waitCondition.
+
+    Semaphore           m_wakeup;       // Posted when work is queued while workers are sleeping.
+    std::atomic<uint32> m_numSleeping;  // Number of workers waiting on m_wakeup.
+    std::atomic<bool>   m_shutdown;
+
+    ThreadLocalKey      m_workerKey;    // Maps each worker thread to its Worker.
+    bool                m_workerKeyValid;
+
+    PAL_DISALLOW_DEFAULT_CTOR(JobSystem);
+    PAL_DISALLOW_COPY_AND_ASSIGN(JobSystem);
+};
+
+} // Util
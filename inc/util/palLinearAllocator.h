@@ -37,6 +37,23 @@
 namespace Util
 {
 
+/// Flags controlling how a VirtualLinearAllocator backs its virtual address reservation with memory.
+union VirtualLinearAllocatorFlags
+{
+    struct
+    {
+        uint32 largePages      :  1; ///< Back the reservation with transparent huge pages if the OS supports them.
+                                     ///  This aligns the reservation and each commit to the large page size.
+        uint32 geometricGrowth :  1; ///< Grow the committed region by at least its current size each time it runs
+                                     ///  out instead of committing exactly the pages needed by the allocation.
+        uint32 retainCommitted :  1; ///< When rewinding with decommit, keep memory committed up to the high-water mark
+                                     ///  reached since the last rewind to the start and only decommit the surplus.
+        uint32 prefault        :  1; ///< Pre-fault newly committed memory so allocations never take page faults.
+        uint32 reserved        : 28; ///< Reserved for future use.
+    };
+    uint32 u32All;                   ///< Flags packed as 32-bit uint.
+};
+
 /**
  ***********************************************************************************************************************
  * @brief A linear allocator that allocates virtual memory.
@@ -46,7 +63,8 @@ namespace Util
  * incrementally back it with real memory as necessary.
  *
  * As clients reach a steady state, allocations from this allocator will become "free," essentially just costing a
- * pointer increment.
+ * pointer increment.  @ref VirtualLinearAllocatorFlags can be used to reduce the number of commit syscalls and page
+ * faults taken before that steady state is reached.
  *
  * This allocator can be used with any of the memory management macros. @see Allocators for more information about the
  * Allocation pattern.
@@ -62,8 +80,25 @@ public:
     VirtualLinearAllocator(size_t size) :
         m_pStart(nullptr),
         m_pCurrent(nullptr),
+        m_pCommittedToPage(nullptr),
+        m_pHighWaterMark(nullptr),
         m_size(size),
-        m_pageSize(0) {}
+        m_pageSize(0),
+        m_commitGranularity(0)
+    {
+        m_flags.u32All = 0;
+    }
+
+    /// Constructor.
+    ///
+    /// @param [in] size  Maximum size, in bytes, of virtual memory that this allocator should reserve.
+    ///                   Does not need to be aligned to page size.
+    /// @param [in] flags Controls how the reservation is committed.
+    VirtualLinearAllocator(size_t size, VirtualLinearAllocatorFlags flags) :
+        VirtualLinearAllocator(size)
+    {
+        m_flags = flags;
+    }
 
     /// Destructor.
     virtual ~VirtualLinearAllocator()
@@ -81,20 +116,37 @@ public:
     /// @returns Result::Success if memory reservation and committing of the first page is successful.
     Result Init()
     {
-        m_pageSize = VirtualPageSize();
-        m_size     = Pow2Align(m_size, m_pageSize);
+        m_pageSize          = VirtualPageSize();
+        m_commitGranularity = m_pageSize;
 
-        Result result = VirtualReserve(m_size, &m_pStart);
+        if (m_flags.largePages != 0)
+        {
+            const size_t largePageSize = VirtualLargePageSize();
+
+            if (largePageSize > m_pageSize)
+            {
+                m_commitGranularity = largePageSize;
+            }
+            else
+            {
+                m_flags.largePages = 0;
+            }
+        }
+
+        m_size = Pow2Align(m_size, m_commitGranularity);
+
+        Result result = VirtualReserve(m_size, &m_pStart, nullptr, m_commitGranularity);
 
         if (result == Result::_Success)
         {
-            result = VirtualCommit(m_pStart, m_pageSize);
+            result = Commit(m_pStart, m_commitGranularity);
         }
 
         if (result == Result::_Success)
         {
             m_pCurrent         = m_pStart;
-            m_pCommittedToPage = VoidPtrInc(m_pCurrent, m_pageSize);
+            m_pHighWaterMark   = m_pStart;
+            m_pCommittedToPage = VoidPtrInc(m_pCurrent, m_commitGranularity);
         }
 
         return result;
@@ -109,13 +161,23 @@ public:
     {
         void* pAlignedCurrent = VoidPtrAlign(m_pCurrent, allocInfo.alignment);
         void* pNextCurrent    = VoidPtrInc(pAlignedCurrent, allocInfo.bytes);
-        void* pAlignedEnd     = VoidPtrAlign(pNextCurrent, m_pageSize);
 
-        if (pAlignedEnd > m_pCommittedToPage)
+        if (pNextCurrent > m_pCommittedToPage)
         {
-            const size_t commitBytes = VoidPtrDiff(pAlignedEnd, m_pCommittedToPage);
+            void*const pEnd        = VoidPtrInc(m_pStart, m_size);
+            void*const pAlignedEnd = VoidPtrAlign(pNextCurrent, m_commitGranularity);
 
-            const Result result = VirtualCommit(m_pCommittedToPage, commitBytes);
+            size_t commitBytes = VoidPtrDiff(pAlignedEnd, m_pCommittedToPage);
+
+            if (m_flags.geometricGrowth != 0)
+            {
+                // Doubling the committed region bounds the number of commits to log2 of the peak size.
+                commitBytes = Max(commitBytes, VoidPtrDiff(m_pCommittedToPage, m_pStart));
+                commitBytes = Min(commitBytes, VoidPtrDiff(pEnd, m_pCommittedToPage));
+            }
+
+            const Result result = (pAlignedEnd <= pEnd) ? Commit(m_pCommittedToPage, commitBytes)
+                                                        : Result::ErrorOutOfMemory;
 
             if (result == Result::_Success)
             {
@@ -144,25 +206,32 @@ public:
     /// Rewinds the current pointer to the specified location to reuse already allocated memory.
     ///
     /// @param pStart   Where to reset the m_pCurrent to.
-    /// @param decommit If true, pages that are rewound are freed/decommitted.
+    /// @param decommit If true, pages that are rewound are freed/decommitted. If the allocator was created with the
+    ///                 retainCommitted flag, only pages above the high-water mark are decommitted.
     void   Rewind(void* pStart, bool decommit)
     {
         PAL_ASSERT((m_pStart <= pStart) && (pStart <= m_pCurrent));
 
+        // m_pCurrent only moves backwards here, so sampling it on each rewind tracks the peak usage exactly.
+        m_pHighWaterMark = Max(m_pHighWaterMark, m_pCurrent);
+
         if (pStart != m_pCurrent)
         {
             if (decommit)
             {
-                void*        pStartPage   = VoidPtrAlign(VoidPtrInc(pStart, 1), m_pageSize);
-                void*        pCurrentPage = VoidPtrAlign(m_pCurrent, m_pageSize);
-                const size_t numPages     = VoidPtrDiff(pCurrentPage, pStartPage) / m_pageSize;
+                void* pKeepEnd = VoidPtrAlign(VoidPtrInc(pStart, 1), m_commitGranularity);
+
+                if (m_flags.retainCommitted != 0)
+                {
+                    pKeepEnd = Max(pKeepEnd, VoidPtrAlign(m_pHighWaterMark, m_commitGranularity));
+                }
 
-                if (numPages > 0)
+                if (m_pCommittedToPage > pKeepEnd)
                 {
-                    Result result = VirtualDecommit(pStartPage, m_pageSize * numPages);
+                    Result result = VirtualDecommit(pKeepEnd, VoidPtrDiff(m_pCommittedToPage, pKeepEnd));
                     PAL_ASSERT(result == Result::_Success);
 
-                    m_pCommittedToPage = pStartPage;
+                    m_pCommittedToPage = pKeepEnd;
                 }
             }
 #if DEBUG
@@ -182,6 +251,12 @@ public:
 
             m_pCurrent = pStart;
         }
+
+        if (pStart == m_pStart)
+        {
+            // A full rewind starts a new usage cycle; the next cycle's peak decides what gets retained.
+            m_pHighWaterMark = m_pStart;
+        }
     }
 
     /// Returns the current pointer to backing memory.
@@ -199,18 +274,49 @@ public:
     /// @returns Number of bytes allocated through this allocator.
     size_t BytesAllocated() { return VoidPtrDiff(m_pCurrent, m_pStart); }
 
+    /// Returns the number of bytes currently backed by committed memory.
+    ///
+    /// @returns Number of bytes committed by this allocator.
+    size_t BytesCommitted() const { return VoidPtrDiff(m_pCommittedToPage, m_pStart); }
+
     /// Compute remaining unallocated space in the allocator; once this space is exhausted allocations will fail.
     ///
     /// @returns The size of the remaining unallocated space in bytes.
     size_t Remaining() const { return m_size - VoidPtrDiff(m_pCurrent, m_pStart); }
 
 private:
+    // Commits the given range and applies the large page and pre-fault options to it.
+    Result Commit(void* pMem, size_t bytes)
+    {
+        const Result result = VirtualCommit(pMem, bytes);
+
+        if (result == Result::_Success)
+        {
+            if (m_flags.largePages != 0)
+            {
+                // This is only advice; if the OS refuses we still have perfectly usable small pages.
+                VirtualAdviseLargePages(pMem, bytes);
+            }
+
+            if (m_flags.prefault != 0)
+            {
+                VirtualPrefault(pMem, bytes);
+            }
+        }
+
+        return result;
+    }
+
     void*  m_pStart;            ///< Pointer to where the backing allocation starts.
     void*  m_pCurrent;          ///< Pointer to the current position of backing memory.
     void*  m_pCommittedToPage;  ///< Pointer to the end of the last committed page.
+    void*  m_pHighWaterMark;    ///< Highest m_pCurrent seen since the last rewind to m_pStart.
 
     size_t m_size;              ///< Size of the allocation.
     size_t m_pageSize;          ///< OS' defined page size.
+    size_t m_commitGranularity; ///< Size that all commits are aligned to; the large page size if large pages are used.
+
+    VirtualLinearAllocatorFlags m_flags; ///< Options controlling how memory is committed.
 
     PAL_DISALLOW_DEFAULT_CTOR(VirtualLinearAllocator);
     PAL_DISALLOW_COPY_AND_ASSIGN(VirtualLinearAllocator);
@@ -324,6 +430,13 @@ public:
     /// Constructor.
     VirtualLinearAllocatorWithNode(size_t size) : VirtualLinearAllocator(size), m_node(this) {}
 
+    /// Constructor.
+    VirtualLinearAllocatorWithNode(size_t size, VirtualLinearAllocatorFlags flags)
+        :
+        VirtualLinearAllocator(size, flags),
+        m_node(this)
+    {}
+
     /// Destructor.
     virtual ~VirtualLinearAllocatorWithNode() {}
 
@@ -0,0 +1,205 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2014-2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palLockFreeRingBuffer.h
+ * @brief PAL utility collection SpscRingBuffer and MpscRingBuffer class declarations.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palUtil.h"
+#include <atomic>
+#include <type_traits>
+
+namespace Util
+{
+
+/**
+ ***********************************************************************************************************************
+ * @brief Bounded, lock-free queue for handing elements from one producer thread to one consumer thread.
+ *
+ * Push and pop are wait-free.  Each side only writes its own index, and keeps a cached copy of the other side's index
+ * which it refreshes only when the queue looks full (producer) or empty (consumer).  The two indices live on separate
+ * cache lines, so in the steady state a push or pop touches no cache line written by the other thread except the slots
+ * themselves.
+ *
+ * Elements are copied in and out with memcpy semantics, so T must be trivially copyable.  Typically T is a pointer or a
+ * small POD describing a unit of work.
+ *
+ * @warning Push() and PushBatch() may only be called from one thread at a time, as may Pop() and PopBatch().
+ ***********************************************************************************************************************
+ */
+template <typename T, typename Allocator>
+class SpscRingBuffer
+{
+    static_assert(std::is_trivially_copyable<T>::value, "SpscRingBuffer elements must be trivially copyable.");
+
+public:
+    /// Constructs an empty ring buffer.  Init() must be called before use.
+    ///
+    /// @param [in] pAllocator The allocator that will allocate the slot array.
+    explicit SpscRingBuffer(Allocator*const pAllocator);
+    ~SpscRingBuffer();
+
+    /// Allocates the slot array.
+    ///
+    /// @param [in] minCapacity Minimum number of elements the ring buffer can hold; rounded up to a power of two.
+    ///
+    /// @returns @ref Success if successful, or @ref ErrorOutOfMemory if the slot array couldn't be allocated.
+    Result Init(uint32 minCapacity);
+
+    /// Returns the maximum number of elements the ring buffer can hold.
+    uint32 Capacity() const { return (m_mask + 1); }
+
+    /// Appends an element.  Must only be called from the producer thread.
+    ///
+    /// @returns True if the element was pushed, or false if the ring buffer is full.
+    bool Push(const T& item);
+
+    /// Appends as many elements from pItems as fit, publishing them all at once.  Must only be called from the producer
+    /// thread.
+    ///
+    /// @returns The number of elements pushed, which is less than count if the ring buffer filled up.
+    uint32 PushBatch(const T* pItems, uint32 count);
+
+    /// Removes the oldest element.  Must only be called from the consumer thread.
+    ///
+    /// @returns True if an element was written to pItem, or false if the ring buffer is empty.
+    bool Pop(T* pItem);
+
+    /// Removes up to maxCount of the oldest elements, releasing their slots all at once.  Must only be called from the
+    /// consumer thread.
+    ///
+    /// @returns The number of elements written to pItems.
+    uint32 PopBatch(T* pItems, uint32 maxCount);
+
+    /// Returns true if the ring buffer is empty.  Only exact when called from the consumer thread.
+    bool IsEmpty() const;
+
+private:
+    T*                  m_pSlots;       // Array of (m_mask + 1) elements.
+    uint32              m_mask;         // Capacity minus one; indices are free-running and wrapped with this mask.
+    Allocator*const     m_pAllocator;   // Allocator for the slot array.
+
+    uint8               m_padding0[PAL_CACHE_LINE_BYTES];
+    std::atomic<uint32> m_head;         // Index of the oldest element.  Written only by the consumer.
+    uint32              m_cachedTail;   // Consumer's last observed value of m_tail.
+    uint8               m_padding1[PAL_CACHE_LINE_BYTES];
+    std::atomic<uint32> m_tail;         // Index one past the newest element.  Written only by the producer.
+    uint32              m_cachedHead;   // Producer's last observed value of m_head.
+    uint8               m_padding2[PAL_CACHE_LINE_BYTES];
+
+    PAL_DISALLOW_DEFAULT_CTOR(SpscRingBuffer);
+    PAL_DISALLOW_COPY_AND_ASSIGN(SpscRingBuffer);
+};
+
+/**
+ ***********************************************************************************************************************
+ * @brief Bounded, lock-free queue for handing elements from any number of producer threads to one consumer thread.
+ *
+ * This is Dmitry Vyukov's bounded queue specialized for a single consumer.  Every slot carries a sequence number which
+ * tells producers when the slot is free and tells the consumer when it has been published.  Producers claim slots with
+ * a compare-and-swap on the tail index, and then fill and publish them independently, so a slow producer only delays
+ * the consumer from reading past its own slot.  The consumer is wait-free.
+ *
+ * Elements are copied in and out with memcpy semantics, so T must be trivially copyable.
+ *
+ * @warning Pop() and PopBatch() may only be called from one thread at a time.  Push() and PushBatch() may be called
+ *          from any thread.
+ ***********************************************************************************************************************
+ */
+template <typename T, typename Allocator>
+class MpscRingBuffer
+{
+    static_assert(std::is_trivially_copyable<T>::value, "MpscRingBuffer elements must be trivially copyable.");
+
+public:
+    /// Constructs an empty ring buffer.  Init() must be called before use.
+    ///
+    /// @param [in] pAllocator The allocator that will allocate the slot array.
+    explicit MpscRingBuffer(Allocator*const pAllocator);
+    ~MpscRingBuffer();
+
+    /// Allocates the slot array.
+    ///
+    /// @param [in] minCapacity Minimum number of elements the ring buffer can hold; rounded up to a power of two, and
+    ///                         to at least two.
+    ///
+    /// @returns @ref Success if successful, or @ref ErrorOutOfMemory if the slot array couldn't be allocated.
+    Result Init(uint32 minCapacity);
+
+    /// Returns the maximum number of elements the ring buffer can hold.
+    uint32 Capacity() const { return (m_mask + 1); }
+
+    /// Appends an element.  May be called from any thread.
+    ///
+    /// @returns True if the element was pushed, or false if the ring buffer is full.
+    bool Push(const T& item);
+
+    /// Appends as many elements from pItems as fit.  The elements are claimed with a single compare-and-swap, so they
+    /// are consecutive in the ring buffer and won't be interleaved with other producers' elements.  May be called from
+    /// any thread.
+    ///
+    /// @returns The number of elements pushed, which is less than count if the ring buffer filled up.
+    uint32 PushBatch(const T* pItems, uint32 count);
+
+    /// Removes the oldest element.  Must only be called from the consumer thread.
+    ///
+    /// @returns True if an element was written to pItem, or false if the ring buffer is empty or the oldest element's
+    ///          producer hasn't finished publishing it yet.
+    bool Pop(T* pItem);
+
+    /// Removes up to maxCount of the oldest published elements.  Must only be called from the consumer thread.
+    ///
+    /// @returns The number of elements written to pItems.
+    uint32 PopBatch(T* pItems, uint32 maxCount);
+
+    /// Returns true if no published element is waiting to be popped.  Only exact when called from the consumer thread.
+    bool IsEmpty() const;
+
+private:
+    struct Slot
+    {
+        std::atomic<uint32> sequence;   // Equals the slot's index while free, and the index plus one once published.
+        T                   item;
+    };
+
+    Slot*               m_pSlots;       // Array of (m_mask + 1) slots.
+    uint32              m_mask;         // Capacity minus one; indices are free-running and wrapped with this mask.
+    Allocator*const     m_pAllocator;   // Allocator for the slot array.
+
+    uint8               m_padding0[PAL_CACHE_LINE_BYTES];
+    std::atomic<uint32> m_head;         // Index of the oldest element.  Written only by the consumer.
+    uint8               m_padding1[PAL_CACHE_LINE_BYTES];
+    std::atomic<uint32> m_tail;         // Index of the next slot to claim.  Advanced by producers.
+    uint8               m_padding2[PAL_CACHE_LINE_BYTES];
+
+    PAL_DISALLOW_DEFAULT_CTOR(MpscRingBuffer);
+    PAL_DISALLOW_COPY_AND_ASSIGN(MpscRingBuffer);
+};
+
+} // Util
@@ -0,0 +1,382 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2014-2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+/**
+ ***********************************************************************************************************************
+ * @file  palLockFreeRingBufferImpl.h
+ * @brief PAL utility collection SpscRingBuffer and MpscRingBuffer class implementations.
+ ***********************************************************************************************************************
+ */
+
+#pragma once
+
+#include "palLockFreeRingBuffer.h"
+#include "palInlineFuncs.h"
+#include "palSysMemory.h"
+#include <cstring>
+
+namespace Util
+{
+
+// =====================================================================================================================
+template <typename T, typename Allocator>
+SpscRingBuffer<T, Allocator>::SpscRingBuffer(
+    Allocator*const pAllocator)
+    :
+    m_pSlots(nullptr),
+    m_mask(0),
+    m_pAllocator(pAllocator),
+    m_head(0),
+    m_cachedTail(0),
+    m_tail(0),
+    m_cachedHead(0)
+{
+}
+
+// =====================================================================================================================
+template <typename T, typename Allocator>
+SpscRingBuffer<T, Allocator>::~SpscRingBuffer()
+{
+    PAL_SAFE_FREE(m_pSlots, m_pAllocator);
+}
+
+// =====================================================================================================================
+// Allocates the slot array, rounding the capacity up to a power of two so that indices can be wrapped with a mask.
+template <typename T, typename Allocator>
+Result SpscRingBuffer<T, Allocator>::Init(
+    uint32 minCapacity)
+{
+    PAL_ASSERT((m_pSlots == nullptr) && (minCapacity > 0) && (minCapacity <= (1u << 31)));
+
+    const uint32 capacity = Pow2Pad(minCapacity);
+
+    m_pSlots = static_cast<T*>(PAL_MALLOC(sizeof(T) * capacity, m_pAllocator, AllocInternal));
+    m_mask   = capacity - 1;
+
+    return (m_pSlots != nullptr) ? Result::Success : Result::ErrorOutOfMemory;
+}
+
+// =====================================================================================================================
+// Appends one element if there is room.  The consumer's index is only re-read when the cached copy says we're full.
+template <typename T, typename Allocator>
+bool SpscRingBuffer<T, Allocator>::Push(
+    const T& item)
+{
+    const uint32 tail = m_tail.load(std::memory_order_relaxed);
+
+    if ((tail - m_cachedHead) > m_mask)
+    {
+        m_cachedHead = m_head.load(std::memory_order_acquire);
+    }
+
+    const bool pushed = ((tail - m_cachedHead) <= m_mask);
+
+    if (pushed)
+    {
+        m_pSlots[tail & m_mask] = item;
+        m_tail.store(tail + 1, std::memory_order_release);
+    }
+
+    return pushed;
+}
+
+// =====================================================================================================================
+// Appends as many elements as fit with at most two copies, then publishes them with a single store.
+template <typename T, typename Allocator>
+uint32 SpscRingBuffer<T, Allocator>::PushBatch(
+    const T* pItems,
+    uint32   count)
+{
+    const uint32 tail = m_tail.load(std::memory_order_relaxed);
+
+    if ((Capacity() - (tail - m_cachedHead)) < count)
+    {
+        m_cachedHead = m_head.load(std::memory_order_acquire);
+    }
+
+    const uint32 numPushed = Min(count, Capacity() - (tail - m_cachedHead));
+
+    if (numPushed > 0)
+    {
+        const uint32 first     = tail & m_mask;
+        const uint32 numBefore = Min(numPushed, Capacity() - first);
+
+        memcpy(&m_pSlots[first], pItems, sizeof(T) * numBefore);
+        memcpy(&m_pSlots[0], pItems + numBefore, sizeof(T) * (numPushed - numBefore));
+
+        m_tail.store(tail + numPushed, std::memory_order_release);
+    }
+
+    return numPushed;
+}
+
+// =====================================================================================================================
+// Removes the oldest element if there is one.  The producer's index is only re-read when the cached copy says we're
+// empty.
+template <typename T, typename Allocator>
+bool SpscRingBuffer<T, Allocator>::Pop(
+    T* pItem)
+{
+    const uint32 head = m_head.load(std::memory_order_relaxed);
+
+    if (head == m_cachedTail)
+    {
+        m_cachedTail = m_tail.load(std::memory_order_acquire);
+    }
+
+    const bool popped = (head != m_cachedTail);
+
+    if (popped)
+    {
+        *pItem = m_pSlots[head & m_mask];
+        m_head.store(head + 1, std::memory_order_release);
+    }
+
+    return popped;
+}
+
+// =====================================================================================================================
+// Removes up to maxCount elements with at most two copies, then releases their slots with a single store.
+template <typename T, typename Allocator>
+uint32 SpscRingBuffer<T, Allocator>::PopBatch(
+    T*     pItems,
+    uint32 maxCount)
+{
+    const uint32 head = m_head.load(std::memory_order_relaxed);
+
+    if ((m_cachedTail - head) < maxCount)
+    {
+        m_cachedTail = m_tail.load(std::memory_order_acquire);
+    }
+
+    const uint32 numPopped = Min(maxCount, m_cachedTail - head);
+
+    if (numPopped > 0)
+    {
+        const uint32 first     = head & m_mask;
+        const uint32 numBefore = Min(numPopped, Capacity() - first);
+
+        memcpy(pItems, &m_pSlots[first], sizeof(T) * numBefore);
+        memcpy(pItems + numBefore, &m_pSlots[0], sizeof(T) * (numPopped - numBefore));
+
+        m_head.store(head + numPopped, std::memory_order_release);
+    }
+
+    return numPopped;
+}
+
+// =====================================================================================================================
+template <typename T, typename Allocator>
+bool SpscRingBuffer<T, Allocator>::IsEmpty() const
+{
+    return (m_head.load(std::memory_order_relaxed) == m_tail.load(std::memory_order_acquire));
+}
+
+// =====================================================================================================================
+template <typename T, typename Allocator>
+MpscRingBuffer<T, Allocator>::MpscRingBuffer(
+    Allocator*const pAllocator)
+    :
+    m_pSlots(nullptr),
+    m_mask(0),
+    m_pAllocator(pAllocator),
+    m_head(0),
+    m_tail(0)
+{
+}
+
+// =====================================================================================================================
+template <typename T, typename Allocator>
+MpscRingBuffer<T, Allocator>::~MpscRingBuffer()
+{
+    PAL_SAFE_FREE(m_pSlots, m_pAllocator);
+}
+
+// =====================================================================================================================
+// Allocates the slot array, rounding the capacity up to a power of two so that indices can be wrapped with a mask.
+// Each slot starts out free for the first pass over the ring.  With a single slot, "published for this pass" and "free
+// for the next pass" would be the same sequence number, so at least two slots are always allocated.
+template <typename T, typename Allocator>
+Result MpscRingBuffer<T, Allocator>::Init(
+    uint32 minCapacity)
+{
+    PAL_ASSERT((m_pSlots == nullptr) && (minCapacity > 0) && (minCapacity <= (1u << 31)));
+
+    const uint32 capacity = Pow2Pad(Max(minCapacity, 2u));
+    Result       result   = Result::ErrorOutOfMemory;
+
+    m_pSlots = static_cast<Slot*>(PAL_MALLOC(sizeof(Slot) * capacity, m_pAllocator, AllocInternal));
+
+    if (m_pSlots != nullptr)
+    {
+        for (uint32 idx = 0; idx < capacity; ++idx)
+        {
+            PAL_PLACEMENT_NEW(&m_pSlots[idx].sequence) std::atomic<uint32>(idx);
+        }
+
+        m_mask = capacity - 1;
+        result = Result::Success;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Claims the slot at the tail if it is free, then fills and publishes it.  A slot whose sequence is behind the tail
+// still holds an element from the previous pass, so the ring is full; one whose sequence is ahead has already been
+// claimed by another producer, so we retry from the new tail.
+template <typename T, typename Allocator>
+bool MpscRingBuffer<T, Allocator>::Push(
+    const T& item)
+{
+    uint32 pos   = m_tail.load(std::memory_order_relaxed);
+    Slot*  pSlot = nullptr;
+    bool   full  = false;
+
+    while ((pSlot == nullptr) && (full == false))
+    {
+        Slot*const  pCandidate = &m_pSlots[pos & m_mask];
+        const int32 diff       = static_cast<int32>(pCandidate->sequence.load(std::memory_order_acquire) - pos);
+
+        if (diff == 0)
+        {
+            if (m_tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                pSlot = pCandidate;
+            }
+        }
+        else if (diff < 0)
+        {
+            full = true;
+        }
+        else
+        {
+            pos = m_tail.load(std::memory_order_relaxed);
+        }
+    }
+
+    if (pSlot != nullptr)
+    {
+        pSlot->item = item;
+        pSlot->sequence.store(pos + 1, std::memory_order_release);
+    }
+
+    return (pSlot != nullptr);
+}
+
+// =====================================================================================================================
+// Claims as many consecutive slots as fit with one compare-and-swap, then fills and publishes them in order.  Free
+// space is measured against the consumer's index: every slot before it has been released, so every slot less than one
+// capacity ahead of it is free once claimed.
+template <typename T, typename Allocator>
+uint32 MpscRingBuffer<T, Allocator>::PushBatch(
+    const T* pItems,
+    uint32   count)
+{
+    uint32 pos       = m_tail.load(std::memory_order_relaxed);
+    uint32 numPushed = 0;
+    bool   claimed   = (count == 0);
+
+    while (claimed == false)
+    {
+        const uint32 used = pos - m_head.load(std::memory_order_acquire);
+
+        if (used > Capacity())
+        {
+            // Our tail is so stale that the consumer has passed it.
+            pos = m_tail.load(std::memory_order_relaxed);
+        }
+        else
+        {
+            numPushed = Min(count, Capacity() - used);
+            claimed   = (numPushed == 0) ||
+                        m_tail.compare_exchange_weak(pos, pos + numPushed, std::memory_order_relaxed);
+        }
+    }
+
+    for (uint32 idx = 0; idx < numPushed; ++idx)
+    {
+        Slot*const pSlot = &m_pSlots[(pos + idx) & m_mask];
+
+        pSlot->item = pItems[idx];
+        pSlot->sequence.store(pos + idx + 1, std::memory_order_release);
+    }
+
+    return numPushed;
+}
+
+// =====================================================================================================================
+// Removes the oldest element if its producer has published it, and frees its slot for the next pass over the ring.
+template <typename T, typename Allocator>
+bool MpscRingBuffer<T, Allocator>::Pop(
+    T* pItem)
+{
+    return (PopBatch(pItem, 1) == 1);
+}
+
+// =====================================================================================================================
+// Removes consecutive published elements, stopping at the first slot which is still empty or still being filled.  The
+// consumer index is advanced once for the whole batch.
+template <typename T, typename Allocator>
+uint32 MpscRingBuffer<T, Allocator>::PopBatch(
+    T*     pItems,
+    uint32 maxCount)
+{
+    const uint32 head      = m_head.load(std::memory_order_relaxed);
+    uint32       numPopped = 0;
+    bool         published = true;
+
+    while ((numPopped < maxCount) && published)
+    {
+        const uint32 pos   = head + numPopped;
+        Slot*const   pSlot = &m_pSlots[pos & m_mask];
+
+        published = (pSlot->sequence.load(std::memory_order_acquire) == (pos + 1));
+
+        if (published)
+        {
+            pItems[numPopped] = pSlot->item;
+            pSlot->sequence.store(pos + Capacity(), std::memory_order_release);
+            ++numPopped;
+        }
+    }
+
+    if (numPopped > 0)
+    {
+        m_head.store(head + numPopped, std::memory_order_release);
+    }
+
+    return numPopped;
+}
+
+// =====================================================================================================================
+template <typename T, typename Allocator>
+bool MpscRingBuffer<T, Allocator>::IsEmpty() const
+{
+    const uint32 head = m_head.load(std::memory_order_relaxed);
+
+    return (m_pSlots[head & m_mask].sequence.load(std::memory_order_acquire) != (head + 1));
+}
+
+} // Util
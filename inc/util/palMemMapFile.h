@@ -145,6 +145,18 @@ public:
     /// @return Size of the storage container, or -1 if the container is invalid.
     size_t GetStorageSize() const { return GetStorageCapacity() - GetHeaderSize(); }
 
+    /// Returns the amount of storage which has been used so far (not counting the storage header). New storage space
+    /// is handed out starting at this offset.
+    ///
+    /// @return Number of bytes of used storage.
+    size_t GetUsedStorageSize() const { return LocalToExternalOffset(GetStorageEnd()); }
+
+    /// Checks whether the file this container was opened from has since been deleted, or replaced by another file
+    /// renamed over it.  The container keeps mapping the original file in either case.
+    ///
+    /// @return True if the file was replaced or the container isn't open.
+    bool IsFileReplaced() const { return m_memoryMapping.IsFileReplaced(); }
+
 private:
 
     /// Opens the memory mapping handle.
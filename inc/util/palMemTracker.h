@@ -56,12 +56,11 @@ enum class MemBlkType : uint32
 
 /// @internal
 ///
-/// Internal structure used by MemTracker to store information on each allocation.  These elements form a singly linked
-/// list.
+/// Internal structure used by MemTracker to store information on each allocation.  The elements of each hash bucket
+/// form a singly linked list.
 struct MemTrackerElem
 {
-    MemTrackerElem* pNext;       ///< Pointer to next element in the linked list.
-    MemTrackerElem* pNextNext;   ///< Pointer to next element's next element; detects if the next tracker is corrupted.
+    MemTrackerElem* pNext;       ///< Pointer to next element in the same hash bucket.
     size_t          size;        ///< Size of allocation request.
     MemBlkType      blockType;   ///< Memory block type (malloc, new, new array).
     const char*     pFilename;   ///< File that requested allocation.
@@ -132,12 +131,32 @@ private:
     // Size of underrun/overrun markers in bytes.
     static constexpr size_t MarkerSizeBytes = MarkerSizeUints * sizeof(uint32);
 
-    // Create a statically allocated dummy head element in the list. Then the list insertion and deletion functions
-    // don't have to check if the head is being changed.
-    MemTrackerElem     m_memListHead;      // Dummy head for link list of allocations.
-    MemTrackerElem*    m_pMemListHead;     // Linked-list of allocations.
+    // Allocations are spread across shards by address so that threads allocating and freeing unrelated blocks rarely
+    // contend on the same lock.  Each shard indexes its blocks in a hash table which doubles whenever it fills up, so
+    // looking up a block on free takes constant time no matter how many blocks are live.
+    static constexpr uint32 NumShardsLog2 = 5;
+    static constexpr uint32 NumShards     = (1u << NumShardsLog2);
 
-    Mutex              m_mutex;            // Serializes access to list of active allocations.
+    // Number of hash buckets a shard starts out with.
+    static constexpr uint32 MinBuckets = 64;
+
+    struct Shard
+    {
+        Mutex            mutex;       // Serializes access to this shard's hash table.
+        MemTrackerElem** ppBuckets;   // Heads of the hash buckets, or null before the first allocation.
+        uint32           numBuckets;  // Number of hash buckets, zero or a power of two.
+        uint32           numElems;    // Number of blocks tracked by this shard.
+    };
+
+    static uint64 HashPointer(const void* pClientMem);
+    static uint32 BucketIndex(uint64 hash, uint32 numBuckets)
+        { return static_cast<uint32>(hash >> 32) & (numBuckets - 1); }
+    static void   GrowShard(Shard* pShard);
+
+    Shard& ShardOf(uint64 hash) { return m_shards[hash >> (64 - NumShardsLog2)]; }
+    bool   HasLeaks() const;
+
+    Shard              m_shards[NumShards];
 
     const size_t       m_markerSizeUints;  // Member variable copy of MarkerSizeUints.  Only used to prevent compiler
                                            //  warnings when MarkerSizeUints is 0.
@@ -146,7 +165,7 @@ private:
 
     Allocator*const    m_pAllocator;       // Allocator for performing the actual allocations.
 
-    size_t             m_nextAllocNum;     // The allocation number that the next allocated block will receive.
+    volatile uint64    m_lastAllocNum;     // The allocation number that the last allocated block received.
     const size_t       m_breakOnAllocNum;  // The allocation number to trigger a debug break on.
 
     PAL_DISALLOW_COPY_AND_ASSIGN(MemTracker);
@@ -54,14 +54,18 @@ template <typename Allocator>
 MemTracker<Allocator>::MemTracker(
     Allocator*const pAllocator)
     :
-    m_pMemListHead(&m_memListHead),
     m_markerSizeUints(MarkerSizeUints),
     m_markerSizeBytes(MarkerSizeBytes),
     m_pAllocator(pAllocator),
-    m_nextAllocNum(1),
+    m_lastAllocNum(0),
     m_breakOnAllocNum(0)
 {
-    memset(&m_memListHead, 0, sizeof(MemTrackerElem));
+    for (uint32 idx = 0; idx < NumShards; ++idx)
+    {
+        m_shards[idx].ppBuckets  = nullptr;
+        m_shards[idx].numBuckets = 0;
+        m_shards[idx].numElems   = 0;
+    }
 }
 
 // =====================================================================================================================
@@ -69,16 +73,21 @@ template <typename Allocator>
 MemTracker<Allocator>::~MemTracker()
 {
     // Clean-up leaked memory if needed
-    if (m_pMemListHead->pNext != nullptr)
+    if (HasLeaks())
     {
-        // If the dummy head has a valid next pointer, we have a leak.  The leak could either be caused by an
-        // internal PAL leak, a client leak, or even the application not destroying API objects.
+        // If any block is still being tracked, we have a leak.  The leak could either be caused by an internal PAL
+        // leak, a client leak, or even the application not destroying API objects.
         PAL_ALERT_ALWAYS();
 
         // Dump out a list of unfreed blocks.
         MemoryReport();
 
     }
+
+    for (uint32 idx = 0; idx < NumShards; ++idx)
+    {
+        free(m_shards[idx].ppBuckets);
+    }
 }
 
 // =====================================================================================================================
@@ -86,11 +95,83 @@ MemTracker<Allocator>::~MemTracker()
 template <typename Allocator>
 Result MemTracker<Allocator>::Init()
 {
-    return m_mutex.Init();
+    Result result = Result::_Success;
+
+    for (uint32 idx = 0; (idx < NumShards) && (result == Result::_Success); ++idx)
+    {
+        result = m_shards[idx].mutex.Init();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Hashes the client address of a block.  The top bits select the shard and the bits below them select the hash bucket.
+template <typename Allocator>
+uint64 MemTracker<Allocator>::HashPointer(
+    const void* pClientMem)
+{
+    // Client addresses are at least 4-byte aligned, so the lowest bits carry no information.  Fibonacci hashing spreads
+    // the rest across the high bits.
+    return (static_cast<uint64>(reinterpret_cast<size_t>(pClientMem)) >> 4) * 0x9E3779B97F4A7C15ull;
+}
+
+// =====================================================================================================================
+// Doubles the number of hash buckets in a shard and redistributes its elements.  If the new buckets can't be
+// allocated the shard keeps its current buckets, which only makes its chains longer.  Must be called with the shard's
+// mutex held.
+template <typename Allocator>
+void MemTracker<Allocator>::GrowShard(
+    Shard* pShard)
+{
+    const uint32 newNumBuckets = Max(MinBuckets, pShard->numBuckets * 2);
+
+    // The buckets are allocated directly from the system, like the elements themselves, since the tracked allocator
+    // must not be re-entered.
+    MemTrackerElem**const ppNewBuckets =
+        static_cast<MemTrackerElem**>(calloc(newNumBuckets, sizeof(MemTrackerElem*)));
+
+    if (ppNewBuckets != nullptr)
+    {
+        for (uint32 bucket = 0; bucket < pShard->numBuckets; ++bucket)
+        {
+            MemTrackerElem* pCurrent = pShard->ppBuckets[bucket];
+
+            while (pCurrent != nullptr)
+            {
+                MemTrackerElem*const pNext     = pCurrent->pNext;
+                const uint32         newBucket = BucketIndex(HashPointer(pCurrent->pClientMem), newNumBuckets);
+
+                pCurrent->pNext         = ppNewBuckets[newBucket];
+                ppNewBuckets[newBucket] = pCurrent;
+                pCurrent                = pNext;
+            }
+        }
+
+        free(pShard->ppBuckets);
+
+        pShard->ppBuckets  = ppNewBuckets;
+        pShard->numBuckets = newNumBuckets;
+    }
 }
 
 // =====================================================================================================================
-// Adds the newly allocated memory block to the list of blocks for tracking.
+// Returns true if any block is still being tracked.
+template <typename Allocator>
+bool MemTracker<Allocator>::HasLeaks() const
+{
+    bool hasLeaks = false;
+
+    for (uint32 idx = 0; idx < NumShards; ++idx)
+    {
+        hasLeaks |= (m_shards[idx].numElems != 0);
+    }
+
+    return hasLeaks;
+}
+
+// =====================================================================================================================
+// Adds the newly allocated memory block to the set of blocks for tracking.
 //
 // The tracking information includes things like filename, line numbers, and type of block.  Also, given a pointer,
 // adds the Underrun/Overrun markers to the memory allocated, and return a pointer to the actual client usable memory.
@@ -128,33 +209,44 @@ void* MemTracker<Allocator>::AddMemElement(
         pNewElement->blockType  = blockType;
         pNewElement->pClientMem = pClientMem;
         pNewElement->pOrigMem   = pMem;
-
-        MutexAuto lock(&m_mutex);
+        pNewElement->allocNum   = static_cast<size_t>(AtomicAdd64(&m_lastAllocNum, 1));
 
         // Trigger an assert if we're about to allocate the break-on-allocation number.
-        if (m_nextAllocNum == m_breakOnAllocNum)
+        if (pNewElement->allocNum == m_breakOnAllocNum)
         {
             PAL_ASSERT_ALWAYS();
         }
 
-        pNewElement->allocNum = m_nextAllocNum;
-        ++m_nextAllocNum;
+        const uint64 hash   = HashPointer(pClientMem);
+        Shard*const  pShard = &ShardOf(hash);
+
+        MutexAuto lock(&pShard->mutex);
 
-        pNewElement->pNext     = m_pMemListHead->pNext;
-        pNewElement->pNextNext = m_pMemListHead->pNextNext;
+        if (pShard->numElems >= pShard->numBuckets)
+        {
+            GrowShard(pShard);
+        }
 
-        m_pMemListHead->pNextNext = m_pMemListHead->pNext;
-        m_pMemListHead->pNext     = pNewElement;
+        if (pShard->numBuckets != 0)
+        {
+            MemTrackerElem**const ppBucket = &pShard->ppBuckets[BucketIndex(hash, pShard->numBuckets)];
 
-        // Sanity check to make sure we've updated both pointers properly.
-        PAL_ASSERT(m_pMemListHead->pNextNext != m_pMemListHead->pNext);
+            pNewElement->pNext = *ppBucket;
+            *ppBucket          = pNewElement;
+            pShard->numElems++;
+        }
+        else
+        {
+            // Without any buckets this block can't be tracked, just as if the element couldn't be allocated.
+            free(pNewElement);
+        }
     }
 
     return pClientMem;
 }
 
 // =====================================================================================================================
-// Removes an allocated block from the list of blocks used for tracking.
+// Removes an allocated block from the set of blocks used for tracking.
 //
 // The routine checks for invalid frees (and duplicate frees). Also, the routine is able to detect mismatched alloc/free
 // usage based on the blockType.  The routine is called with the pointer to the client usable memory and returns the
@@ -166,30 +258,31 @@ void* MemTracker<Allocator>::RemoveMemElement(
     void*       pClientMem,  // Pointer to client usable memory.
     MemBlkType  blockType)   // Block type based on calling deallocation routine.
 {
-    bool  badFree  = false;
-    void* pOrigPtr = nullptr;
+    bool            badFree  = false;
+    void*           pOrigPtr = nullptr;
+    MemTrackerElem* pCurrent = nullptr;
 
-    m_mutex.Lock();
+    const uint64 hash   = HashPointer(pClientMem);
+    Shard*const  pShard = &ShardOf(hash);
 
-    MemTrackerElem* pCurrent  = m_pMemListHead->pNext;
-    MemTrackerElem* pCurNext  = m_pMemListHead->pNextNext;
-    MemTrackerElem* pPrevious = m_pMemListHead;
-    MemTrackerElem* pPrevPrev = nullptr;
+    pShard->mutex.Lock();
 
-    while ((pCurrent != nullptr) && (pCurrent->pClientMem != pClientMem))
+    MemTrackerElem** ppLink = nullptr;
+
+    if (pShard->numBuckets != 0)
     {
-        // We will hit this assert if someone has corrupted the current tracker's pNext.
-        // That probably means that someone is writing into random heap memory they don't own.
-        PAL_ASSERT(pCurNext == pCurrent->pNext);
-
-        pPrevPrev = pPrevious;
-        pPrevious = pCurrent;
-        pCurNext  = pCurrent->pNextNext;
-        pCurrent  = pCurrent->pNext;
+        ppLink   = &pShard->ppBuckets[BucketIndex(hash, pShard->numBuckets)];
+        pCurrent = *ppLink;
+
+        while ((pCurrent != nullptr) && (pCurrent->pClientMem != pClientMem))
+        {
+            ppLink   = &pCurrent->pNext;
+            pCurrent = pCurrent->pNext;
+        }
     }
 
     // We should not be trying to free something twice or trying to free something which has not been allocated.  The
-    // assert will catch the invalid free. Current equals previous only for empty lists.
+    // assert will catch the invalid free.
 
     if (pCurrent == nullptr)
     {
@@ -208,28 +301,17 @@ void* MemTracker<Allocator>::RemoveMemElement(
     }
     else
     {
-        // Update the linked list to no longer contain the element we are removing.
-        if (pPrevPrev != nullptr)
-        {
-            pPrevPrev->pNextNext = pCurrent->pNext;
-
-            // Sanity check to make sure we've updated both pointers properly.
-            PAL_ASSERT((pPrevPrev->pNextNext == nullptr) || (pPrevPrev->pNextNext != pPrevPrev->pNext));
-        }
-
-        pPrevious->pNextNext = pCurrent->pNextNext;
-        pPrevious->pNext     = pCurrent->pNext;
-        pOrigPtr             = pCurrent->pOrigMem;
-
-        // Sanity check to make sure we've updated both pointers properly.
-        PAL_ASSERT((pPrevious->pNextNext == nullptr) || (pPrevious->pNextNext != pPrevious->pNext));
+        // Update the bucket to no longer contain the element we are removing.
+        *ppLink  = pCurrent->pNext;
+        pOrigPtr = pCurrent->pOrigMem;
+        pShard->numElems--;
     }
 
-    m_mutex.Unlock();
+    pShard->mutex.Unlock();
 
     if (badFree == false)
     {
-        // We can check for memory corruption at top and bottom since the element was found in our free list.
+        // We can check for memory corruption at top and bottom since the element was found in our hash table.
 
         uint32* pUnderrun = static_cast<uint32*>(Util::VoidPtrDec(pClientMem, m_markerSizeBytes));
         uint32* pOverrun  = static_cast<uint32*>
@@ -318,35 +400,51 @@ void MemTracker<Allocator>::Free(
 template <typename Allocator>
 void MemTracker<Allocator>::FreeLeakedMemory()
 {
-    const MemTrackerElem* pCurrent = m_pMemListHead->pNext;
-
-    while (pCurrent != nullptr)
+    for (uint32 idx = 0; idx < NumShards; ++idx)
     {
-        // Free will release the memory for tracking and the actual element.
-        Free(FreeInfo(pCurrent->pClientMem, pCurrent->blockType));
-        pCurrent = m_pMemListHead->pNext;
+        const Shard& shard = m_shards[idx];
+
+        for (uint32 bucket = 0; bucket < shard.numBuckets; ++bucket)
+        {
+            const MemTrackerElem* pCurrent = shard.ppBuckets[bucket];
+
+            while (pCurrent != nullptr)
+            {
+                // Free will release the memory for tracking and the actual element.
+                Free(FreeInfo(pCurrent->pClientMem, pCurrent->blockType));
+                pCurrent = shard.ppBuckets[bucket];
+            }
+        }
     }
 }
 
 // =====================================================================================================================
-// Outputs information about leaked memory by traversing the memory tracker list.
+// Outputs information about leaked memory by traversing the memory tracker's hash tables.
 template <typename Allocator>
 void MemTracker<Allocator>::MemoryReport()
 {
-    const MemTrackerElem* pCurrent = m_pMemListHead;
-
     PAL_DPWARN("================ List of Leaked Blocks ================");
 
-    while (pCurrent->pNext != nullptr)
+    for (uint32 idx = 0; idx < NumShards; ++idx)
     {
-        pCurrent = pCurrent->pNext;
-        PAL_DPWARN("ClientMem = 0x%p, AllocSize = %8d, MemBlkType = %s, File = %-15s, LineNumber = %8d, AllocNum = %8d",
-                   pCurrent->pClientMem,
-                   pCurrent->size,
-                   MemBlkTypeStr[static_cast<uint32>(pCurrent->blockType)],
-                   pCurrent->pFilename,
-                   pCurrent->lineNumber,
-                   pCurrent->allocNum);
+        const Shard& shard = m_shards[idx];
+
+        for (uint32 bucket = 0; bucket < shard.numBuckets; ++bucket)
+        {
+            for (const MemTrackerElem* pCurrent = shard.ppBuckets[bucket];
+                 pCurrent != nullptr;
+                 pCurrent = pCurrent->pNext)
+            {
+                PAL_DPWARN("ClientMem = 0x%p, AllocSize = %8d, MemBlkType = %s, File = %-15s, LineNumber = %8d, "
+                           "AllocNum = %8d",
+                           pCurrent->pClientMem,
+                           pCurrent->size,
+                           MemBlkTypeStr[static_cast<uint32>(pCurrent->blockType)],
+                           pCurrent->pFilename,
+                           pCurrent->lineNumber,
+                           pCurrent->allocNum);
+            }
+        }
     }
 
     PAL_DPWARN("================ End of List ===========================");
@@ -47,10 +47,7 @@ namespace Util
 class Mutex
 {
 public:
-    /// Defines MutexData as a unix pthread_mutex_t
-    typedef pthread_mutex_t  MutexData;
-
-    Mutex() : m_initialized(false) { memset(&m_osMutex, 0, sizeof(m_osMutex)); }
+    Mutex() : m_lockWord(0), m_spinEstimate(0) { }
     ~Mutex();
 
     /// Initializes the mutex object.
@@ -71,12 +68,15 @@ public:
     /// Leaves the critical section.
     void Unlock();
 
-    /// Returns the OS specific mutex data.
-    MutexData* GetMutexData() { return &m_osMutex; }
-
 private:
-    MutexData m_osMutex;     ///< Opaque structure to the OS-specific Mutex data
-    bool      m_initialized; ///< True indicates this mutex has been initialized
+    // The condition variable must re-acquire the mutex in the contended state after it sleeps.
+    friend class ConditionVariable;
+
+    void LockSlow(const void* pSite);
+    void LockContended();
+
+    volatile uint32 m_lockWord;     ///< Futex word: unlocked, locked or locked with possible sleepers
+    volatile uint32 m_spinEstimate; ///< Running average of how long a contended Lock() spun before acquiring
 
     PAL_DISALLOW_COPY_AND_ASSIGN(Mutex);
 };
@@ -139,7 +139,15 @@ public:
         ReadWrite      ///< Lock in readwrite mode, in other words exclusive mode.
     };
 
-    RWLock() : m_initialized(false) { memset(&m_osRWLock, 0, sizeof(m_osRWLock)); }
+    RWLock()
+        :
+        m_state(0),
+        m_readersWaiting(0),
+        m_writersWaiting(0),
+        m_readerWakeSequence(0),
+        m_writerWakeSequence(0),
+        m_spinEstimate(0)
+    { }
     ~RWLock();
 
     /// Initializes the rwlock object.
@@ -171,11 +179,15 @@ public:
     void UnlockForWrite();
 
 private:
-    /// Defines RWLockData as a unix pthread_rwlock_t
-    typedef pthread_rwlock_t  RWLockData;
+    void LockSlow(bool exclusive, const void* pSite);
+    void WakeSleepers(bool wakeReaders);
 
-    RWLockData m_osRWLock;    ///< Opaque structure to the OS-specific RWLock data
-    bool       m_initialized; ///< True indicates this RWLock has been initialized
+    volatile uint32 m_state;              ///< Number of readers holding the lock, or the top bit if a writer holds it
+    volatile uint32 m_readersWaiting;     ///< Nonzero if readers may be asleep on m_readerWakeSequence
+    volatile uint32 m_writersWaiting;     ///< Nonzero if writers may be asleep on m_writerWakeSequence
+    volatile uint32 m_readerWakeSequence; ///< Futex word bumped each time the lock is released to sleeping readers
+    volatile uint32 m_writerWakeSequence; ///< Futex word bumped each time the lock is released to sleeping writers
+    volatile uint32 m_spinEstimate;       ///< Running average of how long contended lock requests spun
 
     PAL_DISALLOW_COPY_AND_ASSIGN(RWLock);
 };
@@ -266,6 +278,17 @@ extern uint32 AtomicDecrement(volatile uint32* pValue);
 /// @returns Previous value at *pTarget.
 extern uint32 AtomicCompareAndSwap(volatile uint32* pTarget, uint32 oldValue, uint32 newValue);
 
+/// Performs an atomic compare and swap operation on two 64-bit unsigned integers. This operation compares *pTarget
+/// with oldValue and replaces it with newValue if they match. If the values don't match, no action is taken.
+/// The original value of *pTarget is returned as a result.
+///
+/// @param [in,out] pTarget  Pointer to the destination value of the operation.
+/// @param [in]     oldValue Literal value to compare *pTarget to.
+/// @param [in]     newValue Literal value to replace *pTarget with if *pTarget matches oldValue.
+///
+/// @returns Previous value at *pTarget.
+extern uint64 AtomicCompareAndSwap64(volatile uint64* pTarget, uint64 oldValue, uint64 newValue);
+
 /// Atomically exchanges a pair of 32-bit unsigned integers.
 ///
 /// @param [in,out] pTarget Pointer to the destination value of the operation.
@@ -307,4 +330,26 @@ extern uint32 AtomicAdd(volatile uint32* pAddend, uint32 value);
 /// @returns Result of the add operation.
 extern uint64 AtomicAdd64(volatile uint64* pAddend, uint64 value);
 
+#if PAL_LOCK_CONTENTION_STATS
+/// Contention statistics gathered for one call site of Mutex::Lock(), RWLock::LockForRead() or RWLock::LockForWrite().
+struct LockSiteStats
+{
+    const void* pSite;       ///< Return address of the contended lock call.
+    uint64      contentions; ///< Number of acquisitions which found the lock already held.
+    uint64      sleeps;      ///< Number of those acquisitions which had to sleep in the kernel.
+    uint64      waitTicks;   ///< Total time spent waiting for the lock, in GetPerfCpuTime() ticks.
+};
+
+/// Retrieves the lock call sites which have spent the most time waiting on contended locks, hottest first.
+///
+/// @param [out] pStats   Array of at least maxSites entries to fill.
+/// @param [in]  maxSites Maximum number of call sites to report.
+///
+/// @returns The number of entries written to pStats.
+extern uint32 GetLockContentionStats(LockSiteStats* pStats, uint32 maxSites);
+
+/// Prints the hottest lock call sites through the debug print info channel.
+extern void ReportLockContention();
+#endif
+
 } // Util
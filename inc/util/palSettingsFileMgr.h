@@ -32,6 +32,7 @@
 #pragma once
 
 #include "palFile.h"
+#include "palHashMap.h"
 #include "palInlineFuncs.h"
 #include "palList.h"
 
@@ -50,7 +51,8 @@ namespace Util
  *        ; The following settings are pre-hashed.
  *        #0x9370a0c8, AnotherStringValue
  *
- *        After loading the file, a value can be retrieved by either specifying a setting string or hash value.
+ *        After loading the file, a value can be retrieved by either specifying a setting string or hash value.  The
+ *        parsed values are indexed by the setting hash so each lookup is a constant-time probe.
  ***********************************************************************************************************************
  */
 template <typename Allocator>
@@ -64,14 +66,16 @@ public:
     SettingsFileMgr(const char* pSettingsFileName, Allocator*const pAllocator)
         :
         m_pSettingsFileName(pSettingsFileName),
-        m_settingsList(pAllocator)
+        m_settingsList(pAllocator),
+        m_settingsMap(NumBuckets, pAllocator)
     {
     }
 
     /// Destroys the object and closes the associated file if it is still open.
     ~SettingsFileMgr();
 
-    /// Initializes the settings file manager.  Must be called before calling any other functions on this object.
+    /// Initializes the settings file manager.  Must be called before calling any other functions on this object.  May
+    /// be called again with a different path only if the previous call returned ErrorUnavailable.
     ///
     /// @param [in] pSettingsPath The path to to the settings file.
     ///
@@ -107,7 +111,15 @@ public:
     ///          type; false otherwise.
     bool GetValueByHash(uint32 hashedName, ValueType type, void* pValue, size_t bufferSz = 0) const;
 
+    /// Returns the number of settings that were parsed from the settings file.
+    ///
+    /// @returns Number of unique settings loaded by Init(); zero if no settings file was found.
+    uint32 NumSettings() const { return m_settingsMap.GetNumEntries(); }
+
 private:
+    // Settings files rarely contain more than a handful of entries.
+    static constexpr uint32 NumBuckets = 64;
+
     // Describes a single { setting, value } pair as loaded from a settings file.
     struct SettingValuePair
     {
@@ -121,6 +133,9 @@ private:
     // List of setting, value pairs parsed from the config file.
     List<SettingValuePair, Allocator> m_settingsList;
 
+    // Maps each setting hash to its value string in m_settingsList.
+    HashMap<uint32, const char*, Allocator> m_settingsMap;
+
     PAL_DISALLOW_COPY_AND_ASSIGN(SettingsFileMgr);
 };
 
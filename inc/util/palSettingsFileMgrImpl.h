@@ -27,6 +27,7 @@
 
 #include "palSettingsFileMgr.h"
 #include "palDbgPrint.h"
+#include "palHashMapImpl.h"
 #include "palListImpl.h"
 #include <string.h>
 #include <ctype.h>
@@ -66,6 +67,13 @@ Result SettingsFileMgr<Allocator>::Init(
     {
         // Open the config file for read-only access
         ret = m_settingsFile.Open(&fileName[0], FileAccessRead);
+
+        if (ret == Result::Success)
+        {
+            // Callers may call Init again with another path if this one fails, so only allocate the index once the file
+            // is open.
+            ret = m_settingsMap.Init();
+        }
     }
 
     if (ret == Result::Success)
@@ -119,10 +127,27 @@ Result SettingsFileMgr<Allocator>::Init(
                         hashedName = HashString(pToken, strlen(pToken));
                     }
                     pToken = Strtok(nullptr, ", ", &pBuffer);
-                    SettingValuePair pair = { hashedName, {0}};
-                    PAL_ASSERT(strlen(pToken) < sizeof(pair.strValue));
-                    strncpy(&pair.strValue[0], pToken, sizeof(pair.strValue));
-                    m_settingsList.PushBack(pair);
+
+                    // The first occurrence of a setting wins, matching the original front-to-back list search.
+                    bool         existed = false;
+                    const char** ppValue = nullptr;
+                    if ((m_settingsMap.FindAllocate(hashedName, &existed, &ppValue) == Result::Success) &&
+                        (existed == false))
+                    {
+                        SettingValuePair pair = { hashedName, {0}};
+                        PAL_ASSERT(strlen(pToken) < sizeof(pair.strValue));
+                        strncpy(&pair.strValue[0], pToken, sizeof(pair.strValue));
+
+                        if (m_settingsList.PushFront(pair) == Result::Success)
+                        {
+                            // List nodes never move, so the index can point straight at the stored string.
+                            (*ppValue) = &m_settingsList.Begin().Get()->strValue[0];
+                        }
+                        else
+                        {
+                            m_settingsMap.Erase(hashedName);
+                        }
+                    }
                 }
             }
         }
@@ -142,20 +167,28 @@ bool SettingsFileMgr<Allocator>::GetValue(
     size_t      bufferSz
     ) const
 {
-    // If the first character of the string is a # that indicates that the name strings is the
-    // already hashed setting name in string form. In that case just convert to UINT32
-    uint32 hashedName = 0;
-    if (pValueName[0] == '#')
-    {
-        StringToValueType(&pValueName[1], ValueType::Uint, sizeof(uint32), &hashedName);
-    }
-    else
+    bool foundValue = false;
+
+    // Most installs have no settings file at all; skip hashing the name when there's nothing to find.
+    if (NumSettings() > 0)
     {
-        // Otherwise, calculate the hashed value for the setting name
-        hashedName = HashString(pValueName, strlen(pValueName));
+        // If the first character of the string is a # that indicates that the name strings is the
+        // already hashed setting name in string form. In that case just convert to UINT32
+        uint32 hashedName = 0;
+        if (pValueName[0] == '#')
+        {
+            StringToValueType(&pValueName[1], ValueType::Uint, sizeof(uint32), &hashedName);
+        }
+        else
+        {
+            // Otherwise, calculate the hashed value for the setting name
+            hashedName = HashString(pValueName, strlen(pValueName));
+        }
+
+        foundValue = GetValueByHash(hashedName, type, pValue, bufferSz);
     }
 
-    return GetValueByHash(hashedName, type, pValue, bufferSz);
+    return foundValue;
 }
 
 // =====================================================================================================================
@@ -170,18 +203,9 @@ bool SettingsFileMgr<Allocator>::GetValueByHash(
 {
     bool foundValue = false;
 
-    // Get the value from the list
-    auto iterator = m_settingsList.Begin();
-    const char* pSettingValue = nullptr;
-    while(iterator.Get() != nullptr)
-    {
-        if (iterator.Get()->hashName == hashedName)
-        {
-            pSettingValue = &iterator.Get()->strValue[0];
-            break;
-        }
-        iterator.Next();
-    }
+    // Look the value up in the index; it is never initialized if no settings file was found.
+    const char*const* ppSettingValue = (NumSettings() > 0) ? m_settingsMap.FindKey(hashedName) : nullptr;
+    const char*       pSettingValue  = (ppSettingValue != nullptr) ? (*ppSettingValue) : nullptr;
 
     if(pSettingValue != nullptr)
     {
@@ -583,6 +583,38 @@ extern Result VirtualDecommit(void* pMem, size_t sizeInBytes);
 ///             - ErrorInvalidPointer if pMem is null.
 extern Result VirtualRelease(void* pMem, size_t sizeInBytes);
 
+/// Returns the OS-specific large page size used for transparent huge pages.
+///
+/// @return  The size, in bytes, of a large page or zero if the OS cannot back virtual memory with large pages.
+extern size_t VirtualLargePageSize();
+
+/// Advises the OS to back the specified committed virtual address range with large pages where possible.
+///
+/// @param [in]  pMem        Pointer to the start of committed memory. Must be aligned to the page size returned from
+///                          @ref Util::VirtualPageSize();
+/// @param [in]  sizeInBytes Size in bytes of the range. Must be aligned to the page size returned from
+///                          @ref Util::VirtualPageSize();
+///
+/// @returns Success if the advice was accepted.
+///          Otherwise:
+///             - Unsupported if the OS doesn't support large pages.
+///             - ErrorInvalidValue if sizeInBytes is zero.
+///             - ErrorInvalidPointer if pMem is null.
+extern Result VirtualAdviseLargePages(void* pMem, size_t sizeInBytes);
+
+/// Pre-faults the specified committed virtual address range so that later CPU accesses don't take page faults.
+///
+/// @param [in]  pMem        Pointer to the start of committed memory. Must be aligned to the page size returned from
+///                          @ref Util::VirtualPageSize();
+/// @param [in]  sizeInBytes Size in bytes of the range. Must be aligned to the page size returned from
+///                          @ref Util::VirtualPageSize();
+///
+/// @returns Success if the range was pre-faulted.
+///          Otherwise:
+///             - ErrorInvalidValue if sizeInBytes is zero.
+///             - ErrorInvalidPointer if pMem is null.
+extern Result VirtualPrefault(void* pMem, size_t sizeInBytes);
+
 /// @internal
 ///
 /// OS-specific implementation to install default allocation callbacks in the specified structure.  Expected to be
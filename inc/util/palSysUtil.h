@@ -141,6 +141,11 @@ extern int64 GetPerfFrequency();
 /// @returns Current value of the CPU performance counter.
 extern int64 GetPerfCpuTime();
 
+/// Suspends execution of the calling thread for at least the specified number of microseconds.
+///
+/// @param [in] microseconds Minimum amount of time to sleep.
+extern void SleepMicroseconds(uint32 microseconds);
+
 /// Determines if a specific key is pressed down.
 ///
 /// @param [in]      key        Specified which key to check.
@@ -287,6 +292,15 @@ PAL_INLINE bool IsComboKey(KeyCode key, KeyCode* pKeys)
     return ret;
 }
 
+// =====================================================================================================================
+/// Hints to the CPU that the caller is in a spin-wait loop, reducing power and pipeline flushes while polling.
+PAL_INLINE void CpuPause()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
 // =====================================================================================================================
 // Issue a full memory barrier.
 PAL_INLINE void MemoryBarrier()
@@ -89,6 +89,14 @@ public:
     /// Returns true if the thread was created successfully
     bool IsCreated() const;
 
+    /// Restricts this object's thread to run only on the logical processors set in the given mask.
+    ///
+    /// @param [in] affinityMask Bit N is set if the thread may run on logical processor N.  Must not be zero.
+    ///
+    /// @returns @ref Success if the affinity was changed, @ref ErrorUnavailable if this object doesn't represent a
+    ///          thread, or @ref ErrorUnknown if the OS rejected the mask.
+    Result SetAffinityMask(uint64 affinityMask);
+
 private:
     // Our platforms' internal start functions all return different types so we can't directly launch our client's
     // StartFunction. We must bootstrap each thread using an internal function which then calls the client's function.
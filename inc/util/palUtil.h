@@ -524,6 +524,8 @@ constexpr Result CollapseResults(Result lhs, Result rhs)
  * - HashSet: Fast set implementation.  Note the similar restrictions to HashMap.
  * - IntervalTree: [Interval tree](http://en.wikipedia.org/wiki/Interval_tree) implementation.
  * - RingBuffer: A ringed buffer of variable length and size.
+ * - SpscRingBuffer, MpscRingBuffer: Bounded lock-free queues for handing elements from one or many producer threads to
+ *   one consumer thread.
  *
  * ### Multithreading and Synchronization
  * Util includes a number of OS-abstracted multithreading and CPU synchronization constructs:
@@ -533,6 +535,7 @@ constexpr Result CollapseResults(Result lhs, Result rhs)
  * - Semaphore
  * - ConditionVariable
  * - Event
+ * - JobSystem: A work-stealing thread pool with job dependencies, which can also run on client-supplied threads.
  *
  * ### Files
  * The File class provides an OS-abstracted interface for opening files and reading/writing data in those files.
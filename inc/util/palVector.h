@@ -100,6 +100,11 @@ private:
  *
  * Vector is a templated array based storage that starts with a default-size allocation in the stack. If more space is
  * needed it then resorts to dynamic allocation by doubling the size every time the capacity is exceeded.
+ *
+ * Elements are relocated with memcpy when T is trivially copyable and with move construction otherwise, so T may be a
+ * move-only or otherwise non-trivial type. Any PAL allocator may back the vector, including arena-style allocators
+ * such as LinearAllocator whose Free() is a no-op; because the capacity doubles, the abandoned buffers never add up to
+ * more than the final buffer.
  * Operations which this class supports are:
  *
  * - Insertion at the end of the array.
@@ -152,9 +157,26 @@ public:
     /// @returns Result ErrorOutOfMemory if the operation failed.
     Result PushBack(const T& data);
 
+    /// Move an element to end of the vector. If not enough space is available, new space will be allocated and the old
+    /// data will be moved to the new space.
+    ///
+    /// @param [in] data The element to be pushed to the vector. The element will become the last element.
+    ///
+    /// @returns Result ErrorOutOfMemory if the operation failed.
+    Result PushBack(T&& data);
+
+    /// Constructs a new element in place at the end of the vector. If not enough space is available, new space will be
+    /// allocated and the old data will be moved to the new space.
+    ///
+    /// @param [in] args Arguments forwarded to the constructor of T.
+    ///
+    /// @returns Result ErrorOutOfMemory if the operation failed.
+    template<typename... Args>
+    Result EmplaceBack(Args&&... args);
+
     /// Returns the element at the end of the vector and destroys it.
     ///
-    /// @param [out] pData The element at the end of the vector
+    /// @param [out] pData The element at the end of the vector. It is move-assigned from the removed element.
     void PopBack(T* pData);
 
     /// Destroys all elements stored in the vector. All dynamically allocated memory will be saved for reuse.
@@ -258,6 +280,12 @@ private:
     // This is a POD-type that exactly fits one T value.
     typedef typename std::aligned_storage<sizeof(T), alignof(T)>::type ValueStorage;
 
+    // Trivially copyable elements can be relocated with memcpy; trivially destructible ones need no destructor calls.
+    static constexpr bool IsTriviallyCopyable     = std::is_trivially_copyable<T>::value;
+    static constexpr bool IsTriviallyDestructible = std::is_trivially_destructible<T>::value;
+
+    Result GrowIfFull();
+
     ValueStorage     m_data[defaultCapacity];  // The initial data buffer stored within the vector object.
     T*               m_pData;                  // Pointer to the current data buffer.
     uint32           m_numElements;            // Number of elements present.
@@ -300,7 +328,7 @@ template<typename T, uint32 defaultCapacity, typename Allocator>
 Vector<T, defaultCapacity, Allocator>::~Vector()
 {
     // Explicitly destroy all non-trivial types.
-    if (!std::is_pod<T>::value)
+    if (!IsTriviallyDestructible)
     {
         for (uint32 idx = 0; idx < m_numElements; ++idx)
         {
@@ -334,7 +362,7 @@ Vector<T, defaultCapacity, Allocator>::Vector(
         // Data buffer will be using storage from local buffer.
         m_pData = reinterpret_cast<T*>(m_data);
 
-        if (std::is_pod<T>::value)
+        if (IsTriviallyCopyable)
         {
             // Optimize trivial types by copying local buffer.
             std::memcpy(m_pData, vector.m_pData, sizeof(T) * m_numElements);
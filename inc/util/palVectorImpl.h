@@ -62,7 +62,7 @@ Result Vector<T, defaultCapacity, Allocator>::Reserve(
         {
             T* const pNewData = static_cast<T*>(pNewMemory);
 
-            if (std::is_pod<T>::value)
+            if (IsTriviallyCopyable)
             {
                 // Optimize trivial types by copying local buffer.
                 std::memcpy(pNewData, m_pData, sizeof(T) * m_numElements);
@@ -74,7 +74,11 @@ Result Vector<T, defaultCapacity, Allocator>::Reserve(
                 for (uint32 idx = 0; idx < m_numElements; ++idx)
                 {
                     PAL_PLACEMENT_NEW(pNewData + idx) T(Move(m_pData[idx]));
-                    m_pData[idx].~T();
+
+                    if (!IsTriviallyDestructible)
+                    {
+                        m_pData[idx].~T();
+                    }
                 }
             }
 
@@ -94,12 +98,10 @@ Result Vector<T, defaultCapacity, Allocator>::Reserve(
 }
 
 // =====================================================================================================================
-// Pushes the new element to the end of the vector. If the vector has reached maximum capacity, new space is allocated
-// on the heap and the data in the old space is copied over to the new space. The old space is freed if it was also
-// allocated on the heap.
+// Makes room for one more element. If the vector has reached maximum capacity, new space is allocated on the heap and
+// the data in the old space is relocated to the new space. The old space is freed if it was also allocated on the heap.
 template<typename T, uint32 defaultCapacity, typename Allocator>
-Result Vector<T, defaultCapacity, Allocator>::PushBack(
-    const T& data)
+Result Vector<T, defaultCapacity, Allocator>::GrowIfFull()
 {
     Result result = Result::_Success;
 
@@ -110,6 +112,17 @@ Result Vector<T, defaultCapacity, Allocator>::PushBack(
         result = Reserve(m_numElements * 2);
     }
 
+    return result;
+}
+
+// =====================================================================================================================
+// Pushes a copy of the new element to the end of the vector.
+template<typename T, uint32 defaultCapacity, typename Allocator>
+Result Vector<T, defaultCapacity, Allocator>::PushBack(
+    const T& data)
+{
+    const Result result = GrowIfFull();
+
     if (result == Result::_Success)
     {
         // Insert new data into the array.
@@ -120,6 +133,41 @@ Result Vector<T, defaultCapacity, Allocator>::PushBack(
     return result;
 }
 
+// =====================================================================================================================
+// Moves the new element to the end of the vector.
+template<typename T, uint32 defaultCapacity, typename Allocator>
+Result Vector<T, defaultCapacity, Allocator>::PushBack(
+    T&& data)
+{
+    const Result result = GrowIfFull();
+
+    if (result == Result::_Success)
+    {
+        PAL_PLACEMENT_NEW(m_pData + m_numElements) T(Move(data));
+        ++(m_numElements);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Constructs a new element directly in the vector's storage.
+template<typename T, uint32 defaultCapacity, typename Allocator>
+template<typename... Args>
+Result Vector<T, defaultCapacity, Allocator>::EmplaceBack(
+    Args&&... args)
+{
+    const Result result = GrowIfFull();
+
+    if (result == Result::_Success)
+    {
+        PAL_PLACEMENT_NEW(m_pData + m_numElements) T(static_cast<Args&&>(args)...);
+        ++(m_numElements);
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 template<typename T, uint32 defaultCapacity, typename Allocator>
 void Vector<T, defaultCapacity, Allocator>::PopBack(
@@ -130,11 +178,11 @@ void Vector<T, defaultCapacity, Allocator>::PopBack(
 
     if (pData != nullptr)
     {
-        *pData = *(m_pData + m_numElements);
+        *pData = Move(*(m_pData + m_numElements));
     }
 
     // Explicitly destroy the removed value if it's non-trivial.
-    if (!std::is_pod<T>::value)
+    if (!IsTriviallyDestructible)
     {
         m_pData[m_numElements].~T();
     }
@@ -145,7 +193,7 @@ template<typename T, uint32 defaultCapacity, typename Allocator>
 void Vector<T, defaultCapacity, Allocator>::Clear()
 {
     // Explicitly destroy all non-trivial types.
-    if (!std::is_pod<T>::value)
+    if (!IsTriviallyDestructible)
     {
         for (uint32 idx = 0; idx < m_numElements; ++idx)
         {
@@ -29,6 +29,7 @@
 #include "palFile.h"
 #include "palIntrusiveListImpl.h"
 #include "palMutex.h"
+#include "palSysUtil.h"
 #include "palVectorImpl.h"
 
 #include <limits.h>
@@ -505,23 +506,49 @@ Result CmdAllocator::GetNewChunk(
     // System memory allocations are only allowed for command data!
     PAL_ASSERT((systemMemory == false) || (allocType == CommandDataAlloc));
 
+    CmdAllocInfo*const pAllocInfo = systemMemory ? &m_sysAllocInfo : &m_gpuAllocInfo[allocType];
+
     // If necessary, engage the chunk lock while we search for a free chunk.
     if (m_pChunkLock != nullptr)
     {
         m_pChunkLock->Lock();
     }
 
-    Result result = FindFreeChunk(systemMemory ? &m_sysAllocInfo : &m_gpuAllocInfo[allocType], ppChunk);
+#if PAL_DEVELOPER_CPU_EVENTS
+    const int64                startTime  = GetPerfCpuTime();
+    const CmdStreamAllocation* pLastAlloc = pAllocInfo->allocList.Back();
+#endif
+
+    Result result = FindFreeChunk(pAllocInfo, ppChunk);
     if (result == Result::Success)
     {
         (*ppChunk)->AddCommandStreamReference();
     }
 
+#if PAL_DEVELOPER_CPU_EVENTS
+    // FindFreeChunk only appends a new allocation to the allocation list if it couldn't recycle an existing chunk.
+    const bool chunkMiss = (pAllocInfo->allocList.Back() != pLastAlloc);
+#endif
+
     if (m_pChunkLock != nullptr)
     {
         m_pChunkLock->Unlock();
     }
 
+#if PAL_DEVELOPER_CPU_EVENTS
+    if (chunkMiss)
+    {
+        Developer::CmdAllocatorChunkMissData data = {};
+        data.pCmdAllocator = this;
+        data.allocType     = allocType;
+        data.systemMemory  = systemMemory;
+        data.cpuTimestamp  = GetPerfCpuTime();
+        data.allocCpuTime  = data.cpuTimestamp - startTime;
+
+        m_pDevice->DeveloperCb(Developer::CallbackType::CmdAllocatorChunkMiss, &data);
+    }
+#endif
+
     return result;
 }
 
@@ -701,7 +728,17 @@ VirtualLinearAllocator* CmdAllocator::GetNewLinearAllocator()
     {
         // Try to create a new linear allocator, we will return null if this fails.
         constexpr uint32 MaxAllocSize = 64 * 1024;
-        pAllocator = PAL_NEW(VirtualLinearAllocatorWithNode, m_pDevice->GetPlatform(), AllocInternal) (MaxAllocSize);
+
+        // These allocators are used while recording so grow them geometrically and pre-fault new pages to keep commit
+        // syscalls and page faults out of the recording path. They're recycled rather than decommitted, so retaining
+        // the high-water mark only matters if a client rewinds with decommit.
+        VirtualLinearAllocatorFlags flags = {};
+        flags.geometricGrowth = 1;
+        flags.retainCommitted = 1;
+        flags.prefault        = 1;
+
+        pAllocator = PAL_NEW(VirtualLinearAllocatorWithNode, m_pDevice->GetPlatform(), AllocInternal) (MaxAllocSize,
+                                                                                                        flags);
 
         if (pAllocator != nullptr)
         {
@@ -136,6 +136,10 @@ CmdBuffer::CmdBuffer(
     m_flags.u32All      = 0;
     m_status            = Result::Success;
 
+#if PAL_DEVELOPER_CPU_EVENTS
+    memset(&m_cpuEventCounts, 0, sizeof(m_cpuEventCounts));
+#endif
+
     // Initialize all draw/dispatch funcs to invalid stubs.  HWIP command buffer classes that support these interfaces
     // will overwrite the function pointers.
     m_funcTable.pfnCmdDraw                     = CmdDrawInvalid;
@@ -290,6 +294,17 @@ Result CmdBuffer::Begin(
                 // longer to determine if its necessary than to just increment the variable.
                 m_numCmdBufsBegun++;
 #endif
+
+#if PAL_DEVELOPER_CPU_EVENTS
+                memset(&m_cpuEventCounts, 0, sizeof(m_cpuEventCounts));
+
+                Developer::CmdBufferCpuData data = {};
+                data.pCmdBuffer    = this;
+                data.cpuTimestamp  = GetPerfCpuTime();
+                data.numCmdStreams = NumCmdStreams();
+
+                m_device.DeveloperCb(Developer::CallbackType::CmdBufferBegin, &data);
+#endif
             }
         }
     }
@@ -357,6 +372,34 @@ Result CmdBuffer::End()
         if (result == Result::Success)
         {
             m_recordState = CmdBufferRecordState::Executable;
+
+#if PAL_DEVELOPER_CPU_EVENTS
+            Developer::CmdBufferCpuData data = {};
+            data.pCmdBuffer    = this;
+            data.numCmdStreams = NumCmdStreams();
+
+            for (uint32 streamIdx = 0; streamIdx < data.numCmdStreams; ++streamIdx)
+            {
+                const Pal::CmdStream*const pStream = GetCmdStream(streamIdx);
+
+                if (pStream != nullptr)
+                {
+                    data.numChunks += pStream->GetNumChunks();
+
+                    for (auto iter = pStream->GetFwdIterator(); iter.IsValid(); iter.Next())
+                    {
+                        data.numDwords += iter.Get()->DwordsAllocated();
+                    }
+                }
+            }
+
+            data.numDraws      = m_cpuEventCounts.draws;
+            data.numDispatches = m_cpuEventCounts.dispatches;
+            data.numBarriers   = m_cpuEventCounts.barriers;
+            data.cpuTimestamp  = GetPerfCpuTime();
+
+            m_device.DeveloperCb(Developer::CallbackType::CmdBufferEnd, &data);
+#endif
         }
     }
     else
@@ -608,6 +651,10 @@ gpusize CmdBuffer::AllocateGpuScratchMem(
 void CmdBuffer::CmdBarrier(
     const BarrierInfo& barrierInfo)
 {
+#if PAL_DEVELOPER_CPU_EVENTS
+    m_cpuEventCounts.barriers++;
+#endif
+
 #if PAL_ENABLE_PRINTS_ASSERTS
     AutoBuffer<bool, 16, Platform>  processed(barrierInfo.transitionCount, m_device.GetPlatform());
     if (processed.Capacity() >= barrierInfo.transitionCount)
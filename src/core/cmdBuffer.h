@@ -922,6 +922,17 @@ protected:
         uint32     u32All;
     } m_flags;
 
+#if PAL_DEVELOPER_CPU_EVENTS
+    // Number of draws, dispatches and barriers recorded since Begin(). These are reported by the CmdBufferEnd developer
+    // callback so that the CPU cost of recording can be normalized per command.
+    struct
+    {
+        uint32 draws;
+        uint32 dispatches;
+        uint32 barriers;
+    } m_cpuEventCounts;
+#endif
+
 private:
     CmdStreamChunk* GetNextDataChunk(
         CmdAllocType type,
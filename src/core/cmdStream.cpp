@@ -34,6 +34,10 @@
 #include "palLinearAllocator.h"
 #include "palVectorImpl.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 using namespace Util;
 
 namespace Pal
@@ -64,6 +68,8 @@ CmdStream::CmdStream(
     m_reserveLimit(Device::CmdStreamReserveLimit),
     m_chunkDwordsAvailable(0),
     m_pReserveBuffer(nullptr),
+    m_pStagingBuffer(nullptr),
+    m_pReserveStaging(nullptr),
     m_nestedChunks(32, pDevice->GetPlatform()),
     m_status(Result::Success),
     m_totalChunkDwords(0)
@@ -130,12 +136,105 @@ CmdStream::~CmdStream()
 {
     // Call reset to drop all chunk references.
     Reset(nullptr, true);
+
+    PAL_FREE(m_pStagingBuffer, m_pDevice->GetPlatform());
 }
 
 // =====================================================================================================================
 Result CmdStream::Init()
 {
-    return m_nestedChunks.Init();
+    Result result = m_nestedChunks.Init();
+
+    const PalSettings& settings = m_pDevice->Settings();
+
+    // Commit staging only pays off when the chunk memory is uncached GPU memory that we would otherwise be writing
+    // piecemeal. System memory streams and chunks with their own staging buffer are already cacheable.
+    if ((result == Result::Success)          &&
+        settings.cmdStreamEnableCommitStaging &&
+        (settings.cmdBufChunkEnableStagingBuffer == false) &&
+        (m_flags.buildInSysMem == 0))
+    {
+        // Leave room to shift the staging address by up to one cache line so that it can mirror the cache line offset
+        // of the chunk space it will be copied into.
+        const size_t stagingSize = (m_reserveLimit * sizeof(uint32)) + CmdStagingLineSize;
+
+        m_pStagingBuffer = static_cast<uint32*>(PAL_MALLOC_ALIGNED(stagingSize,
+                                                                   CmdStagingLineSize,
+                                                                   m_pDevice->GetPlatform(),
+                                                                   AllocInternal));
+
+        if (m_pStagingBuffer == nullptr)
+        {
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Copies a block of committed commands from the staging buffer into chunk memory. The caller guarantees that pSrc and
+// pDst share the same offset within a cache line, so every full line can be moved with aligned non-temporal stores
+// which skip the cache and combine into full-line writes to the chunk; only the partial lines at either end of the
+// block are written with regular stores.
+static void CopyCommandsNonTemporal(
+    uint32*       pDst,
+    const uint32* pSrc,
+    uint32        dwordCount)
+{
+#if defined(__SSE2__)
+    constexpr uint32 DwordsPerLine = CmdStagingLineSize / sizeof(uint32);
+
+    const size_t lineOffset = reinterpret_cast<size_t>(pDst) % CmdStagingLineSize;
+    PAL_ASSERT(lineOffset == (reinterpret_cast<size_t>(pSrc) % CmdStagingLineSize));
+
+    // Write the DWORDs up to the first line boundary with regular stores.
+    const uint32 headDwords = (lineOffset == 0)
+                              ? 0
+                              : Min(dwordCount, static_cast<uint32>((CmdStagingLineSize - lineOffset) / sizeof(uint32)));
+
+    for (uint32 i = 0; i < headDwords; i++)
+    {
+        pDst[i] = pSrc[i];
+    }
+
+    pDst       += headDwords;
+    pSrc       += headDwords;
+    dwordCount -= headDwords;
+
+    if (dwordCount >= DwordsPerLine)
+    {
+        for (; dwordCount >= DwordsPerLine; dwordCount -= DwordsPerLine)
+        {
+            const __m128i* pSrcLine = reinterpret_cast<const __m128i*>(pSrc);
+            __m128i*       pDstLine = reinterpret_cast<__m128i*>(pDst);
+
+            const __m128i  data0    = _mm_load_si128(pSrcLine + 0);
+            const __m128i  data1    = _mm_load_si128(pSrcLine + 1);
+            const __m128i  data2    = _mm_load_si128(pSrcLine + 2);
+            const __m128i  data3    = _mm_load_si128(pSrcLine + 3);
+
+            _mm_stream_si128(pDstLine + 0, data0);
+            _mm_stream_si128(pDstLine + 1, data1);
+            _mm_stream_si128(pDstLine + 2, data2);
+            _mm_stream_si128(pDstLine + 3, data3);
+
+            pDst += DwordsPerLine;
+            pSrc += DwordsPerLine;
+        }
+
+        // Non-temporal stores are weakly ordered; fence them so they are globally visible before the stream is
+        // submitted or any later regular stores land in the same chunk.
+        _mm_sfence();
+    }
+
+    for (uint32 i = 0; i < dwordCount; i++)
+    {
+        pDst[i] = pSrc[i];
+    }
+#else
+    memcpy(pDst, pSrc, dwordCount * sizeof(uint32));
+#endif
 }
 
 // =====================================================================================================================
@@ -174,19 +273,7 @@ uint32* CmdStream::ReserveCommands()
     // Preemptively allocate enough space to store all commands the caller could write.
     m_pReserveBuffer = AllocCommandSpace(m_reserveLimit);
 
-#if PAL_ENABLE_PRINTS_ASSERTS
-    // Debug builds can memset all command space before the caller has a chance to write packets to help expose holes
-    // in our packet building logic.
-    if (m_pDevice->Settings().cmdStreamEnableMemsetOnReserve)
-    {
-        memset(m_pReserveBuffer,
-               m_pDevice->Settings().cmdStreamMemsetValue,
-               m_reserveLimit * sizeof(uint32));
-    }
-#endif
-
-    PAL_ASSERT(m_pReserveBuffer != nullptr);
-    return m_pReserveBuffer;
+    return BeginReserve();
 }
 
 // =====================================================================================================================
@@ -207,19 +294,41 @@ uint32* CmdStream::ReserveCommandsInNewChunk()
     // Preemptively allocate enough space from a new chunk to store all commands the caller could write.
     m_pReserveBuffer = pChunk->GetSpace(m_reserveLimit);
 
+    return BeginReserve();
+}
+
+// =====================================================================================================================
+// Shared tail of ReserveCommands and ReserveCommandsInNewChunk: picks the address the caller will write its commands to
+// now that m_pReserveBuffer points at the chunk space backing this reservation.
+uint32* CmdStream::BeginReserve()
+{
+    PAL_ASSERT(m_pReserveBuffer != nullptr);
+
+    if (m_pStagingBuffer != nullptr)
+    {
+        // Offset the staging address so it sits at the same position within a cache line as the chunk space. That way
+        // the commit copy can move whole lines with aligned non-temporal stores.
+        const uint32 lineOffset = static_cast<uint32>(reinterpret_cast<size_t>(m_pReserveBuffer) % CmdStagingLineSize);
+
+        m_pReserveStaging = static_cast<uint32*>(VoidPtrInc(m_pStagingBuffer, lineOffset));
+    }
+    else
+    {
+        m_pReserveStaging = m_pReserveBuffer;
+    }
+
 #if PAL_ENABLE_PRINTS_ASSERTS
     // Debug builds can memset all command space before the caller has a chance to write packets to help expose holes
     // in our packet building logic.
     if (m_pDevice->Settings().cmdStreamEnableMemsetOnReserve)
     {
-        memset(m_pReserveBuffer,
+        memset(m_pReserveStaging,
                m_pDevice->Settings().cmdStreamMemsetValue,
                m_reserveLimit * sizeof(uint32));
     }
 #endif
 
-    PAL_ASSERT(m_pReserveBuffer != nullptr);
-    return m_pReserveBuffer;
+    return m_pReserveStaging;
 }
 
 // =====================================================================================================================
@@ -233,9 +342,14 @@ void CmdStream::CommitCommands(
     m_isReserved = false;
 #endif
 
-    const uint32 dwordsUsed = static_cast<uint32>(pEndOfBuffer - m_pReserveBuffer);
+    const uint32 dwordsUsed = static_cast<uint32>(pEndOfBuffer - m_pReserveStaging);
     PAL_ASSERT(dwordsUsed <= m_reserveLimit);
 
+    if (m_pReserveStaging != m_pReserveBuffer)
+    {
+        CopyCommandsNonTemporal(m_pReserveBuffer, m_pReserveStaging, dwordsUsed);
+    }
+
 #if PAL_ENABLE_PRINTS_ASSERTS
     // If commit size logging is enabled, make the appropriate call to the allocator to update its histogram.
     if (m_pDevice->Settings().logCmdBufCommitSizes)
@@ -247,8 +361,9 @@ void CmdStream::CommitCommands(
     // We must have already done an AllocCommandSpace call so we just need to reclaim any unused space.
     ReclaimCommandSpace(m_reserveLimit - dwordsUsed);
 
-    // Technically this pointer is invalid now.
-    m_pReserveBuffer = nullptr;
+    // Technically these pointers are invalid now.
+    m_pReserveBuffer  = nullptr;
+    m_pReserveStaging = nullptr;
 }
 
 // =====================================================================================================================
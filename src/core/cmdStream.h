@@ -48,6 +48,9 @@ class IQueue;
 class Platform;
 enum  QueueType : uint32;
 
+// Alignment and copy granularity of the optional per-stream commit staging buffer; matches the CPU cache line size.
+constexpr size_t CmdStagingLineSize = 64;
+
 // Many command buffers break down into multiple command streams targeting internal sub-engines. For example, Universal
 // command buffers build a primary stream (DE) but may also build a second stream for the constant engine (CE).
 enum class SubEngineType : uint32
@@ -284,6 +287,7 @@ protected:
 
 private:
     CmdStreamChunk* GetNextChunk(uint32 numDwords);
+    uint32* BeginReserve();
 
     // These adjust the size of our chunk list.
     CmdStreamChunk* GetChunk(uint32 numDwords);
@@ -308,10 +312,15 @@ private:
 
     uint32           m_chunkDwordsAvailable; // Unused DWORDs available in the tail of m_chunkList.
 
-    // If the dedicated reserve buffer is in use its address will be stored here at initialization. If it is not in use
-    // then this pointer will be set to a bit of allocated chunk space each time ReserveCommands is called.
+    // Chunk space backing the current reservation, set each time ReserveCommands is called.
     uint32*          m_pReserveBuffer;
 
+    // Optional cacheable buffer that ReserveCommands hands out instead of chunk space; CommitCommands then copies the
+    // written commands into m_pReserveBuffer with non-temporal stores. m_pReserveStaging is the address returned by the
+    // current reservation, which is either inside m_pStagingBuffer or equal to m_pReserveBuffer.
+    uint32*          m_pStagingBuffer;
+    uint32*          m_pReserveStaging;
+
     // Hash map of all nested command buffer chunks which were executed by this command stream via calls to Call().
     NestedChunkMap   m_nestedChunks;
 
@@ -489,6 +489,12 @@ Result Device::SetupPublicSettingDefaults()
     m_publicSettings.disableCommandBufferPreemption = false;
     m_publicSettings.disableSkipFceOptimization = true;
     m_publicSettings.dccBitsPerPixelThreshold = UINT_MAX;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+    m_publicSettings.enablePipelineObjectCache = false;
+    m_publicSettings.pipelineDiskCacheDirectory[0] = '\0';
+    m_publicSettings.pipelineDiskCacheMaxSize = 64 * 1024 * 1024;
+    m_publicSettings.eagerShaderRingGrowth = false;
+#endif
     m_publicSettings.miscellaneousDebugString[0] = '\0';
     m_publicSettings.renderedByString[0] = '\0';
 
@@ -540,6 +546,21 @@ Result Device::HwlEarlyInit()
         result = m_pGfxDevice->InitHwlSettings(m_pSettingsLoader->GetSettingsPtr());
     }
 
+    if ((result == Result::Success) && (m_pGfxDevice != nullptr))
+    {
+        result = m_pGfxDevice->GetPipelineCodeCache()->Init();
+
+        if (result == Result::Success)
+        {
+            result = m_pGfxDevice->GetPipelineObjectCache()->Init();
+        }
+
+        if (result == Result::Success)
+        {
+            result = m_pGfxDevice->GetPipelineDiskCache()->Init();
+        }
+    }
+
 #if PAL_BUILD_OSS
     if (result == Result::Success)
     {
@@ -1435,6 +1456,13 @@ Result Device::Finalize(
         result = CreateEngines(finalizeInfo);
     }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+    if ((result == Result::Success) && (m_pGfxDevice != nullptr))
+    {
+        m_pGfxDevice->ApplyShaderRingSizeHints(finalizeInfo.shaderRingSizeHints);
+    }
+#endif
+
     // Initialize a real dummy command stream, which is filled with NOP
     if (result == Result::Success)
     {
@@ -4372,12 +4400,10 @@ bool Device::EngineSupportsGraphics(
 // P2P WA can be required from either GFX or OSSIP, but we wanted to put the bulk of the implementation in some hardware
 // layer.  Forward this call to the GFX HWL regardless of the caller IP.
 Result Device::P2pBltWaModifyRegionListMemory(
-    const IGpuMemory&       dstGpuMemory,
-    uint32                  regionCount,
-    const MemoryCopyRegion* pRegions,
-    uint32*                 pNewRegionCount,
-    MemoryCopyRegion*       pNewRegions,
-    gpusize*                pChunkAddrs
+    const IGpuMemory&                     dstGpuMemory,
+    uint32                                regionCount,
+    const MemoryCopyRegion*               pRegions,
+    P2pBltWaRegionList<MemoryCopyRegion>* pNewRegions
     ) const
 {
     Result result = Result::Success;
@@ -4387,9 +4413,7 @@ Result Device::P2pBltWaModifyRegionListMemory(
         result = m_pGfxDevice->P2pBltWaModifyRegionListMemory(dstGpuMemory,
                                                               regionCount,
                                                               pRegions,
-                                                              pNewRegionCount,
-                                                              pNewRegions,
-                                                              pChunkAddrs);
+                                                              pNewRegions);
     }
 
     return result;
@@ -4399,13 +4423,11 @@ Result Device::P2pBltWaModifyRegionListMemory(
 // P2P WA can be required from either GFX or OSSIP, but we wanted to put the bulk of the implementation in some hardware
 // layer.  Forward this call to the GFX HWL regardless of the caller IP.
 Result Device::P2pBltWaModifyRegionListImage(
-    const Pal::Image&      srcImage,
-    const Pal::Image&      dstImage,
-    uint32                 regionCount,
-    const ImageCopyRegion* pRegions,
-    uint32*                pNewRegionCount,
-    ImageCopyRegion*       pNewRegions,
-    gpusize*               pChunkAddrs
+    const Pal::Image&                    srcImage,
+    const Pal::Image&                    dstImage,
+    uint32                               regionCount,
+    const ImageCopyRegion*               pRegions,
+    P2pBltWaRegionList<ImageCopyRegion>* pNewRegions
     ) const
 {
     Result result = Result::Success;
@@ -4416,9 +4438,7 @@ Result Device::P2pBltWaModifyRegionListImage(
                                                              dstImage,
                                                              regionCount,
                                                              pRegions,
-                                                             pNewRegionCount,
-                                                             pNewRegions,
-                                                             pChunkAddrs);
+                                                             pNewRegions);
     }
 
     return result;
@@ -4428,13 +4448,11 @@ Result Device::P2pBltWaModifyRegionListImage(
 // P2P WA can be required from either GFX or OSSIP, but we wanted to put the bulk of the implementation in some hardware
 // layer.  Forward this call to the GFX HWL regardless of the caller IP.
 Result Device::P2pBltWaModifyRegionListImageToMemory(
-    const Pal::Image&            srcImage,
-    const IGpuMemory&            dstGpuMemory,
-    uint32                       regionCount,
-    const MemoryImageCopyRegion* pRegions,
-    uint32*                      pNewRegionCount,
-    MemoryImageCopyRegion*       pNewRegions,
-    gpusize*                     pChunkAddrs
+    const Pal::Image&                          srcImage,
+    const IGpuMemory&                          dstGpuMemory,
+    uint32                                     regionCount,
+    const MemoryImageCopyRegion*               pRegions,
+    P2pBltWaRegionList<MemoryImageCopyRegion>* pNewRegions
     ) const
 {
     Result result = Result::Success;
@@ -4446,9 +4464,7 @@ Result Device::P2pBltWaModifyRegionListImageToMemory(
                                                                      dstGpuMemory,
                                                                      regionCount,
                                                                      pRegions,
-                                                                     pNewRegionCount,
-                                                                     pNewRegions,
-                                                                     pChunkAddrs);
+                                                                     pNewRegions);
     }
 
     return result;
@@ -4458,13 +4474,11 @@ Result Device::P2pBltWaModifyRegionListImageToMemory(
 // P2P WA can be required from either GFX or OSSIP, but we wanted to put the bulk of the implementation in some hardware
 // layer.  Forward this call to the GFX HWL regardless of the caller IP.
 Result Device::P2pBltWaModifyRegionListMemoryToImage(
-    const IGpuMemory&            srcGpuMemory,
-    const Pal::Image&            dstImage,
-    uint32                       regionCount,
-    const MemoryImageCopyRegion* pRegions,
-    uint32*                      pNewRegionCount,
-    MemoryImageCopyRegion*       pNewRegions,
-    gpusize*                     pChunkAddrs
+    const IGpuMemory&                          srcGpuMemory,
+    const Pal::Image&                          dstImage,
+    uint32                                     regionCount,
+    const MemoryImageCopyRegion*               pRegions,
+    P2pBltWaRegionList<MemoryImageCopyRegion>* pNewRegions
     ) const
 {
     Result result = Result::Success;
@@ -4475,9 +4489,7 @@ Result Device::P2pBltWaModifyRegionListMemoryToImage(
                                                                      dstImage,
                                                                      regionCount,
                                                                      pRegions,
-                                                                     pNewRegionCount,
-                                                                     pNewRegions,
-                                                                     pChunkAddrs);
+                                                                     pNewRegions);
     }
 
     return result;
@@ -1549,39 +1549,31 @@ public:
         { return (ChipProperties().p2pBltWaInfo.required && dstGpuMemory.AccessesPeerMemory()); }
 
     Result P2pBltWaModifyRegionListMemory(
-        const IGpuMemory&       dstGpuMemory,
-        uint32                  regionCount,
-        const MemoryCopyRegion* pRegions,
-        uint32*                 pNewRegionCount,
-        MemoryCopyRegion*       pNewRegions,
-        gpusize*                pChunkAddrs) const;
+        const IGpuMemory&                     dstGpuMemory,
+        uint32                                regionCount,
+        const MemoryCopyRegion*               pRegions,
+        P2pBltWaRegionList<MemoryCopyRegion>* pNewRegions) const;
 
     Result P2pBltWaModifyRegionListImage(
-        const Pal::Image&      srcImage,
-        const Pal::Image&      dstImage,
-        uint32                 regionCount,
-        const ImageCopyRegion* pRegions,
-        uint32*                pNewRegionCount,
-        ImageCopyRegion*       pNewRegions,
-        gpusize*               pChunkAddrs) const;
+        const Pal::Image&                    srcImage,
+        const Pal::Image&                    dstImage,
+        uint32                               regionCount,
+        const ImageCopyRegion*               pRegions,
+        P2pBltWaRegionList<ImageCopyRegion>* pNewRegions) const;
 
     Result P2pBltWaModifyRegionListImageToMemory(
-        const Pal::Image&            srcImage,
-        const IGpuMemory&            dstGpuMemory,
-        uint32                       regionCount,
-        const MemoryImageCopyRegion* pRegions,
-        uint32*                      pNewRegionCount,
-        MemoryImageCopyRegion*       pNewRegions,
-        gpusize*                     pChunkAddrs) const;
+        const Pal::Image&                          srcImage,
+        const IGpuMemory&                          dstGpuMemory,
+        uint32                                     regionCount,
+        const MemoryImageCopyRegion*               pRegions,
+        P2pBltWaRegionList<MemoryImageCopyRegion>* pNewRegions) const;
 
     Result P2pBltWaModifyRegionListMemoryToImage(
-        const IGpuMemory&            srcGpuMemory,
-        const Pal::Image&            dstImage,
-        uint32                       regionCount,
-        const MemoryImageCopyRegion* pRegions,
-        uint32*                      pNewRegionCount,
-        MemoryImageCopyRegion*       pNewRegions,
-        gpusize*                     pChunkAddrs) const;
+        const IGpuMemory&                          srcGpuMemory,
+        const Pal::Image&                          dstImage,
+        uint32                                     regionCount,
+        const MemoryImageCopyRegion*               pRegions,
+        P2pBltWaRegionList<MemoryImageCopyRegion>* pNewRegions) const;
 
     const BoundGpuMemory& GetDummyChunkMem() const { return m_dummyChunkMem; }
 
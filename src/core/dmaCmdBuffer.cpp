@@ -377,33 +377,26 @@ void DmaCmdBuffer::CmdCopyMemory(
     const GpuMemory& dstMemory = static_cast<const GpuMemory&>(dstGpuMemory);
     bool p2pBltInfoRequired    = m_pDevice->IsP2pBltWaRequired(dstMemory);
 
-    uint32 newRegionCount = 0;
-    if (p2pBltInfoRequired)
-    {
-        m_pDevice->P2pBltWaModifyRegionListMemory(dstMemory,
-                                                  regionCount,
-                                                  pRegions,
-                                                  &newRegionCount,
-                                                  nullptr,
-                                                  nullptr);
-    }
+    // The P2P BLT workaround splits the regions into small chunks. The new region list is built in the command
+    // buffer's linear allocator and is released when this function returns.
+    LinearAllocatorAuto<VirtualLinearAllocator> p2pAllocator(Allocator(), false);
+    P2pBltWaRegionList<MemoryCopyRegion>        p2pRegions(Allocator());
+    const gpusize*                              pChunkAddrs = nullptr;
 
-    AutoBuffer<MemoryCopyRegion, 32, Platform> newRegions(newRegionCount, m_pDevice->GetPlatform());
-    AutoBuffer<gpusize, 32, Platform> chunkAddrs(newRegionCount, m_pDevice->GetPlatform());
     if (p2pBltInfoRequired)
     {
-        if ((newRegions.Capacity() >= newRegionCount) && (chunkAddrs.Capacity() >= newRegionCount))
+        const Result result = m_pDevice->P2pBltWaModifyRegionListMemory(dstMemory,
+                                                                        regionCount,
+                                                                        pRegions,
+                                                                        &p2pRegions);
+
+        if (result == Result::Success)
         {
-            m_pDevice->P2pBltWaModifyRegionListMemory(dstMemory,
-                                                      regionCount,
-                                                      pRegions,
-                                                      &newRegionCount,
-                                                      &newRegions[0],
-                                                      &chunkAddrs[0]);
-            regionCount = newRegionCount;
-            pRegions    = &newRegions[0];
-
-            P2pBltWaCopyBegin(&dstMemory, regionCount, &chunkAddrs[0]);
+            regionCount = p2pRegions.NumRegions();
+            pRegions    = p2pRegions.regions.Data();
+            pChunkAddrs = p2pRegions.chunkAddrs.Data();
+
+            P2pBltWaCopyBegin(&dstMemory, regionCount, pChunkAddrs);
         }
         else
         {
@@ -417,7 +410,7 @@ void DmaCmdBuffer::CmdCopyMemory(
     {
         if (p2pBltInfoRequired)
         {
-            P2pBltWaCopyNextRegion(chunkAddrs[rgnIdx]);
+            P2pBltWaCopyNextRegion(pChunkAddrs[rgnIdx]);
         }
 
         CopyMemoryRegion(srcGpuMemory, dstGpuMemory, pRegions[rgnIdx]);
@@ -666,37 +659,27 @@ void DmaCmdBuffer::CmdCopyImage(
 
     bool p2pBltInfoRequired = m_pDevice->IsP2pBltWaRequired(*dstImg.GetBoundGpuMemory().Memory());
 
-    uint32 newRegionCount = 0;
-    if (p2pBltInfoRequired)
-    {
-        m_pDevice->P2pBltWaModifyRegionListImage(srcImg,
-                                                 dstImg,
-                                                 regionCount,
-                                                 pRegions,
-                                                 &newRegionCount,
-                                                 nullptr,
-                                                 nullptr);
-    }
-
-    AutoBuffer<ImageCopyRegion, 32, Platform> newRegions(newRegionCount, m_pDevice->GetPlatform());
-    AutoBuffer<gpusize, 32, Platform> chunkAddrs(newRegionCount, m_pDevice->GetPlatform());
+    // The P2P BLT workaround splits the regions into small chunks. The new region list is built in the command
+    // buffer's linear allocator and is released when this function returns.
+    LinearAllocatorAuto<VirtualLinearAllocator> p2pAllocator(Allocator(), false);
+    P2pBltWaRegionList<ImageCopyRegion>         p2pRegions(Allocator());
+    const gpusize*                              pChunkAddrs = nullptr;
 
     if (p2pBltInfoRequired)
     {
-        if ((newRegions.Capacity() >= newRegionCount) && (chunkAddrs.Capacity() >= newRegionCount))
+        const Result result = m_pDevice->P2pBltWaModifyRegionListImage(srcImg,
+                                                                       dstImg,
+                                                                       regionCount,
+                                                                       pRegions,
+                                                                       &p2pRegions);
+
+        if (result == Result::Success)
         {
-            m_pDevice->P2pBltWaModifyRegionListImage(srcImg,
-                                                     dstImg,
-                                                     regionCount,
-                                                     pRegions,
-                                                     &newRegionCount,
-                                                     &newRegions[0],
-                                                     &chunkAddrs[0]);
-
-            regionCount = newRegionCount;
-            pRegions    = &newRegions[0];
-
-            P2pBltWaCopyBegin(dstImg.GetBoundGpuMemory().Memory(), regionCount, &chunkAddrs[0]);
+            regionCount = p2pRegions.NumRegions();
+            pRegions    = p2pRegions.regions.Data();
+            pChunkAddrs = p2pRegions.chunkAddrs.Data();
+
+            P2pBltWaCopyBegin(dstImg.GetBoundGpuMemory().Memory(), regionCount, pChunkAddrs);
         }
         else
         {
@@ -715,7 +698,7 @@ void DmaCmdBuffer::CmdCopyImage(
 
         if (p2pBltInfoRequired)
         {
-            P2pBltWaCopyNextRegion(chunkAddrs[rgnIdx]);
+            P2pBltWaCopyNextRegion(pChunkAddrs[rgnIdx]);
         }
 
         SetupDmaInfoSurface(srcImage, region.srcSubres, region.srcOffset, &imageCopyInfo.src, &srcTexelScale);
@@ -832,35 +815,27 @@ void DmaCmdBuffer::CmdCopyMemoryToImage(
 
     bool p2pBltInfoRequired = m_pDevice->IsP2pBltWaRequired(*dstImg.GetBoundGpuMemory().Memory());
 
-    uint32 newRegionCount = 0;
-    if (p2pBltInfoRequired)
-    {
-        m_pDevice->P2pBltWaModifyRegionListMemoryToImage(srcMemory,
-                                                         dstImg,
-                                                         regionCount,
-                                                         pRegions,
-                                                         &newRegionCount,
-                                                         nullptr,
-                                                         nullptr);
-    }
+    // The P2P BLT workaround splits the regions into small chunks. The new region list is built in the command
+    // buffer's linear allocator and is released when this function returns.
+    LinearAllocatorAuto<VirtualLinearAllocator> p2pAllocator(Allocator(), false);
+    P2pBltWaRegionList<MemoryImageCopyRegion>   p2pRegions(Allocator());
+    const gpusize*                              pChunkAddrs = nullptr;
 
-    AutoBuffer<MemoryImageCopyRegion, 32, Platform> newRegions(newRegionCount, m_pDevice->GetPlatform());
-    AutoBuffer<gpusize, 32, Platform> chunkAddrs(newRegionCount, m_pDevice->GetPlatform());
     if (p2pBltInfoRequired)
     {
-        if ((newRegions.Capacity() >= newRegionCount) && (chunkAddrs.Capacity() >= newRegionCount))
+        const Result result = m_pDevice->P2pBltWaModifyRegionListMemoryToImage(srcMemory,
+                                                                               dstImg,
+                                                                               regionCount,
+                                                                               pRegions,
+                                                                               &p2pRegions);
+
+        if (result == Result::Success)
         {
-            m_pDevice->P2pBltWaModifyRegionListMemoryToImage(srcMemory,
-                                                             dstImg,
-                                                             regionCount,
-                                                             pRegions,
-                                                             &newRegionCount,
-                                                             &newRegions[0],
-                                                             &chunkAddrs[0]);
-            regionCount = newRegionCount;
-            pRegions    = &newRegions[0];
-
-            P2pBltWaCopyBegin(dstImg.GetBoundGpuMemory().Memory(), regionCount, &chunkAddrs[0]);
+            regionCount = p2pRegions.NumRegions();
+            pRegions    = p2pRegions.regions.Data();
+            pChunkAddrs = p2pRegions.chunkAddrs.Data();
+
+            P2pBltWaCopyBegin(dstImg.GetBoundGpuMemory().Memory(), regionCount, pChunkAddrs);
         }
         else
         {
@@ -878,7 +853,7 @@ void DmaCmdBuffer::CmdCopyMemoryToImage(
 
         if (p2pBltInfoRequired)
         {
-            P2pBltWaCopyNextRegion(chunkAddrs[rgnIdx]);
+            P2pBltWaCopyNextRegion(pChunkAddrs[rgnIdx]);
         }
 
         SetupDmaInfoSurface(dstImage, region.imageSubres, region.imageOffset, &imageInfo, &texelScale);
@@ -961,35 +936,27 @@ void DmaCmdBuffer::CmdCopyImageToMemory(
 
     bool p2pBltInfoRequired = m_pDevice->IsP2pBltWaRequired(dstMemory);
 
-    uint32 newRegionCount = 0;
-    if (p2pBltInfoRequired)
-    {
-        m_pDevice->P2pBltWaModifyRegionListImageToMemory(srcImg,
-                                                         dstMemory,
-                                                         regionCount,
-                                                         pRegions,
-                                                         &newRegionCount,
-                                                         nullptr,
-                                                         nullptr);
-    }
+    // The P2P BLT workaround splits the regions into small chunks. The new region list is built in the command
+    // buffer's linear allocator and is released when this function returns.
+    LinearAllocatorAuto<VirtualLinearAllocator> p2pAllocator(Allocator(), false);
+    P2pBltWaRegionList<MemoryImageCopyRegion>   p2pRegions(Allocator());
+    const gpusize*                              pChunkAddrs = nullptr;
 
-    AutoBuffer<MemoryImageCopyRegion, 32, Platform> newRegions(newRegionCount, m_pDevice->GetPlatform());
-    AutoBuffer<gpusize, 32, Platform> chunkAddrs(newRegionCount, m_pDevice->GetPlatform());
     if (p2pBltInfoRequired)
     {
-        if ((newRegions.Capacity() >= newRegionCount) && (chunkAddrs.Capacity() >= newRegionCount))
+        const Result result = m_pDevice->P2pBltWaModifyRegionListImageToMemory(srcImg,
+                                                                               dstMemory,
+                                                                               regionCount,
+                                                                               pRegions,
+                                                                               &p2pRegions);
+
+        if (result == Result::Success)
         {
-            m_pDevice->P2pBltWaModifyRegionListImageToMemory(srcImg,
-                                                             dstMemory,
-                                                             regionCount,
-                                                             pRegions,
-                                                             &newRegionCount,
-                                                             &newRegions[0],
-                                                             &chunkAddrs[0]);
-            regionCount = newRegionCount;
-            pRegions    = &newRegions[0];
-
-            P2pBltWaCopyBegin(&dstMemory, regionCount, &chunkAddrs[0]);
+            regionCount = p2pRegions.NumRegions();
+            pRegions    = p2pRegions.regions.Data();
+            pChunkAddrs = p2pRegions.chunkAddrs.Data();
+
+            P2pBltWaCopyBegin(&dstMemory, regionCount, pChunkAddrs);
         }
         else
         {
@@ -1006,7 +973,7 @@ void DmaCmdBuffer::CmdCopyImageToMemory(
 
         if (p2pBltInfoRequired)
         {
-            P2pBltWaCopyNextRegion(chunkAddrs[rgnIdx]);
+            P2pBltWaCopyNextRegion(pChunkAddrs[rgnIdx]);
         }
 
         SetupDmaInfoSurface(srcImage, region.imageSubres, region.imageOffset, &imageInfo, &texelScale);
@@ -30,6 +30,10 @@
 #include "core/g_mergedFormatInfo.h"
 #include <cmath>
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
 using namespace Util;
 using namespace Util::Math;
 
@@ -146,130 +150,339 @@ void ConvertColorToX9Y9Z9E5(
     pColorOut[3] = sharedExp;
 }
 
+// Selects how ConvertColor processes the four components of a color.
+enum class ColorConvertKernel : uint32
+{
+    Generic = 0,    // Convert each component on its own using the scalar Util helpers.
+    SharedExponent, // The format is X9Y9Z9E5, whose components share one exponent.
+#if defined(__SSE2__)
+    FixedSse2,      // Every used component is Unorm or Snorm with at most 16 bits; convert all four at once.
+    Float16Sse2,    // Every used component is a 16-bit float; convert all four at once.
+#endif
+};
+
+// Everything ConvertColor needs to know about a format, resolved once so that converting many colors of the same
+// format doesn't re-query the format table for every channel of every color.
+struct ColorConvertInfo
+{
+    NumericSupportFlags numericSupport[4];  // Conversion to apply to each RGBA component, Undefined if it is unused.
+    uint32              numBits[4];         // Bit count of the data format component each RGBA component maps to.
+    ColorConvertKernel  kernel;
+#if defined(__SSE2__)
+    float               scale[4];           // FixedSse2: scale applied to each clamped component, zero if unused.
+    float               minVal[4];          // FixedSse2: lower clamp bound of each component.
+    uint32              laneMask[4];        // All ones for each component which maps to the data format.
+#endif
+};
+
 // =====================================================================================================================
-// Converts a floating-point representation of a color value to the appropriate bit representation for each channel
-// based on the specified format. This does not support the DepthStencilOnly or Undefined formats.
-// RGBA order is expected and no swizzling is performed except to maintain backwards compatability.
-void ConvertColor(
-    SwizzledFormat format,
-    const float*   pColorIn,
-    uint32*        pColorOut)
+// Resolves the per-component conversions for the given format.
+static void InitColorConvertInfo(
+    SwizzledFormat    format,
+    ColorConvertInfo* pConvertInfo)
 {
     const FormatInfo& info = FormatInfoTable[static_cast<size_t>(format.format)];
     PAL_ASSERT(((info.properties & BitCountInaccurate) == 0) && (info.bitsPerPixel <= 128));
 
-    if (format.format != ChNumFormat::X9Y9Z9E5_Float)
+    for (uint32 rgbaIdx = 0; rgbaIdx < 4; ++rgbaIdx)
     {
-        pColorOut[0] = 0;
-        pColorOut[1] = 0;
-        pColorOut[2] = 0;
-        pColorOut[3] = 0;
+        pConvertInfo->numericSupport[rgbaIdx] = NumericSupportFlags::Undefined;
+        pConvertInfo->numBits[rgbaIdx]        = 0;
 
-        for (uint32 rgbaIdx = 0; rgbaIdx < 4; ++rgbaIdx)
+        // If this RGBA component maps to any of the components on the data format
+        if ((format.swizzle.swizzle[rgbaIdx] >= ChannelSwizzle::X) &&
+            (format.swizzle.swizzle[rgbaIdx] <= ChannelSwizzle::W))
         {
-            // If this RGBA component maps to any of the components on the data format
-            if ((format.swizzle.swizzle[rgbaIdx] >= ChannelSwizzle::X) &&
-                (format.swizzle.swizzle[rgbaIdx] <= ChannelSwizzle::W))
-            {
-                // Map from RGBA to data format component index (compIdx = 0 = least-significant bit component)
-                uint32 compIdx =
-                    static_cast<uint32>(format.swizzle.swizzle[rgbaIdx]) - static_cast<uint32>(ChannelSwizzle::X);
-
-                // Get the number of bits of data format component using compIdx as there may be a swizzle
-                const uint32 numBits = info.bitCount[compIdx];
-
-                // Source RGBA component value
-                const float rgbaVal = pColorIn[rgbaIdx];
+            // Map from RGBA to data format component index (compIdx = 0 = least-significant bit component)
+            const uint32 compIdx =
+                static_cast<uint32>(format.swizzle.swizzle[rgbaIdx]) - static_cast<uint32>(ChannelSwizzle::X);
 
-                // Convert from RGBA float to data format component representation
-                uint32 compVal;
+            NumericSupportFlags numericSupport = info.numericSupport;
 
-                if (IsUnorm(format.format))
-                {
-                    compVal = FloatToUFixed(rgbaVal, 0, numBits, true);
-                }
-                else if (IsSnorm(format.format))
-                {
-                    compVal = FloatToSFixed(rgbaVal, 0, numBits, true);
-                }
-                else if (IsUscaled(format.format))
-                {
-                    compVal = FloatToUFixed(rgbaVal, numBits, 0, false);
-                }
-                else if (IsSscaled(format.format))
-                {
-                    compVal = FloatToSFixed(rgbaVal, numBits, 0, true);
-                }
-                else if (IsUint(format.format))
-                {
-                    // Integer conversion always truncates the fractional part
-                    compVal = FloatToUFixed(rgbaVal, numBits, 0, false);
-                }
-                else if (IsSint(format.format))
-                {
-                    // Integer conversion always truncates the fractional part
-                    compVal = FloatToSFixed(rgbaVal, numBits, 0, false);
-                }
-                else if (IsFloat(format.format))
-                {
-                    compVal = Float32ToNumBits(rgbaVal, numBits);
-                }
-                else if (IsSrgb(format.format))
-                {
-                    // sRGB conversions should never be applied to alpha channels.
-                    if (rgbaIdx == 3)
-                    {
-                        compVal = FloatToUFixed(rgbaVal, 0, numBits, true);
-                    }
-                    else
-                    {
-                        compVal = FloatToUFixed(LinearToGamma(rgbaVal), 0, numBits, true);
-                    }
-                }
-                else
+            switch (numericSupport)
+            {
+            case NumericSupportFlags::Unorm:
+            case NumericSupportFlags::Snorm:
+            case NumericSupportFlags::Uscaled:
+            case NumericSupportFlags::Sscaled:
+            case NumericSupportFlags::Uint:
+            case NumericSupportFlags::Sint:
+            case NumericSupportFlags::Float:
+                break;
+            case NumericSupportFlags::Srgb:
+                // sRGB conversions should never be applied to alpha channels.
+                if (rgbaIdx == 3)
                 {
-                    PAL_ASSERT_ALWAYS();
-                    compVal = 0;
+                    numericSupport = NumericSupportFlags::Unorm;
                 }
+                break;
+            default:
+                PAL_ASSERT_ALWAYS();
+                numericSupport = NumericSupportFlags::Undefined;
+                break;
+            }
 
-                // Write the converted value without swizzling
-                pColorOut[rgbaIdx] = compVal;
+            pConvertInfo->numericSupport[rgbaIdx] = numericSupport;
+            pConvertInfo->numBits[rgbaIdx]        = info.bitCount[compIdx];
+        }
+    }
+
+    pConvertInfo->kernel = (format.format == ChNumFormat::X9Y9Z9E5_Float) ? ColorConvertKernel::SharedExponent
+                                                                          : ColorConvertKernel::Generic;
+
+#if defined(__SSE2__)
+    if (pConvertInfo->kernel == ColorConvertKernel::Generic)
+    {
+        bool fixedOk   = true;
+        bool float16Ok = true;
+
+        for (uint32 rgbaIdx = 0; rgbaIdx < 4; ++rgbaIdx)
+        {
+            const NumericSupportFlags numericSupport = pConvertInfo->numericSupport[rgbaIdx];
+            const uint32              numBits        = pConvertInfo->numBits[rgbaIdx];
+            const bool                isUsed         = (numericSupport != NumericSupportFlags::Undefined);
+
+            // The fixed-point kernel skips FloatToUFixed/FloatToSFixed's final clamp. That is only exact while adding
+            // the rounding bias of 0.5 to the scaled value can't round up past the clamp value, which holds for up to
+            // 16 bits. Components mapped to a zero-bit channel stay on the generic path so their results don't change.
+            fixedOk &= ((isUsed == false) ||
+                        (((numericSupport == NumericSupportFlags::Unorm) ||
+                          (numericSupport == NumericSupportFlags::Snorm)) && (numBits > 0) && (numBits <= 16)));
+            float16Ok &= ((isUsed == false) || ((numericSupport == NumericSupportFlags::Float) && (numBits == 16)));
+
+            // Unused components get a scale and lower bound of zero, which the fixed-point kernel turns into zero.
+            uint32 scale = 0;
+
+            if ((numericSupport == NumericSupportFlags::Unorm) && (numBits > 0))
+            {
+                scale = (1u << numBits) - 1;
+            }
+            else if ((numericSupport == NumericSupportFlags::Snorm) && (numBits > 0))
+            {
+                scale = (1u << (numBits - 1)) - 1;
             }
+
+            pConvertInfo->scale[rgbaIdx]    = static_cast<float>(scale);
+            pConvertInfo->minVal[rgbaIdx]   = (numericSupport == NumericSupportFlags::Snorm) ? -1.0f : 0.0f;
+            pConvertInfo->laneMask[rgbaIdx] = isUsed ? UINT32_MAX : 0;
+        }
+
+        if (fixedOk)
+        {
+            pConvertInfo->kernel = ColorConvertKernel::FixedSse2;
+        }
+        else if (float16Ok)
+        {
+            pConvertInfo->kernel = ColorConvertKernel::Float16Sse2;
         }
     }
-    else
+#endif
+}
+
+#if defined(__SSE2__)
+// =====================================================================================================================
+// Converts all four components of a color whose used components are all Unorm or Snorm. Gives the same results as
+// FloatToUFixed(f, 0, numBits, true) and FloatToSFixed(f, 0, numBits, true).
+static void ConvertColorFixedSse2(
+    const ColorConvertInfo& convertInfo,
+    const float*            pColorIn,
+    uint32*                 pColorOut)
+{
+    const __m128 color = _mm_loadu_ps(pColorIn);
+
+    // Clamp to [minVal, 1] and scale. NaN inputs are zeroed below, so min/max's NaN handling doesn't matter.
+    __m128 value = _mm_min_ps(_mm_max_ps(color, _mm_loadu_ps(&convertInfo.minVal[0])), _mm_set1_ps(1.0f));
+    value        = _mm_mul_ps(value, _mm_loadu_ps(&convertInfo.scale[0]));
+
+    // Round half away from zero by adding 0.5 with the value's sign, then truncate. The clamped, scaled value is at
+    // most scale in magnitude, so the truncated result never exceeds the clamp value.
+    const __m128 half = _mm_or_ps(_mm_set1_ps(0.5f), _mm_and_ps(value, _mm_set1_ps(-0.0f)));
+    __m128i      out  = _mm_cvttps_epi32(_mm_add_ps(value, half));
+
+    out = _mm_and_si128(out, _mm_castps_si128(_mm_cmpord_ps(color, color)));
+    out = _mm_and_si128(out, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&convertInfo.laneMask[0])));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pColorOut), out);
+}
+
+// =====================================================================================================================
+// Selects a where mask is set and b elsewhere.
+static __m128i Select(
+    __m128i mask,
+    __m128i a,
+    __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+// =====================================================================================================================
+// Converts all four components of a color whose used components are all 16-bit floats. Gives the same results as
+// Float32ToFloat16, which rounds toward zero and clamps finite values to the largest half-float.
+static void ConvertColorFloat16Sse2(
+    const ColorConvertInfo& convertInfo,
+    const float*            pColorIn,
+    uint32*                 pColorOut)
+{
+    constexpr int32 MinNormal = 0x38800000; // 2^-14, the smallest normal half-float, as a float32.
+    constexpr int32 MaxNormal = 0x477FE000; // 65504, the largest finite half-float, as a float32.
+    constexpr int32 Infinity  = 0x7F800000;
+
+    const __m128i bits    = _mm_castps_si128(_mm_loadu_ps(pColorIn));
+    const __m128i absBits = _mm_and_si128(bits, _mm_set1_epi32(0x7FFFFFFF));
+    const __m128i sign    = _mm_and_si128(_mm_srli_epi32(bits, 16), _mm_set1_epi32(0x8000));
+
+    // Normal values: rebias the exponent and drop the low 13 mantissa bits.
+    const __m128i normal = _mm_srli_epi32(_mm_sub_epi32(absBits, _mm_set1_epi32(0x38000000)), 13);
+
+    // Denormal values are multiples of 2^-24, so scaling by 2^24 (which is exact) and truncating gives the mantissa.
+    const __m128i denorm = _mm_cvttps_epi32(_mm_mul_ps(_mm_castsi128_ps(absBits), _mm_set1_ps(16777216.0f)));
+
+    __m128i out = Select(_mm_cmplt_epi32(absBits, _mm_set1_epi32(MinNormal)), denorm, normal);
+    out = Select(_mm_cmpgt_epi32(absBits, _mm_set1_epi32(MaxNormal)), _mm_set1_epi32(0x7BFF), out);
+    out = Select(_mm_cmpeq_epi32(absBits, _mm_set1_epi32(Infinity)),  _mm_set1_epi32(0x7C00), out);
+    out = _mm_or_si128(out, sign);
+    out = Select(_mm_cmpgt_epi32(absBits, _mm_set1_epi32(Infinity)),  _mm_set1_epi32(0x7FFF), out);
+
+    out = _mm_and_si128(out, _mm_loadu_si128(reinterpret_cast<const __m128i*>(&convertInfo.laneMask[0])));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(pColorOut), out);
+}
+#endif
+
+// =====================================================================================================================
+// Converts a single color using conversions previously resolved by InitColorConvertInfo.
+static void ConvertColor(
+    const ColorConvertInfo& convertInfo,
+    const float*            pColorIn,
+    uint32*                 pColorOut)
+{
+    switch (convertInfo.kernel)
     {
+    case ColorConvertKernel::SharedExponent:
         ConvertColorToX9Y9Z9E5(pColorIn, &pColorOut[0]);
+        break;
+#if defined(__SSE2__)
+    case ColorConvertKernel::FixedSse2:
+        ConvertColorFixedSse2(convertInfo, pColorIn, pColorOut);
+        break;
+    case ColorConvertKernel::Float16Sse2:
+        ConvertColorFloat16Sse2(convertInfo, pColorIn, pColorOut);
+        break;
+#endif
+    default:
+        for (uint32 rgbaIdx = 0; rgbaIdx < 4; ++rgbaIdx)
+        {
+            const uint32 numBits = convertInfo.numBits[rgbaIdx];
+            const float  rgbaVal = pColorIn[rgbaIdx];
+
+            // Convert from RGBA float to data format component representation. Components which don't map to the
+            // data format are written as zero.
+            uint32 compVal = 0;
+
+            switch (convertInfo.numericSupport[rgbaIdx])
+            {
+            case NumericSupportFlags::Unorm:
+                compVal = FloatToUFixed(rgbaVal, 0, numBits, true);
+                break;
+            case NumericSupportFlags::Snorm:
+                compVal = FloatToSFixed(rgbaVal, 0, numBits, true);
+                break;
+            case NumericSupportFlags::Uscaled:
+                compVal = FloatToUFixed(rgbaVal, numBits, 0, false);
+                break;
+            case NumericSupportFlags::Sscaled:
+                compVal = FloatToSFixed(rgbaVal, numBits, 0, true);
+                break;
+            case NumericSupportFlags::Uint:
+                // Integer conversion always truncates the fractional part
+                compVal = FloatToUFixed(rgbaVal, numBits, 0, false);
+                break;
+            case NumericSupportFlags::Sint:
+                // Integer conversion always truncates the fractional part
+                compVal = FloatToSFixed(rgbaVal, numBits, 0, false);
+                break;
+            case NumericSupportFlags::Float:
+                compVal = Float32ToNumBits(rgbaVal, numBits);
+                break;
+            case NumericSupportFlags::Srgb:
+                compVal = FloatToUFixed(LinearToGamma(rgbaVal), 0, numBits, true);
+                break;
+            default:
+                break;
+            }
+
+            // Write the converted value without swizzling
+            pColorOut[rgbaIdx] = compVal;
+        }
+        break;
     }
 }
 
 // =====================================================================================================================
-// Packs the raw clear color into a single element of the provided format and stores it in the memory provided.
-// RGBA order is expected and no swizzling is performed except to maintain backwards compatability. A clear color
-// should never be swizzled after it is packed.
-void PackRawClearColor(
+// Converts a floating-point representation of a color value to the appropriate bit representation for each channel
+// based on the specified format. This does not support the DepthStencilOnly or Undefined formats.
+// RGBA order is expected and no swizzling is performed except to maintain backwards compatability.
+void ConvertColor(
     SwizzledFormat format,
-    const uint32*  pColor,
-    void*          pBufferMemory)
+    const float*   pColorIn,
+    uint32*        pColorOut)
+{
+    ColorConvertInfo convertInfo;
+    InitColorConvertInfo(format, &convertInfo);
+
+    ConvertColor(convertInfo, pColorIn, pColorOut);
+}
+
+// =====================================================================================================================
+// Converts an array of colors which all share the same format. Equivalent to calling ConvertColor once per color, but
+// the format is only examined once.
+void ConvertColors(
+    SwizzledFormat format,
+    uint32         colorCount,
+    const float*   pColorsIn,
+    uint32*        pColorsOut)
+{
+    ColorConvertInfo convertInfo;
+    InitColorConvertInfo(format, &convertInfo);
+
+    for (uint32 idx = 0; idx < colorCount; ++idx)
+    {
+        ConvertColor(convertInfo, &pColorsIn[idx * 4], &pColorsOut[idx * 4]);
+    }
+}
+
+// Where each component of a format lives within a packed element, resolved once per format by InitColorPackInfo.
+struct ColorPackInfo
 {
-    // This function relies on the component bit counts being accurate, and assumes a max of 4 DWORD components.
-    const auto& info = FormatInfoTable[static_cast<size_t>(format.format)];
+    uint32 dword[4];       // Which dword of the element holds each component.
+    uint32 shift[4];       // Bit offset of each component within its dword.
+    uint32 mask[4];        // Unshifted mask of each component, zero if the format doesn't have the component.
+    uint32 bytesPerPixel;  // Size of one packed element.
+};
+
+// =====================================================================================================================
+// Resolves the packed layout of the given format's components.
+static void InitColorPackInfo(
+    ChNumFormat    format,
+    ColorPackInfo* pPackInfo)
+{
+    // Packing relies on the component bit counts being accurate, and assumes a max of 4 DWORD components.
+    const FormatInfo& info = FormatInfoTable[static_cast<size_t>(format)];
     PAL_ASSERT(((info.properties & BitCountInaccurate) == 0) && (info.bitsPerPixel <= 128));
 
-    uint32 packedColor[4] = {};
-    uint32 bitCount       = 0;
-    uint32 dwordCount     = 0;
+    uint32 bitCount   = 0;
+    uint32 dwordCount = 0;
 
     for (uint32 compIdx = 0; compIdx < 4; compIdx++)
     {
         const uint32 compBitCount = info.bitCount[compIdx];
-        if (compBitCount > 0)
-        {
-            const uint64 mask = ((1ull << compBitCount) - 1ull) << bitCount;
 
-            packedColor[dwordCount] &= ~mask;
-            packedColor[dwordCount] |= ((static_cast<uint64>(pColor[compIdx]) << bitCount) & mask);
+        pPackInfo->dword[compIdx] = dwordCount;
+        pPackInfo->shift[compIdx] = bitCount;
+        pPackInfo->mask[compIdx]  = static_cast<uint32>((1ull << compBitCount) - 1ull);
 
+        if (compBitCount > 0)
+        {
             bitCount += compBitCount;
             PAL_ASSERT(bitCount <= 32);
 
@@ -281,8 +494,61 @@ void PackRawClearColor(
         }
     }
 
+    pPackInfo->bytesPerPixel = info.bitsPerPixel >> 3;
+}
+
+// =====================================================================================================================
+// Packs a single color using a layout previously resolved by InitColorPackInfo.
+static void PackRawClearColor(
+    const ColorPackInfo& packInfo,
+    const uint32*        pColor,
+    void*                pBufferMemory)
+{
+    uint32 packedColor[4] = {};
+
+    for (uint32 compIdx = 0; compIdx < 4; compIdx++)
+    {
+        packedColor[packInfo.dword[compIdx]] |= ((pColor[compIdx] & packInfo.mask[compIdx]) << packInfo.shift[compIdx]);
+    }
+
     // Copy the packed values into buffer memory.
-    memcpy(pBufferMemory, &packedColor[0], BytesPerPixel(format.format));
+    memcpy(pBufferMemory, &packedColor[0], packInfo.bytesPerPixel);
+}
+
+// =====================================================================================================================
+// Packs the raw clear color into a single element of the provided format and stores it in the memory provided.
+// RGBA order is expected and no swizzling is performed except to maintain backwards compatability. A clear color
+// should never be swizzled after it is packed.
+void PackRawClearColor(
+    SwizzledFormat format,
+    const uint32*  pColor,
+    void*          pBufferMemory)
+{
+    ColorPackInfo packInfo;
+    InitColorPackInfo(format.format, &packInfo);
+
+    PackRawClearColor(packInfo, pColor, pBufferMemory);
+}
+
+// =====================================================================================================================
+// Packs an array of raw colors which all share the same format into consecutive elements of the buffer memory.
+// Equivalent to calling PackRawClearColor once per color, but the format is only examined once.
+void PackRawClearColors(
+    SwizzledFormat format,
+    uint32         colorCount,
+    const uint32*  pColors,
+    void*          pBufferMemory)
+{
+    ColorPackInfo packInfo;
+    InitColorPackInfo(format.format, &packInfo);
+
+    uint8* pDst = static_cast<uint8*>(pBufferMemory);
+
+    for (uint32 idx = 0; idx < colorCount; ++idx)
+    {
+        PackRawClearColor(packInfo, &pColors[idx * 4], pDst);
+        pDst += packInfo.bytesPerPixel;
+    }
 }
 
 // =====================================================================================================================
@@ -103,6 +103,7 @@ void PlatformSettingsLoader::SetupDefaults()
     m_settings.gpuProfilerConfig.frameCount = 0;
     m_settings.gpuProfilerConfig.recordPipelineStats = false;
     m_settings.gpuProfilerConfig.breakSubmitBatches = false;
+    m_settings.gpuProfilerConfig.cacheIdleReplays = false;
     m_settings.gpuProfilerConfig.traceModeMask = 0x0;
     memset(m_settings.gpuProfilerPerfCounterConfig.globalPerfCounterConfigFile, 0, 256);
     strncpy(m_settings.gpuProfilerPerfCounterConfig.globalPerfCounterConfigFile, "", 256);
@@ -358,6 +359,11 @@ void PlatformSettingsLoader::ReadSettings(Pal::Device* pDevice)
                            &m_settings.gpuProfilerConfig.breakSubmitBatches,
                            InternalSettingScope::PrivatePalKey);
 
+    pDevice->ReadSetting(pGpuProfilerConfig_CacheIdleReplaysStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.gpuProfilerConfig.cacheIdleReplays,
+                           InternalSettingScope::PrivatePalKey);
+
     pDevice->ReadSetting(pGpuProfilerConfig_TraceModeMaskStr,
                            Util::ValueType::Uint,
                            &m_settings.gpuProfilerConfig.traceModeMask,
@@ -732,6 +738,11 @@ void PlatformSettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.gpuProfilerConfig.breakSubmitBatches);
     m_settingsInfoMap.Insert(3699637222, info);
 
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.gpuProfilerConfig.cacheIdleReplays;
+    info.valueSize = sizeof(m_settings.gpuProfilerConfig.cacheIdleReplays);
+    m_settingsInfoMap.Insert(1388091351, info);
+
     info.type      = SettingType::Uint;
     info.pValuePtr = &m_settings.gpuProfilerConfig.traceModeMask;
     info.valueSize = sizeof(m_settings.gpuProfilerConfig.traceModeMask);
@@ -141,6 +141,7 @@ struct PalPlatformSettings : public Pal::DriverSettings
         uint32                            frameCount;
         bool                              recordPipelineStats;
         bool                              breakSubmitBatches;
+        bool                              cacheIdleReplays;
         uint32                            traceModeMask;
     } gpuProfilerConfig;
     struct {
@@ -244,6 +245,7 @@ static const char* pGpuProfilerConfig_StartFrameStr = "#3281941262";
 static const char* pGpuProfilerConfig_FrameCountStr = "#3899735123";
 static const char* pGpuProfilerConfig_RecordPipelineStatsStr = "#3225763835";
 static const char* pGpuProfilerConfig_BreakSubmitBatchesStr = "#3699637222";
+static const char* pGpuProfilerConfig_CacheIdleReplaysStr = "#1388091351";
 static const char* pGpuProfilerConfig_TraceModeMaskStr = "#2733188403";
 static const char* pGpuProfilerPerfCounterConfig_GlobalPerfCounterConfigFileStr = "#2182449032";
 static const char* pGpuProfilerPerfCounterConfig_CacheFlushOnCounterCollectionStr = "#1201772335";
@@ -278,7 +280,7 @@ static const char* pInterfaceLoggerConfig_MultithreadedStr = "#800910225";
 static const char* pInterfaceLoggerConfig_BasePresetStr = "#2924533825";
 static const char* pInterfaceLoggerConfig_ElevatedPresetStr = "#4040226650";
 
-static const uint32 g_palPlatformNumSettings = 72;
+static const uint32 g_palPlatformNumSettings = 73;
 static const SettingNameHash g_palPlatformSettingHashList[] = {
 #if PAL_ENABLE_PRINTS_ASSERTS
 3336086055,
@@ -339,6 +341,7 @@ static const SettingNameHash g_palPlatformSettingHashList[] = {
 3899735123,
 3225763835,
 3699637222,
+1388091351,
 2733188403,
 2182449032,
 1201772335,
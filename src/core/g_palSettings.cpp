@@ -70,6 +70,7 @@ void SettingsLoader::SetupDefaults()
     m_settings.addr2DisableXorTileMode = false;
     m_settings.overlayReportHDR = true;
     m_settings.wholePipelineOptimizations = OptTrimUnusedOutputs;
+    m_settings.enablePipelineCodeCache = true;
     m_settings.forceHeapPerfToFixedValues = false;
     m_settings.cpuReadPerfForLocal = 1;
     m_settings.cpuWritePerfForLocal = 1;
@@ -113,6 +114,7 @@ void SettingsLoader::SetupDefaults()
     m_settings.cmdStreamEnableMemsetOnReserve = false;
     m_settings.cmdStreamMemsetValue = 4294967295;
     m_settings.cmdBufChunkEnableStagingBuffer = false;
+    m_settings.cmdStreamEnableCommitStaging = false;
     m_settings.cmdAllocatorFreeOnReset = false;
     m_settings.cmdBufOptimizePm4 = Pm4OptDefaultEnable;
     m_settings.cmdBufOptimizePm4Mode = Pm4OptModeImmediate;
@@ -235,6 +237,11 @@ void SettingsLoader::ReadSettings()
                            &m_settings.wholePipelineOptimizations,
                            InternalSettingScope::PrivatePalKey);
 
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pEnablePipelineCodeCacheStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.enablePipelineCodeCache,
+                           InternalSettingScope::PrivatePalKey);
+
     static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pForceHeapPerfToFixedValuesStr,
                            Util::ValueType::Boolean,
                            &m_settings.forceHeapPerfToFixedValues,
@@ -372,6 +379,11 @@ void SettingsLoader::ReadSettings()
                            &m_settings.cmdBufChunkEnableStagingBuffer,
                            InternalSettingScope::PrivatePalKey);
 
+    static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pCmdStreamEnableCommitStagingStr,
+                           Util::ValueType::Boolean,
+                           &m_settings.cmdStreamEnableCommitStaging,
+                           InternalSettingScope::PrivatePalKey);
+
     static_cast<Pal::Device*>(m_pDevice)->ReadSetting(pCmdAllocatorFreeOnResetStr,
                            Util::ValueType::Boolean,
                            &m_settings.cmdAllocatorFreeOnReset,
@@ -590,6 +602,11 @@ void SettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.wholePipelineOptimizations);
     m_settingsInfoMap.Insert(2263765076, info);
 
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.enablePipelineCodeCache;
+    info.valueSize = sizeof(m_settings.enablePipelineCodeCache);
+    m_settingsInfoMap.Insert(3584369341, info);
+
     info.type      = SettingType::Boolean;
     info.pValuePtr = &m_settings.forceHeapPerfToFixedValues;
     info.valueSize = sizeof(m_settings.forceHeapPerfToFixedValues);
@@ -795,6 +812,11 @@ void SettingsLoader::InitSettingsInfo()
     info.valueSize = sizeof(m_settings.cmdBufChunkEnableStagingBuffer);
     m_settingsInfoMap.Insert(169161685, info);
 
+    info.type      = SettingType::Boolean;
+    info.pValuePtr = &m_settings.cmdStreamEnableCommitStaging;
+    info.valueSize = sizeof(m_settings.cmdStreamEnableCommitStaging);
+    m_settingsInfoMap.Insert(2902923090, info);
+
     info.type      = SettingType::Boolean;
     info.pValuePtr = &m_settings.cmdAllocatorFreeOnReset;
     info.valueSize = sizeof(m_settings.cmdAllocatorFreeOnReset);
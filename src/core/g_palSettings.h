@@ -180,6 +180,7 @@ struct PalSettings : public Pal::DriverSettings
     bool                              addr2DisableXorTileMode;
     bool                              overlayReportHDR;
     PipelineOptFlags                  wholePipelineOptimizations;
+    bool                              enablePipelineCodeCache;
     bool                              forceHeapPerfToFixedValues;
     float                             cpuReadPerfForLocal;
     float                             cpuWritePerfForLocal;
@@ -223,6 +224,7 @@ struct PalSettings : public Pal::DriverSettings
     bool                              cmdStreamEnableMemsetOnReserve;
     uint32                            cmdStreamMemsetValue;
     bool                              cmdBufChunkEnableStagingBuffer;
+    bool                              cmdStreamEnableCommitStaging;
     bool                              cmdAllocatorFreeOnReset;
     Pm4OptEnable                      cmdBufOptimizePm4;
     Pm4OptMode                        cmdBufOptimizePm4Mode;
@@ -266,6 +268,7 @@ static const char* pAddr2Disable4KbSwizzleModeStr = "#2252676842";
 static const char* pAddr2DisableXorTileModeStr = "#576052426";
 static const char* pOverlayReportHDRStr = "#2354711641";
 static const char* pWholePipelineOptimizationsStr = "#2263765076";
+static const char* pEnablePipelineCodeCacheStr = "#3584369341";
 static const char* pForceHeapPerfToFixedValuesStr = "#2415703124";
 static const char* pAllocationListReusableStr = "#1727036994";
 static const char* pFenceTimeoutOverrideStr = "#970172817";
@@ -293,6 +296,7 @@ static const char* pCmdStreamReserveLimitStr = "#3843913604";
 static const char* pCmdStreamEnableMemsetOnReserveStr = "#3927521274";
 static const char* pCmdStreamMemsetValueStr = "#3661455441";
 static const char* pCmdBufChunkEnableStagingBufferStr = "#169161685";
+static const char* pCmdStreamEnableCommitStagingStr = "#2902923090";
 static const char* pCmdAllocatorFreeOnResetStr = "#1461164706";
 static const char* pCmdBufOptimizePm4Str = "#1018895288";
 static const char* pCmdBufOptimizePm4ModeStr = "#2490816619";
@@ -318,7 +322,7 @@ static const char* pPeerMemoryEnabledStr = "#259362511";
 static const char* pForcePresentViaGdiStr = "#2607871653";
 static const char* pPresentViaOglRuntimeStr = "#2466363770";
 
-static const uint32 g_palNumSettings = 83;
+static const uint32 g_palNumSettings = 85;
 static const SettingNameHash g_palSettingHashList[] = {
 4265240458,
 1901986348,
@@ -338,6 +342,7 @@ static const SettingNameHash g_palSettingHashList[] = {
 576052426,
 2354711641,
 2263765076,
+3584369341,
 2415703124,
 1067711036,
 2730570157,
@@ -379,6 +384,7 @@ static const SettingNameHash g_palSettingHashList[] = {
 3927521274,
 3661455441,
 169161685,
+2902923090,
 1461164706,
 1018895288,
 2490816619,
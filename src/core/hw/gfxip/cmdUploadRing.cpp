@@ -33,6 +33,7 @@
 #include "palInlineFuncs.h"
 #include "palQueueSemaphore.h"
 #include "palQueue.h"
+#include "palSysUtil.h"
 #include "palVectorImpl.h"
 
 using namespace Util;
@@ -55,21 +56,13 @@ size_t CmdUploadRing::GetPlacementSize(
     const size_t perRaftSize = device.GetQueueSemaphoreSize(signaledSemaphoreCreateInfo,   nullptr) +
                                device.GetQueueSemaphoreSize(unsignaledSemaphoreCreateInfo, nullptr);
 
-    CmdBufferCreateInfo cmdBufferCreateInfo = {};
-    cmdBufferCreateInfo.queueType     = QueueTypeDma;
-    cmdBufferCreateInfo.engineType    = EngineTypeDma;
-    cmdBufferCreateInfo.pCmdAllocator = device.InternalCmdAllocator(EngineTypeDma);
-
-    const size_t perCopySize = device.GetCmdBufferSize(cmdBufferCreateInfo, nullptr) +
-                               device.GetFenceSize(nullptr);
-
     QueueCreateInfo queueCreateInfo = {};
     queueCreateInfo.queueType  = QueueTypeDma;
     queueCreateInfo.engineType = EngineTypeDma;
 
+    // Copy slots are allocated separately because their number changes over time.
     return (device.GetQueueSize(queueCreateInfo, nullptr) +
-            (RaftRingSize * perRaftSize)                  +
-            (CopyRingSize * perCopySize));
+            (RaftRingSize * perRaftSize));
 }
 
 // =====================================================================================================================
@@ -96,7 +89,8 @@ CmdUploadRing::CmdUploadRing(
     m_pDevice(pDevice),
     m_pQueue(nullptr),
     m_prevRaft(0),
-    m_prevCopy(0),
+    m_copySlots(pDevice->GetPlatform()),
+    m_nextCopySlot(0),
     m_chunkMemoryRefs(pDevice->GetPlatform())
 {
     // If this trips we added a new stream to a command buffer type and MaxUploadedCmdStreams needs to be increased.
@@ -107,7 +101,7 @@ CmdUploadRing::CmdUploadRing(
     PAL_ASSERT(IsPowerOfTwo(m_sizeAlignBytes));
 
     memset(m_raft, 0, sizeof(m_raft));
-    memset(m_copy, 0, sizeof(m_copy));
+    memset(&m_stats, 0, sizeof(m_stats));
 }
 
 // =====================================================================================================================
@@ -147,17 +141,18 @@ CmdUploadRing::~CmdUploadRing()
         }
     }
 
-    for (uint32 idx = 0; idx < CopyRingSize; ++idx)
+    for (uint32 idx = 0; idx < m_copySlots.NumElements(); ++idx)
     {
-        if (m_copy[idx].pCmdBuffer != nullptr)
-        {
-            m_copy[idx].pCmdBuffer->Destroy();
-        }
+        DestroyCopy(&m_copySlots.At(idx));
+    }
 
-        if (m_copy[idx].pFence != nullptr)
-        {
-            m_copy[idx].pFence->Destroy();
-        }
+    if (m_stats.numStalls > 0)
+    {
+        PAL_DPINFO("CmdUploadRing stalled %u of %u uploads for %.3f ms total with %u copy slots.",
+                   m_stats.numStalls,
+                   m_stats.numUploads,
+                   (1000.0 * m_stats.stallTicks) / GetPerfFrequency(),
+                   m_stats.numCopySlots);
     }
 }
 
@@ -233,31 +228,87 @@ Result CmdUploadRing::Init(
         result = m_pDevice->AddGpuMemoryReferences(numMemRefs, memRefs, nullptr, GpuMemoryRefCantTrim);
     }
 
-    for (uint32 idx = 0; idx < CopyRingSize; ++idx)
+    for (uint32 idx = 0; (idx < InitialCopySlots) && (result == Result::Success); ++idx)
     {
+        Copy copy = {};
+        result = CreateCopy(&copy);
+
         if (result == Result::Success)
         {
-            CmdBufferCreateInfo createInfo = {};
-            createInfo.queueType     = QueueTypeDma;
-            createInfo.engineType    = EngineTypeDma;
-            createInfo.pCmdAllocator = m_pDevice->InternalCmdAllocator(EngineTypeDma);
+            result = m_copySlots.PushBack(copy);
 
-            result         = m_pDevice->CreateCmdBuffer(createInfo, pPlacementAddr, &m_copy[idx].pCmdBuffer);
-            pPlacementAddr = VoidPtrInc(pPlacementAddr, m_pDevice->GetCmdBufferSize(createInfo, nullptr));
+            if (result != Result::Success)
+            {
+                DestroyCopy(&copy);
+            }
         }
+    }
 
-        if (result == Result::Success)
-        {
-            Pal::FenceCreateInfo createInfo = {};
-            createInfo.flags.signaled       = 1;
-            result = m_pDevice->CreateFence(createInfo, pPlacementAddr, &m_copy[idx].pFence);
-            pPlacementAddr = VoidPtrInc(pPlacementAddr, m_pDevice->GetFenceSize(nullptr));
-        }
+    m_stats.numCopySlots = m_copySlots.NumElements();
+
+    return result;
+}
+
+// =====================================================================================================================
+// Creates a copy slot's command buffer and fence in a single system memory allocation. The fence starts out signaled
+// so that the slot is immediately available.
+Result CmdUploadRing::CreateCopy(
+    Copy* pCopy)
+{
+    CmdBufferCreateInfo cmdBufferCreateInfo = {};
+    cmdBufferCreateInfo.queueType     = QueueTypeDma;
+    cmdBufferCreateInfo.engineType    = EngineTypeDma;
+    cmdBufferCreateInfo.pCmdAllocator = m_pDevice->InternalCmdAllocator(EngineTypeDma);
+
+    Pal::FenceCreateInfo fenceCreateInfo = {};
+    fenceCreateInfo.flags.signaled       = 1;
+
+    const size_t cmdBufferSize = m_pDevice->GetCmdBufferSize(cmdBufferCreateInfo, nullptr);
+    const size_t fenceSize     = m_pDevice->GetFenceSize(nullptr);
+
+    Result result = Result::ErrorOutOfMemory;
+
+    pCopy->pMemory = PAL_MALLOC(cmdBufferSize + fenceSize, m_pDevice->GetPlatform(), AllocInternal);
+
+    if (pCopy->pMemory != nullptr)
+    {
+        result = m_pDevice->CreateCmdBuffer(cmdBufferCreateInfo, pCopy->pMemory, &pCopy->pCmdBuffer);
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_pDevice->CreateFence(fenceCreateInfo, VoidPtrInc(pCopy->pMemory, cmdBufferSize), &pCopy->pFence);
+    }
+
+    if (result != Result::Success)
+    {
+        DestroyCopy(pCopy);
     }
 
     return result;
 }
 
+// =====================================================================================================================
+// Destroys whatever parts of a copy slot were created. The caller must ensure the upload queue is done with it.
+void CmdUploadRing::DestroyCopy(
+    Copy* pCopy)
+{
+    if (pCopy->pCmdBuffer != nullptr)
+    {
+        pCopy->pCmdBuffer->Destroy();
+    }
+
+    if (pCopy->pFence != nullptr)
+    {
+        pCopy->pFence->Destroy();
+    }
+
+    PAL_SAFE_FREE(pCopy->pMemory, m_pDevice->GetPlatform());
+
+    pCopy->pCmdBuffer = nullptr;
+    pCopy->pFence     = nullptr;
+}
+
 // =====================================================================================================================
 // Conservatively estimates how many command buffers can be uploaded when calling UploadCmdBuffers.
 uint32 CmdUploadRing::PredictBatchSize(
@@ -321,16 +372,12 @@ Result CmdUploadRing::UploadCmdBuffers(
     // Uploading nothing doesn't make sense, we assume we always have at least one command buffer.
     PAL_ASSERT(cmdBufferCount > 0);
 
-    // Get the next set of state from our two rings.
+    // Get the next raft and an idle copy slot.
     Raft*const pRaft = NextRaft();
-    Copy*const pCopy = NextCopy();
-
-    // Wait for the prior use of this command copy command buffer to be idle.
-    // If the alert trips we should increase the size of the copy ring.
-    PAL_ALERT(pCopy->pFence->GetStatus() == Result::NotReady);
+    Copy*      pCopy = nullptr;
+    Result     result = AcquireCopy(&pCopy);
 
-    constexpr uint64 TwoSeconds = 2000000000ull;
-    Result           result     = m_pDevice->WaitForFences(1, &pCopy->pFence, true, TwoSeconds);
+    m_stats.numUploads++;
 
     if (result == Result::Success)
     {
@@ -585,13 +632,102 @@ CmdUploadRing::Raft* CmdUploadRing::NextRaft()
 }
 
 // =====================================================================================================================
-CmdUploadRing::Copy* CmdUploadRing::NextCopy()
+// Returns the index of the first copy slot at or after m_nextCopySlot whose previous upload has finished, or the number
+// of copy slots if all of them are still busy. This only polls the fences; it never blocks.
+uint32 CmdUploadRing::FindIdleCopy() const
 {
-    // Wrap the ring index using bit masking which works if the size is a power of two.
-    PAL_ASSERT(IsPowerOfTwo(CopyRingSize));
-    m_prevCopy = (m_prevCopy + 1) & (CopyRingSize - 1);
+    const uint32 numSlots = m_copySlots.NumElements();
+    uint32       idleSlot = numSlots;
+
+    for (uint32 idx = 0; (idx < numSlots) && (idleSlot == numSlots); ++idx)
+    {
+        const uint32 slot = (m_nextCopySlot + idx) % numSlots;
+
+        // Anything but NotReady means the upload queue isn't using the slot. Errors such as a lost device will be
+        // reported again when the slot is reset and submitted.
+        if (m_copySlots.At(slot).pFence->GetStatus() != Result::NotReady)
+        {
+            idleSlot = slot;
+        }
+    }
+
+    return idleSlot;
+}
+
+// =====================================================================================================================
+// Finds a copy slot which the upload queue is done with. If every slot is busy we add a new slot rather than wait, up
+// to MaxCopySlots. Only once the pool is full do we block, and then only until any one slot becomes idle.
+Result CmdUploadRing::AcquireCopy(
+    Copy** ppCopy)
+{
+    Result result   = Result::Success;
+    uint32 numSlots = m_copySlots.NumElements();
+    uint32 slot     = FindIdleCopy();
+
+    if ((slot == numSlots) && (numSlots < MaxCopySlots))
+    {
+        Copy copy = {};
+        result = CreateCopy(&copy);
+
+        if (result == Result::Success)
+        {
+            result = m_copySlots.PushBack(copy);
+
+            if (result != Result::Success)
+            {
+                DestroyCopy(&copy);
+            }
+        }
+
+        if (result == Result::Success)
+        {
+            // The new slot sits at index "slot" and its fence starts out signaled.
+            numSlots             = m_copySlots.NumElements();
+            m_stats.numCopySlots = numSlots;
+        }
+        else
+        {
+            // Growing is only an optimization; fall back to waiting on the slots we have.
+            result = Result::Success;
+        }
+    }
+
+    if (slot == numSlots)
+    {
+        // Every slot is busy and we can't add another, so wait for whichever one finishes first.
+        const IFence* pFences[MaxCopySlots] = {};
+
+        for (uint32 idx = 0; idx < numSlots; ++idx)
+        {
+            pFences[idx] = m_copySlots.At(idx).pFence;
+        }
+
+        const int64      stallStart = GetPerfCpuTime();
+        constexpr uint64 TwoSeconds = 2000000000ull;
+
+        result = m_pDevice->WaitForFences(numSlots, &pFences[0], false, TwoSeconds);
 
-    return &m_copy[m_prevCopy];
+        m_stats.numStalls++;
+        m_stats.stallTicks += static_cast<uint64>(GetPerfCpuTime() - stallStart);
+
+        if (result == Result::Success)
+        {
+            slot = FindIdleCopy();
+            PAL_ASSERT(slot < numSlots);
+        }
+    }
+
+    if ((result == Result::Success) && (slot < numSlots))
+    {
+        m_nextCopySlot = (slot + 1) % numSlots;
+        (*ppCopy)      = &m_copySlots.At(slot);
+    }
+    else if (result == Result::Success)
+    {
+        result = Result::ErrorUnknown;
+    }
+
+    return result;
 }
 
 // =====================================================================================================================
@@ -72,6 +72,15 @@ struct UploadedCmdBufferInfo
     IQueueSemaphore*   pExecutionComplete;                // The caller must signal this when done executing.
 };
 
+// Counters describing how often uploads had to wait on the CPU for a free copy slot.
+struct CmdUploadRingStats
+{
+    uint32 numUploads;   // Number of calls to UploadCmdBuffers.
+    uint32 numCopySlots; // Current size of the copy slot pool.
+    uint32 numStalls;    // Number of uploads which found every copy slot busy and had to wait for one.
+    uint64 stallTicks;   // Total time spent in those waits, in GetPerfCpuTime() ticks.
+};
+
 // Gfxip-independent information provided by the creator.
 struct CmdUploadRingCreateInfo
 {
@@ -102,6 +111,8 @@ public:
 
     const IQueue* UploadQueue() const { return m_pQueue; }
 
+    const CmdUploadRingStats& GetStats() const { return m_stats; }
+
 protected:
     static size_t GetPlacementSize(const Device& device);
 
@@ -128,7 +139,11 @@ protected:
 
 private:
     Raft* NextRaft();
-    Copy* NextCopy();
+
+    Result AcquireCopy(Copy** ppCopy);
+    uint32 FindIdleCopy() const;
+    Result CreateCopy(Copy* pCopy);
+    void DestroyCopy(Copy* pCopy);
 
     void EndCurrentIb(
         const IGpuMemory& raftMemory,
@@ -160,6 +175,7 @@ private:
     // so we expect to have many more of these objects than memory rafts.
     struct Copy
     {
+        void*       pMemory;    // System memory holding both objects below.
         ICmdBuffer* pCmdBuffer;
         IFence*     pFence;
     };
@@ -179,15 +195,21 @@ private:
         gpusize launchBytes;           // The size of the first uploaded IB (the size of the IB the KMD will launch).
     };
 
-    static constexpr gpusize RaftMemBytes = 256 * 1024; // The size of each raft's GPU memory object.
-    static constexpr uint32  RaftRingSize = 2;
-    static constexpr uint32  CopyRingSize = 4;
+    static constexpr gpusize RaftMemBytes     = 256 * 1024; // The size of each raft's GPU memory object.
+    static constexpr uint32  RaftRingSize     = 2;
+    static constexpr uint32  InitialCopySlots = 4;          // Copy slots created up front.
+    static constexpr uint32  MaxCopySlots     = 32;         // The copy slot pool never grows beyond this.
 
     IQueue* m_pQueue;             // All commands will be uploaded on this queue.
     Raft    m_raft[RaftRingSize];
-    Copy    m_copy[CopyRingSize];
-    uint32  m_prevRaft;           // These are the indices of the previously used items in each ring.
-    uint32  m_prevCopy;
+    uint32  m_prevRaft;           // The index of the previously used raft.
+
+    // Copy slots are handed out round-robin, skipping any which the upload queue is still using. The pool grows when
+    // every slot is busy, and uploads only block on the CPU once it has reached MaxCopySlots.
+    Util::Vector<Copy, InitialCopySlots, Platform> m_copySlots;
+    uint32                                         m_nextCopySlot;
+
+    CmdUploadRingStats m_stats;
 
     // We must keep track of which command chunk allocations will be read by the upload queue.
     Util::Vector<GpuMemoryRef, 32, Platform> m_chunkMemoryRefs;
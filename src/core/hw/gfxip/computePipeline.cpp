@@ -24,8 +24,10 @@
  **********************************************************************************************************************/
 
 #include "core/hw/gfxip/computePipeline.h"
+#include "core/hw/gfxip/gfxDevice.h"
 #include "palMetroHash.h"
 #include "palPipelineAbiProcessorImpl.h"
+#include "palSysUtil.h"
 
 using namespace Util;
 
@@ -74,12 +76,94 @@ Result ComputePipeline::Init(
     if (result == Result::Success)
     {
         PAL_ASSERT(m_pPipelineBinary != nullptr);
-        result = InitFromPipelineBinary(createInfo);
+
+        // Indirect function addresses are reported back through the create info, so those pipelines always go
+        // through the full initialization path.
+        bool useObjectCache = ((IsInternal() == false) &&
+                               SupportsObjectCache()   &&
+                               m_pDevice->GetGfxDevice()->GetPipelineObjectCache()->IsEnabled());
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 440
+        useObjectCache &= (createInfo.indirectFuncCount == 0);
+#endif
+
+        if (useObjectCache)
+        {
+            result = InitThroughObjectCache(createInfo);
+        }
+        else
+        {
+            result = InitFromPipelineBinary(createInfo);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Initializes this pipeline through the device's PipelineObjectCache.  On a hit, the cached prototype's state is copied.
+// On a miss, an internal prototype is created from the same create info and adopted by this pipeline.
+Result ComputePipeline::InitThroughObjectCache(
+    const ComputePipelineCreateInfo& createInfo)
+{
+#if PAL_DEVELOPER_CPU_EVENTS
+    const int64 startTime = GetPerfCpuTime();
+#endif
+
+    MetroHash128 hasher;
+    hasher.Update(static_cast<const uint8*>(m_pPipelineBinary), m_pipelineBinaryLen);
+    hasher.Update(createInfo.flags.u32All);
+
+    MetroHash::Hash hash = { };
+    hasher.Finalize(hash.bytes);
+
+    Result result = Result::Success;
+
+    if (CopyFromCachedPrototype(hash))
+    {
+#if PAL_DEVELOPER_CPU_EVENTS
+        const PipelineObjectCache& cache = *m_pDevice->GetGfxDevice()->GetPipelineObjectCache();
+
+        Developer::PipelineCpuData cpuData = {};
+        cpuData.internalPipelineHash = m_info.internalPipelineHash;
+        cpuData.palRuntimeHash       = m_info.palRuntimeHash;
+        cpuData.isCompute            = true;
+        cpuData.cpuTimestamp         = GetPerfCpuTime();
+        cpuData.hwlInitCpuTime       = cpuData.cpuTimestamp - startTime;
+        cpuData.objectCacheHit       = true;
+        cpuData.objectCacheHits      = cache.NumHits();
+        cpuData.objectCacheMisses    = cache.NumMisses();
+
+        m_pDevice->DeveloperCb(Developer::CallbackType::CreatePipeline, &cpuData);
+#endif
+    }
+    else
+    {
+        ComputePipeline* pPrototype = nullptr;
+        result = m_pDevice->GetGfxDevice()->CreateComputePipelineInternal(createInfo, &pPrototype, AllocInternal);
+
+        if (result == Result::Success)
+        {
+            AdoptPrototype(hash, pPrototype);
+        }
     }
 
     return result;
 }
 
+// =====================================================================================================================
+void ComputePipeline::CopyStateFrom(
+    const Pipeline& prototype)
+{
+    Pipeline::CopyStateFrom(prototype);
+
+    const auto& computePrototype = static_cast<const ComputePipeline&>(prototype);
+
+    m_threadsPerTgX = computePrototype.m_threadsPerTgX;
+    m_threadsPerTgY = computePrototype.m_threadsPerTgY;
+    m_threadsPerTgZ = computePrototype.m_threadsPerTgZ;
+    m_stageInfo     = computePrototype.m_stageInfo;
+}
+
 // =====================================================================================================================
 // Computes the GPU virtual address of each of the indirect functions specified by the client.
 void ComputePipeline::GetFunctionGpuVirtAddrs(
@@ -106,17 +190,31 @@ Result ComputePipeline::InitFromPipelineBinary(
 {
     PAL_ASSERT((m_pPipelineBinary != nullptr) && (m_pipelineBinaryLen != 0));
 
+#if PAL_DEVELOPER_CPU_EVENTS
+    Developer::PipelineCpuData cpuData = {};
+    cpuData.isCompute = true;
+
+    const int64 startTime = GetPerfCpuTime();
+#endif
+
     AbiProcessor abiProcessor(m_pDevice->GetPlatform());
     Result result = abiProcessor.LoadFromBuffer(m_pPipelineBinary, m_pipelineBinaryLen);
 
     MsgPackReader      metadataReader;
     CodeObjectMetadata metadata;
+    bool               diskCacheHit = false;
 
     if (result == Result::Success)
     {
-        result = abiProcessor.GetMetadata(&metadataReader, &metadata);
+        result = GetCodeObjectMetadata(abiProcessor, &metadataReader, &metadata, &diskCacheHit);
     }
 
+#if PAL_DEVELOPER_CPU_EVENTS
+    const int64 elfParsedTime = GetPerfCpuTime();
+    cpuData.elfParseCpuTime   = elfParsedTime - startTime;
+    cpuData.diskCacheHit      = diskCacheHit;
+#endif
+
     if (result == Result::Success)
     {
         ExtractPipelineInfo(metadata, ShaderType::Compute, ShaderType::Compute);
@@ -142,8 +240,23 @@ Result ComputePipeline::InitFromPipelineBinary(
                          createInfo.indirectFuncCount,
 #endif
                          &metadataReader);
+
+#if PAL_DEVELOPER_CPU_EVENTS
+        cpuData.cpuTimestamp   = GetPerfCpuTime();
+        cpuData.hwlInitCpuTime = cpuData.cpuTimestamp - elfParsedTime;
+#endif
     }
 
+#if PAL_DEVELOPER_CPU_EVENTS
+    if (result == Result::Success)
+    {
+        cpuData.internalPipelineHash = m_info.internalPipelineHash;
+        cpuData.palRuntimeHash       = m_info.palRuntimeHash;
+
+        m_pDevice->DeveloperCb(Developer::CallbackType::CreatePipeline, &cpuData);
+    }
+#endif
+
     return result;
 }
 
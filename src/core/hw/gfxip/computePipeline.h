@@ -77,10 +77,15 @@ protected:
 
     ShaderStageInfo  m_stageInfo;
 
+    virtual void CopyStateFrom(const Pipeline& prototype) override;
+
 private:
     Result InitFromPipelineBinary(
         const ComputePipelineCreateInfo& createInfo);
 
+    Result InitThroughObjectCache(
+        const ComputePipelineCreateInfo& createInfo);
+
     PAL_DISALLOW_COPY_AND_ASSIGN(ComputePipeline);
 };
 
@@ -594,6 +594,10 @@ uint32* ComputeCmdBuffer::ValidateDispatch(
     uint32  zDim,
     uint32* pCmdSpace)
 {
+#if PAL_DEVELOPER_CPU_EVENTS
+    m_cpuEventCounts.dispatches++;
+#endif
+
     if (m_computeState.pipelineState.dirtyFlags.pipelineDirty)
     {
         const auto*const pNewPipeline = static_cast<const ComputePipeline*>(m_computeState.pipelineState.pPipeline);
@@ -39,70 +39,33 @@ ComputeEngine::ComputeEngine(
     uint32     index)
     :
     Engine(*pDevice->Parent(), type, index),
-    m_pDevice(pDevice),
-    m_ringSet(pDevice),
-    m_currentUpdateCounter(0)
+    m_ringSetMgr(pDevice, this, true)
 {
 }
 
 // =====================================================================================================================
-Result ComputeEngine::Init()
+ComputeEngine::~ComputeEngine()
 {
-    Result result = Engine::Init();
-
-    if (result == Result::Success)
-    {
-        result = m_ringSet.Init();
-    }
-
-    return result;
+#if PAL_ENABLE_PRINTS_ASSERTS
+    const ShaderRingSetStats& stats = m_ringSetMgr.Stats();
+    PAL_DPINFO("Compute engine %u ring set updates: %u prepared, %u swapped at submit, %u reallocated at submit.",
+               m_index,
+               stats.numPrepared,
+               stats.numSwaps,
+               stats.numReallocs);
+#endif
 }
 
 // =====================================================================================================================
-Result ComputeEngine::UpdateRingSet(
-    uint32* pCounterVal,  // [in, out] As input is the currently known counter value of the QueueContext.
-                          //           On output, this is the current counter value.
-    bool*   pHasChanged)  // [out]     Whether or not the ring set has updated. If true the ring set must rewrite its
-                          //           registers.
+Result ComputeEngine::Init()
 {
-    PAL_ALERT((pCounterVal == nullptr) || (pHasChanged == nullptr));
-
-    Result result = Result::Success;
-
-    // Check if the queue context associated with this Queue is dirty, and obtain the ring item-sizes to validate
-    // against.
-    const uint32 currentCounter = m_pDevice->QueueContextUpdateCounter();
+    Result result = Engine::Init();
 
-    if (currentCounter > m_currentUpdateCounter)
+    if (result == Result::Success)
     {
-        m_currentUpdateCounter = currentCounter;
-
-        ShaderRingItemSizes ringSizes = {};
-        m_pDevice->GetLargestRingSizes(&ringSizes);
-
-        SamplePatternPalette samplePatternPalette;
-        m_pDevice->GetSamplePatternPalette(&samplePatternPalette);
-
-        // The ring-set may be dirty. First, we need to idle all queues so that we can reallocate the rings and update
-        // the ring-set's SRD table.
-        // This wait-for-idle is expensive, but it is expected that after a few frames, the application will reach a
-        // steady-state and no longer need to do any validation at submit-time.
-        //
-        // NOTE: If a batched command generates a submit which triggers ring validation we are in deep trouble because
-        // some of the commands further down in the batched queue might assume that the preamble stream hasn't been
-        // rebuilt. To prevent this, this preprocessing is done before the submission has a chance to be batched.
-        result = WaitIdleAllQueues();
-
-        // The queues are idle, so it is safe to validate the rest of the RingSet.
-        if (result == Result::Success)
-        {
-            result = m_ringSet.Validate(ringSizes, samplePatternPalette);
-        }
+        result = m_ringSetMgr.Init();
     }
 
-    (*pHasChanged) = (m_currentUpdateCounter > (*pCounterVal));
-    (*pCounterVal) = m_currentUpdateCounter;
-
     return result;
 }
 
@@ -41,18 +41,18 @@ public:
         Device*    pDevice,
         EngineType type,
         uint32     index);
+    virtual ~ComputeEngine();
 
     virtual Result Init() override;
 
-    ComputeRingSet* RingSet() { return &m_ringSet; }
+    ComputeRingSet* RingSet() { return static_cast<ComputeRingSet*>(m_ringSetMgr.RingSet()); }
 
-    Result UpdateRingSet(uint32* pCounterVal, bool* pHasChanged);
+    Result UpdateRingSet(uint32* pCounterVal, bool* pHasChanged)
+        { return m_ringSetMgr.UpdateRingSet(pCounterVal, pHasChanged); }
+    Result PrepareRingSet() { return m_ringSetMgr.PrepareRingSet(); }
 
 private:
-    Device*        m_pDevice;
-    ComputeRingSet m_ringSet;
-    uint32         m_currentUpdateCounter;  // Current watermark for the device-initiated context updates that have been
-                                            // processed by this engine.
+    ShaderRingSetMgr m_ringSetMgr;
 
     PAL_DISALLOW_COPY_AND_ASSIGN(ComputeEngine);
     PAL_DISALLOW_DEFAULT_CTOR(ComputeEngine);
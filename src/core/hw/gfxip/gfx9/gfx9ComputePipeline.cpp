@@ -75,6 +75,19 @@ ComputePipeline::ComputePipeline(
     memcpy(&m_signature, &NullCsSignature, sizeof(m_signature));
 }
 
+// =====================================================================================================================
+// Copies the register images and signature of a prototype pipeline created from an identical ELF and create info.
+void ComputePipeline::CopyStateFrom(
+    const Pal::Pipeline& prototype)
+{
+    Pal::ComputePipeline::CopyStateFrom(prototype);
+
+    const auto& gfx9Prototype = static_cast<const ComputePipeline&>(prototype);
+
+    m_signature = gfx9Prototype.m_signature;
+    m_commands  = gfx9Prototype.m_commands;
+}
+
 // =====================================================================================================================
 // Initializes the signature of a compute pipeline using a pipeline ELF.
 void ComputePipeline::SetupSignatureFromElf(
@@ -70,6 +70,9 @@ protected:
 #endif
         Util::MsgPackReader*             pMetadataReader) override;
 
+    virtual void CopyStateFrom(const Pal::Pipeline& prototype) override;
+    virtual bool SupportsObjectCache() const override { return true; }
+
 private:
     uint32 CalcMaxWavesPerSh(uint32 maxWavesPerCu) const;
 
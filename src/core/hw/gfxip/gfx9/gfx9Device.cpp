@@ -910,27 +910,101 @@ uint32 Device::GetValidFormatFeatureFlags(
 void Device::UpdateLargestRingSizes(
     const ShaderRingItemSizes* pRingSizesNeeded)
 {
-    const MutexAuto lock(&m_ringSizesLock);
-
-    // Loop over all ring sizes and check if the ring sizes need to grow at all.
     bool ringSizesDirty = false;
-    for (size_t ring = 0; ring < static_cast<size_t>(ShaderRingType::NumUniversal); ++ring)
+
     {
-        if (pRingSizesNeeded->itemSize[ring] > m_largestRingSizes.itemSize[ring])
+        const MutexAuto lock(&m_ringSizesLock);
+
+        // Loop over all ring sizes and check if the ring sizes need to grow at all.
+        for (size_t ring = 0; ring < static_cast<size_t>(ShaderRingType::NumUniversal); ++ring)
         {
-            m_largestRingSizes.itemSize[ring] = pRingSizesNeeded->itemSize[ring];
-            ringSizesDirty = true;
+            if (pRingSizesNeeded->itemSize[ring] > m_largestRingSizes.itemSize[ring])
+            {
+                m_largestRingSizes.itemSize[ring] = pRingSizesNeeded->itemSize[ring];
+                ringSizesDirty = true;
+            }
+        }
+
+        // If the ring sizes are dirty, update the queue context counter so that all queue contexts will be rebuilt
+        // before their next submission.
+        if (ringSizesDirty)
+        {
+            m_queueContextUpdateCounter++;
         }
     }
 
-    // If the ring sizes are dirty, update the queue context counter so that all queue contexts will be rebuilt before
-    // their next submission.
-    if (ringSizesDirty)
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+    // Growing the rings allocates GPU memory, so do it outside of the ring-sizes lock.
+    if (ringSizesDirty && Parent()->GetPublicSettings()->eagerShaderRingGrowth)
     {
-        m_queueContextUpdateCounter++;
+        PrepareEngineRingSets();
     }
+#endif
 }
 
+// =====================================================================================================================
+// Grows a standby ring set on every engine which owns shader rings, so that the engines' next submits can switch to the
+// larger rings without idling their queues. Failing to do so is not fatal: the submit falls back to growing the rings
+// in place.
+void Device::PrepareEngineRingSets()
+{
+    for (uint32 engineType = 0; engineType < EngineTypeCount; ++engineType)
+    {
+        for (uint32 engineIndex = 0; engineIndex < MaxAvailableEngines; ++engineIndex)
+        {
+            Engine* const pEngine = m_pParent->GetEngine(static_cast<EngineType>(engineType), engineIndex);
+            Result        result  = Result::Success;
+
+            if (pEngine != nullptr)
+            {
+                switch (pEngine->Type())
+                {
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION < 431
+                case EngineTypeHighPriorityGraphics:
+#endif
+                case EngineTypeHighPriorityUniversal:
+                case EngineTypeUniversal:
+                    result = static_cast<UniversalEngine*>(pEngine)->PrepareRingSet();
+                    break;
+                case EngineTypeCompute:
+                case EngineTypeExclusiveCompute:
+                    result = static_cast<ComputeEngine*>(pEngine)->PrepareRingSet();
+                    break;
+                default:
+                    break;
+                }
+            }
+
+            PAL_ALERT(result != Result::Success);
+        }
+    }
+}
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+// =====================================================================================================================
+// Converts the client's expected pipeline requirements into ring item-sizes so that the first submit on each queue
+// allocates rings which are large enough for all of the client's pipelines.
+void Device::ApplyShaderRingSizeHints(
+    const ShaderRingSizeHints& hints)
+{
+    ShaderRingItemSizes ringSizes = { };
+
+    // Scratch item-sizes are measured in DWORDs per thread.
+    ringSizes.itemSize[static_cast<size_t>(ShaderRingType::GfxScratch)]     = hints.scratchMemorySize / sizeof(uint32);
+    ringSizes.itemSize[static_cast<size_t>(ShaderRingType::ComputeScratch)] = hints.scratchMemorySize / sizeof(uint32);
+    ringSizes.itemSize[static_cast<size_t>(ShaderRingType::GsVs)]           = hints.gsVsRingItemSize;
+
+    if (hints.tessellation)
+    {
+        // See GraphicsPipeline::UpdateRingSizes() for the meaning of the tessellation ring item-sizes.
+        ringSizes.itemSize[static_cast<size_t>(ShaderRingType::TfBuffer)]   = 1;
+        ringSizes.itemSize[static_cast<size_t>(ShaderRingType::OffChipLds)] = Settings().numOffchipLdsBuffers;
+    }
+
+    UpdateLargestRingSizes(&ringSizes);
+}
+#endif
+
 // =====================================================================================================================
 // Copy our largest ring item-sizes to the caller's output buffer so they know what to validate against.
 void Device::GetLargestRingSizes(
@@ -3564,12 +3638,10 @@ PM4PFP_CONTEXT_CONTROL Device::GetContextControl() const
 // composed of multiple, small chunks as required by the workaround.  For each modified region, a chunkAddr is reported
 // that is the VA where the region begins in memory.
 Result Device::P2pBltWaModifyRegionListMemory(
-    const IGpuMemory&       dstGpuMemory,
-    uint32                  regionCount,
-    const MemoryCopyRegion* pRegions,
-    uint32*                 pNewRegionCount,
-    MemoryCopyRegion*       pNewRegions,
-    gpusize*                pChunkAddrs
+    const IGpuMemory&                     dstGpuMemory,
+    uint32                                regionCount,
+    const MemoryCopyRegion*               pRegions,
+    P2pBltWaRegionList<MemoryCopyRegion>* pNewRegions
     ) const
 {
     Result result = Result::Success;
@@ -3577,13 +3649,6 @@ Result Device::P2pBltWaModifyRegionListMemory(
     const gpusize maxChunkSize = Parent()->ChipProperties().p2pBltWaInfo.maxCopyChunkSize;
     const gpusize baseVa       = dstGpuMemory.Desc().gpuVirtAddr;
 
-    struct LookupItem
-    {
-        MemoryCopyRegion region;
-        gpusize          chunkAddr;
-    };
-    Deque<LookupItem, Platform> lookupList(GetPlatform());
-
     bool    needBiggerRegionList = false;
     gpusize chunkVa              = 0;
 
@@ -3606,10 +3671,7 @@ Result Device::P2pBltWaModifyRegionListMemory(
                 region.dstOffset              = pRegions[i].dstOffset + transferredSize;
                 region.copySize               = currentCopySize;
 
-                LookupItem regionItem         = {};
-                regionItem.region             = region;
-                regionItem.chunkAddr          = baseVa + region.dstOffset;
-                result                        = lookupList.PushBack(regionItem);
+                result = pNewRegions->PushBack(region, baseVa + region.dstOffset);
             }
         }
         else
@@ -3624,43 +3686,19 @@ Result Device::P2pBltWaModifyRegionListMemory(
                 chunkVa = startVa;
             }
 
-            LookupItem regionItem = {};
-            regionItem.region     = pRegions[i];
-            regionItem.chunkAddr  = chunkVa;
-            result                = lookupList.PushBack(regionItem);
+            result = pNewRegions->PushBack(pRegions[i], chunkVa);
         }
     }
 
-    const uint32 newRegionCount = static_cast<uint32>(lookupList.NumElements());
-
     if (result == Result::Success)
     {
-        if (pNewRegions == nullptr)
+        if (needBiggerRegionList)
         {
-            // Query size required for new region list.
-            if (needBiggerRegionList)
-            {
-                PAL_ASSERT(newRegionCount > regionCount);
-            }
-            else
-            {
-                PAL_ASSERT(newRegionCount == regionCount);
-            }
-
-            *pNewRegionCount = newRegionCount;
+            PAL_ASSERT(pNewRegions->NumRegions() > regionCount);
         }
         else
         {
-            // Fill new regions into region list.
-            PAL_ASSERT(newRegionCount == *pNewRegionCount);
-
-            auto iter = lookupList.Begin();
-            for (uint32 i = 0; i < newRegionCount; i++)
-            {
-                pNewRegions[i] = iter.Get()->region;
-                pChunkAddrs[i] = iter.Get()->chunkAddr;
-                iter.Next();
-            }
+            PAL_ASSERT(pNewRegions->NumRegions() == regionCount);
         }
     }
 
@@ -3672,13 +3710,11 @@ Result Device::P2pBltWaModifyRegionListMemory(
 // composed of multiple, small chunks as required by the workaround.  For each modified region, a chunkAddr is reported
 // that is the VA where the region begins in memory.
 Result Device::P2pBltWaModifyRegionListImage(
-    const Pal::Image&      srcImage,
-    const Pal::Image&      dstImage,
-    uint32                 regionCount,
-    const ImageCopyRegion* pRegions,
-    uint32*                pNewRegionCount,
-    ImageCopyRegion*       pNewRegions,
-    gpusize*               pChunkAddrs
+    const Pal::Image&                    srcImage,
+    const Pal::Image&                    dstImage,
+    uint32                               regionCount,
+    const ImageCopyRegion*               pRegions,
+    P2pBltWaRegionList<ImageCopyRegion>* pNewRegions
     ) const
 {
     Result result = Result::Success;
@@ -3686,13 +3722,6 @@ Result Device::P2pBltWaModifyRegionListImage(
     const gpusize maxChunkSize = Parent()->ChipProperties().p2pBltWaInfo.maxCopyChunkSize;
     const gpusize baseVa       = dstImage.GetBoundGpuMemory().GpuVirtAddr();
 
-    struct LookupItem
-    {
-        ImageCopyRegion region;
-        gpusize         chunkAddr;
-    };
-    Deque<LookupItem, Platform> lookupList(GetPlatform());
-
     gpusize chunkVa = 0;
 
     for (uint32 i = 0; ((i < regionCount) && (result == Result::Success)); i++)
@@ -3724,8 +3753,9 @@ Result Device::P2pBltWaModifyRegionListImage(
 
         PAL_ASSERT((pRegions[i].dstOffset.x >= 0) && (pRegions[i].dstOffset.y >= 0) && (pRegions[i].dstOffset.z >= 0));
 
-        LookupItem stackedRegionItem = { }; // It stacks consecutive slices of an image as long as they still
-                                            // fit in one chunk.
+        // These stack consecutive slices of an image as long as they still fit in one chunk.
+        ImageCopyRegion stackedRegion    = { };
+        gpusize         stackedChunkAddr = 0;
 
         if (dstImage.IsSubResourceLinear(pRegions[i].dstSubres))
         {
@@ -3771,7 +3801,7 @@ Result Device::P2pBltWaModifyRegionListImage(
                         const uint32 rowsPerChunk = static_cast<uint32>(maxChunkSize / rowPitchInBytes);
                         const uint32 numChunks    = RoundUpQuotient(transferHeight, rowsPerChunk);
 
-                        // Register each splitted chunk in lookupList for current region.
+                        // Register each splitted chunk in the new region list for current region.
                         region.dstOffset.x  = pRegions[i].dstOffset.x;
                         region.srcOffset.x  = pRegions[i].srcOffset.x;
                         region.extent.width = pRegions[i].extent.width;
@@ -3800,10 +3830,7 @@ Result Device::P2pBltWaModifyRegionListImage(
                                       macroBlockOffset +
                                       (region.dstOffset.y * rowPitchInBytes);
 
-                            LookupItem regionItem = {};
-                            regionItem.region     = region;
-                            regionItem.chunkAddr  = chunkVa;
-                            result = lookupList.PushBack(regionItem);
+                            result = pNewRegions->PushBack(region, chunkVa);
                         }
                     }
                 }
@@ -3832,42 +3859,42 @@ Result Device::P2pBltWaModifyRegionListImage(
                     // Update regionList.
                     if (j == 0)
                     {
-                        PAL_ASSERT(stackedRegionItem.region.numSlices == 0);
-                        PAL_ASSERT(stackedRegionItem.chunkAddr == 0);
-                        stackedRegionItem.region    = region;
-                        stackedRegionItem.chunkAddr = chunkVa;
+                        PAL_ASSERT(stackedRegion.numSlices == 0);
+                        PAL_ASSERT(stackedChunkAddr == 0);
+                        stackedRegion    = region;
+                        stackedChunkAddr = chunkVa;
                     }
                     else
                     {
-                        PAL_ASSERT(stackedRegionItem.region.numSlices > 0);
-                        PAL_ASSERT(stackedRegionItem.chunkAddr != 0);
-                        PAL_ASSERT((stackedRegionItem.region.extent.depth == 1) ||
-                                   (stackedRegionItem.region.numSlices == 1));
+                        PAL_ASSERT(stackedRegion.numSlices > 0);
+                        PAL_ASSERT(stackedChunkAddr != 0);
+                        PAL_ASSERT((stackedRegion.extent.depth == 1) ||
+                                   (stackedRegion.numSlices == 1));
 
-                        if (chunkVa != stackedRegionItem.chunkAddr)
+                        if (chunkVa != stackedChunkAddr)
                         {
-                            // chunkVa cannot cover current region, update stackedRegionItem.
-                            result = lookupList.PushBack(stackedRegionItem);
-                            stackedRegionItem.region    = region;
-                            stackedRegionItem.chunkAddr = chunkVa;
+                            // chunkVa cannot cover current region, update stackedRegion.
+                            result = pNewRegions->PushBack(stackedRegion, stackedChunkAddr);
+                            stackedRegion    = region;
+                            stackedChunkAddr = chunkVa;
                         }
                         else
                         {
-                            PAL_ASSERT(stackedRegionItem.region.dstOffset.x == region.dstOffset.x);
-                            PAL_ASSERT(stackedRegionItem.region.dstOffset.y == region.dstOffset.y);
-                            PAL_ASSERT(stackedRegionItem.region.extent.width  == region.extent.width);
-                            PAL_ASSERT(stackedRegionItem.region.extent.height == region.extent.height);
+                            PAL_ASSERT(stackedRegion.dstOffset.x == region.dstOffset.x);
+                            PAL_ASSERT(stackedRegion.dstOffset.y == region.dstOffset.y);
+                            PAL_ASSERT(stackedRegion.extent.width  == region.extent.width);
+                            PAL_ASSERT(stackedRegion.extent.height == region.extent.height);
                             if (is3d)
                             {
-                                PAL_ASSERT(stackedRegionItem.region.numSlices == region.numSlices);
-                                PAL_ASSERT(stackedRegionItem.region.numSlices == 1);
-                                stackedRegionItem.region.extent.depth++;
+                                PAL_ASSERT(stackedRegion.numSlices == region.numSlices);
+                                PAL_ASSERT(stackedRegion.numSlices == 1);
+                                stackedRegion.extent.depth++;
                             }
                             else
                             {
-                                PAL_ASSERT(stackedRegionItem.region.dstOffset.z == region.dstOffset.z);
-                                PAL_ASSERT(stackedRegionItem.region.extent.depth == region.extent.depth);
-                                stackedRegionItem.region.numSlices++;
+                                PAL_ASSERT(stackedRegion.dstOffset.z == region.dstOffset.z);
+                                PAL_ASSERT(stackedRegion.extent.depth == region.extent.depth);
+                                stackedRegion.numSlices++;
                             }
                         }
                     }
@@ -3875,8 +3902,9 @@ Result Device::P2pBltWaModifyRegionListImage(
                     if (j == (loopCount - 1))
                     {
                         // This region cannot take more slice if reaching the end of slice array.
-                        result = lookupList.PushBack(stackedRegionItem);
-                        memset(&stackedRegionItem, 0, sizeof(LookupItem));
+                        result = pNewRegions->PushBack(stackedRegion, stackedChunkAddr);
+                        stackedRegion    = { };
+                        stackedChunkAddr = 0;
                     }
                 }
             }
@@ -4059,10 +4087,7 @@ Result Device::P2pBltWaModifyRegionListImage(
                                           ((startBlockX + ((startBlockY + (startBlockZ * numBlocksSurfHeight))
                                               * numBlocksSurfWidth)) * blockSize);
 
-                                LookupItem regionItem = {};
-                                regionItem.region     = region;
-                                regionItem.chunkAddr  = chunkVa;
-                                result = lookupList.PushBack(regionItem);
+                                result = pNewRegions->PushBack(region, chunkVa);
                             }
                         }
                     }
@@ -4149,40 +4174,41 @@ Result Device::P2pBltWaModifyRegionListImage(
                             // Update regionList.
                             if (j == 0)
                             {
-                                PAL_ASSERT(stackedRegionItem.region.numSlices == 0);
-                                PAL_ASSERT(stackedRegionItem.chunkAddr == 0);
-                                stackedRegionItem.region    = region;
-                                stackedRegionItem.chunkAddr = chunkVa;
+                                PAL_ASSERT(stackedRegion.numSlices == 0);
+                                PAL_ASSERT(stackedChunkAddr == 0);
+                                stackedRegion    = region;
+                                stackedChunkAddr = chunkVa;
                             }
                             else
                             {
-                                PAL_ASSERT(stackedRegionItem.region.numSlices != 0);
-                                PAL_ASSERT(stackedRegionItem.chunkAddr != 0);
+                                PAL_ASSERT(stackedRegion.numSlices != 0);
+                                PAL_ASSERT(stackedChunkAddr != 0);
 
-                                if (chunkVa != stackedRegionItem.chunkAddr)
+                                if (chunkVa != stackedChunkAddr)
                                 {
-                                    // chunkVa cannot cover current region, update stackedRegionItem.
-                                    result = lookupList.PushBack(stackedRegionItem);
-                                    stackedRegionItem.region    = region;
-                                    stackedRegionItem.chunkAddr = chunkVa;
+                                    // chunkVa cannot cover current region, update stackedRegion.
+                                    result = pNewRegions->PushBack(stackedRegion, stackedChunkAddr);
+                                    stackedRegion    = region;
+                                    stackedChunkAddr = chunkVa;
                                 }
                                 else
                                 {
-                                    PAL_ASSERT(stackedRegionItem.region.dstOffset.x   == region.dstOffset.x);
-                                    PAL_ASSERT(stackedRegionItem.region.dstOffset.y   == region.dstOffset.y);
-                                    PAL_ASSERT(stackedRegionItem.region.dstOffset.z   == region.dstOffset.z);
-                                    PAL_ASSERT(stackedRegionItem.region.extent.width  == region.extent.width);
-                                    PAL_ASSERT(stackedRegionItem.region.extent.height == region.extent.height);
-                                    PAL_ASSERT(stackedRegionItem.region.extent.depth  == region.extent.depth);
-                                    stackedRegionItem.region.numSlices++;
+                                    PAL_ASSERT(stackedRegion.dstOffset.x   == region.dstOffset.x);
+                                    PAL_ASSERT(stackedRegion.dstOffset.y   == region.dstOffset.y);
+                                    PAL_ASSERT(stackedRegion.dstOffset.z   == region.dstOffset.z);
+                                    PAL_ASSERT(stackedRegion.extent.width  == region.extent.width);
+                                    PAL_ASSERT(stackedRegion.extent.height == region.extent.height);
+                                    PAL_ASSERT(stackedRegion.extent.depth  == region.extent.depth);
+                                    stackedRegion.numSlices++;
                                 }
                             }
 
                             if (j == (pRegions[i].numSlices - 1))
                             {
                                 // This region cannot take more slice if reaching the end of slice array.
-                                result = lookupList.PushBack(stackedRegionItem);
-                                memset(&stackedRegionItem, 0, sizeof(LookupItem));
+                                result = pNewRegions->PushBack(stackedRegion, stackedChunkAddr);
+                                stackedRegion    = { };
+                                stackedChunkAddr = 0;
                             }
                         }
                         else
@@ -4196,10 +4222,7 @@ Result Device::P2pBltWaModifyRegionListImage(
                                                        ((startBlockX + ((startBlockY + (startBlockZ *
                                                            numBlocksSurfHeight)) * numBlocksSurfWidth)) * blockSize);
 
-                            LookupItem regionItem = {};
-                            regionItem.region     = region;
-                            regionItem.chunkAddr  = chunkVa;
-                            result = lookupList.PushBack(regionItem);
+                            result = pNewRegions->PushBack(region, chunkVa);
                         }
                     }
                 }
@@ -4207,28 +4230,6 @@ Result Device::P2pBltWaModifyRegionListImage(
         }
     } // region loop done
 
-    const uint32 newRegionCount = static_cast<uint32>(lookupList.NumElements());
-
-    if (result == Result::Success)
-    {
-        if (pNewRegions == nullptr)
-        {
-            *pNewRegionCount = newRegionCount;
-        }
-        else
-        {
-            // Record new region list.
-            PAL_ASSERT(newRegionCount == *pNewRegionCount);
-            auto iter = lookupList.Begin();
-            for (uint32 i = 0; i < newRegionCount; i++)
-            {
-                pNewRegions[i] = iter.Get()->region;
-                pChunkAddrs[i] = iter.Get()->chunkAddr;
-                iter.Next();
-            }
-        }
-    }
-
     return result;
 }
 
@@ -4237,13 +4238,11 @@ Result Device::P2pBltWaModifyRegionListImage(
 // is composed of multiple, small chunks as required by the workaround.  For each modified region, a chunkAddr is
 // reported that is the VA where the region begins in memory.
 Result Device::P2pBltWaModifyRegionListImageToMemory(
-    const Pal::Image&            srcImage,
-    const IGpuMemory&            dstGpuMemory,
-    uint32                       regionCount,
-    const MemoryImageCopyRegion* pRegions,
-    uint32*                      pNewRegionCount,
-    MemoryImageCopyRegion*       pNewRegions,
-    gpusize*                     pChunkAddrs
+    const Pal::Image&                          srcImage,
+    const IGpuMemory&                          dstGpuMemory,
+    uint32                                     regionCount,
+    const MemoryImageCopyRegion*               pRegions,
+    P2pBltWaRegionList<MemoryImageCopyRegion>* pNewRegions
     ) const
 {
     PAL_NOT_TESTED();
@@ -4255,13 +4254,6 @@ Result Device::P2pBltWaModifyRegionListImageToMemory(
     gpusize chunkVa            = 0;
 
     // SplitChunk implementation
-    struct LookupItem
-    {
-        MemoryImageCopyRegion region;
-        gpusize               chunkAddr;
-    };
-    Deque<LookupItem, Platform> lookupList(GetPlatform());
-
     for (uint32 i = 0; ((i < regionCount) && (result == Result::Success)); i++)
     {
         const SubResourceInfo* pSrcSubresInfo = srcImage.SubresourceInfo(pRegions[i].imageSubres);
@@ -4308,7 +4300,7 @@ Result Device::P2pBltWaModifyRegionListImageToMemory(
                                                                                           maxChunkSize));
                     const uint32 chunkStrideInPixel = static_cast<uint32>(maxChunkSize / bytesPerPixel);
 
-                    // Register each splitted chunk in lookupList for current region.
+                    // Register each splitted chunk in the new region list for current region.
                     for (uint32 m = 0; ((m < transferHeight) && (result == Result::Success)); m++)
                     {
                         region.imageOffset.y = pRegions[i].imageOffset.y + m;
@@ -4334,10 +4326,7 @@ Result Device::P2pBltWaModifyRegionListImageToMemory(
 
                             chunkVa               = baseVa + region.gpuMemoryOffset;
 
-                            LookupItem regionItem = {};
-                            regionItem.region     = region;
-                            regionItem.chunkAddr  = chunkVa;
-                            result = lookupList.PushBack(regionItem);
+                            result = pNewRegions->PushBack(region, chunkVa);
                         }
                     }
                 }
@@ -4347,7 +4336,7 @@ Result Device::P2pBltWaModifyRegionListImageToMemory(
                     const uint32 rowsPerChunk = static_cast<uint32>(maxChunkSize / rowPitchInBytes);
                     numChunks = RoundUpQuotient(transferHeight, rowsPerChunk); // round-up
 
-                    // Register each splitted chunk in lookupList for current region.
+                    // Register each splitted chunk in the new region list for current region.
                     for (uint32 m = 0; ((m < numChunks) && (result == Result::Success)); m++)
                     {
                         region.imageOffset.y = pRegions[i].imageOffset.y + (rowsPerChunk * m);
@@ -4370,10 +4359,7 @@ Result Device::P2pBltWaModifyRegionListImageToMemory(
 
                         chunkVa               = baseVa + region.gpuMemoryOffset;
 
-                        LookupItem regionItem = {};
-                        regionItem.region     = region;
-                        regionItem.chunkAddr  = chunkVa;
-                        result = lookupList.PushBack(regionItem);
+                        result = pNewRegions->PushBack(region, chunkVa);
                     }
                 }
             }
@@ -4389,42 +4375,20 @@ Result Device::P2pBltWaModifyRegionListImageToMemory(
                     chunkVa = startVa;
                 }
 
-                LookupItem regionItem = {};
-                regionItem.region     = pRegions[i];
-                regionItem.chunkAddr  = chunkVa;
-                result = lookupList.PushBack(regionItem);
+                result = pNewRegions->PushBack(pRegions[i], chunkVa);
             }
         }
     }
 
-    uint32 const newRegionCount = static_cast<uint32>(lookupList.NumElements());
-
     if (result == Result::Success)
     {
-        if (pNewRegions == nullptr)
+        if (needBiggerRegionList)
         {
-            // Query size required for new region list.
-            if (needBiggerRegionList)
-            {
-                PAL_ASSERT(newRegionCount > regionCount);
-            }
-            else
-            {
-                PAL_ASSERT(newRegionCount == regionCount);
-            }
-            *pNewRegionCount = newRegionCount;
+            PAL_ASSERT(pNewRegions->NumRegions() > regionCount);
         }
         else
         {
-            // Record new region list.
-            PAL_ASSERT(newRegionCount == *pNewRegionCount);
-            auto iter = lookupList.Begin();
-            for (uint32 i = 0; i < newRegionCount; i++)
-            {
-                pNewRegions[i] = iter.Get()->region;
-                pChunkAddrs[i] = iter.Get()->chunkAddr;
-                iter.Next();
-            }
+            PAL_ASSERT(pNewRegions->NumRegions() == regionCount);
         }
     }
 
@@ -4436,13 +4400,11 @@ Result Device::P2pBltWaModifyRegionListImageToMemory(
 // is composed of multiple, small chunks as required by the workaround.  For each modified region, a chunkAddr is
 // reported that is the VA where the region begins in memory.
 Result Device::P2pBltWaModifyRegionListMemoryToImage(
-    const IGpuMemory&            srcGpuMemory,
-    const Pal::Image&            dstImage,
-    uint32                       regionCount,
-    const MemoryImageCopyRegion* pRegions,
-    uint32*                      pNewRegionCount,
-    MemoryImageCopyRegion*       pNewRegions,
-    gpusize*                     pChunkAddrs
+    const IGpuMemory&                          srcGpuMemory,
+    const Pal::Image&                          dstImage,
+    uint32                                     regionCount,
+    const MemoryImageCopyRegion*               pRegions,
+    P2pBltWaRegionList<MemoryImageCopyRegion>* pNewRegions
     ) const
 {
     PAL_NOT_TESTED();
@@ -4452,13 +4414,6 @@ Result Device::P2pBltWaModifyRegionListMemoryToImage(
     const gpusize baseVa       = dstImage.GetBoundGpuMemory().GpuVirtAddr();
 
     // SplitChunk implementation
-    struct LookupItem
-    {
-        MemoryImageCopyRegion region;
-        gpusize               chunkAddr;
-    };
-    Deque<LookupItem, Platform> lookupList(GetPlatform());
-
     bool    needBiggerRegionList = false;
     gpusize chunkVa              = 0;
 
@@ -4515,7 +4470,7 @@ Result Device::P2pBltWaModifyRegionListMemoryToImage(
                                                                                               maxChunkSize));
                         const uint32 chunkStrideInPixel = static_cast<uint32>(maxChunkSize / bytesPerPixel);
 
-                        // Register each splitted chunk in lookupList for current region.
+                        // Register each splitted chunk in the new region list for current region.
                         for (uint32 m = 0; ((m < transferHeight) && (result == Result::Success)); m++)
                         {
                             region.imageOffset.y = pRegions[i].imageOffset.y + m;
@@ -4543,10 +4498,7 @@ Result Device::P2pBltWaModifyRegionListMemoryToImage(
                                                         (region.imageOffset.x * bytesPerPixel) +
                                                         (region.imageOffset.y * rowPitchInByte);
 
-                                LookupItem regionItem = {};
-                                regionItem.region     = region;
-                                regionItem.chunkAddr  = chunkVa;
-                                result = lookupList.PushBack(regionItem);
+                                result = pNewRegions->PushBack(region, chunkVa);
                             }
                         }
                     }
@@ -4556,7 +4508,7 @@ Result Device::P2pBltWaModifyRegionListMemoryToImage(
                         const uint32 rowsPerChunk = static_cast<uint32>(maxChunkSize / rowPitchInByte);
                         numChunks = RoundUpQuotient(transferHeight, rowsPerChunk);
 
-                        // Register each splitted chunk in lookupList for current region.
+                        // Register each splitted chunk in the new region list for current region.
                         for (uint32 m = 0; ((m < numChunks) && (result == Result::Success)); m++)
                         {
                             region.imageOffset.y = pRegions[i].imageOffset.y + (rowsPerChunk * m);
@@ -4580,10 +4532,7 @@ Result Device::P2pBltWaModifyRegionListMemoryToImage(
                             // Use the beginning of pixel row to improve VCOP share rate.
                             chunkVa              = sliceBaseVa + (region.imageOffset.y * rowPitchInByte);
 
-                            LookupItem regionItem = {};
-                            regionItem.region     = region;
-                            regionItem.chunkAddr  = chunkVa;
-                            result = lookupList.PushBack(regionItem);
+                            result = pNewRegions->PushBack(region, chunkVa);
                         }
                     }
                 }
@@ -4605,10 +4554,7 @@ Result Device::P2pBltWaModifyRegionListMemoryToImage(
                         chunkVa = sliceBaseVa + (region.imageOffset.y * rowPitchInByte);
                     }
 
-                    LookupItem regionItem = {};
-                    regionItem.region     = pRegions[i];
-                    regionItem.chunkAddr  = chunkVa;
-                    result = lookupList.PushBack(regionItem);
+                    result = pNewRegions->PushBack(pRegions[i], chunkVa);
                 }
             }
             else
@@ -4716,10 +4662,7 @@ Result Device::P2pBltWaModifyRegionListMemoryToImage(
                                 chunkVa                  = sliceBaseVa +
                                                            ((startBlockX + startBlockY * numBlocksPerRow) * blockSize);
 
-                                LookupItem regionItem = {};
-                                regionItem.region     = region;
-                                regionItem.chunkAddr  = chunkVa;
-                                result = lookupList.PushBack(regionItem);
+                                result = pNewRegions->PushBack(region, chunkVa);
                             }
                         }
                     }
@@ -4779,10 +4722,7 @@ Result Device::P2pBltWaModifyRegionListMemoryToImage(
                             chunkVa                  = sliceBaseVa +
                                                        ((startBlockX + startBlockY * numBlocksPerRow) * blockSize);
 
-                            LookupItem regionItem = {};
-                            regionItem.region     = region;
-                            regionItem.chunkAddr  = chunkVa;
-                            result = lookupList.PushBack(regionItem);
+                            result = pNewRegions->PushBack(region, chunkVa);
                         }
                     }
                 }
@@ -4803,43 +4743,21 @@ Result Device::P2pBltWaModifyRegionListMemoryToImage(
                         chunkVa = startVa;
                     }
 
-                    LookupItem regionItem = {};
-                    regionItem.region     = pRegions[i];
-                    regionItem.chunkAddr  = chunkVa;
-                    result = lookupList.PushBack(regionItem);
+                    result = pNewRegions->PushBack(pRegions[i], chunkVa);
                 }
             }
         }
     }
 
-    const uint32 newRegionCount = static_cast<uint32>(lookupList.NumElements());
-
     if (result == Result::Success)
     {
-        if (pNewRegions == nullptr)
+        if (needBiggerRegionList)
         {
-            // Query size required for new region list.
-            if (needBiggerRegionList)
-            {
-                PAL_ASSERT(newRegionCount > regionCount);
-            }
-            else
-            {
-                PAL_ASSERT(newRegionCount == regionCount);
-            }
-            *pNewRegionCount = newRegionCount;
+            PAL_ASSERT(pNewRegions->NumRegions() > regionCount);
         }
         else
         {
-            // Record new region list.
-            PAL_ASSERT(newRegionCount == *pNewRegionCount);
-            auto iter = lookupList.Begin();
-            for (uint32 i = 0; i < newRegionCount; i++)
-            {
-                pNewRegions[i] = iter.Get()->region;
-                pChunkAddrs[i]  = iter.Get()->chunkAddr;
-                iter.Next();
-            }
+            PAL_ASSERT(pNewRegions->NumRegions() == regionCount);
         }
     }
 
@@ -189,6 +189,10 @@ public:
 
     virtual Result CreateDummyCommandStream(EngineType engineType, Pal::CmdStream** ppCmdStream) const override;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+    virtual void ApplyShaderRingSizeHints(const ShaderRingSizeHints& hints) override;
+#endif
+
     virtual size_t GetQueueContextSize(const QueueCreateInfo& createInfo) const override;
 
     virtual Result CreateQueueContext(
@@ -502,39 +506,31 @@ public:
     PM4PFP_CONTEXT_CONTROL GetContextControl() const;
 
     virtual Result P2pBltWaModifyRegionListMemory(
-        const IGpuMemory&            dstGpuMemory,
-        uint32                       regionCount,
-        const MemoryCopyRegion*      pRegions,
-        uint32*                      pNewRegionCount,
-        MemoryCopyRegion*            pNewRegions,
-        gpusize*                     pChunkAddrs) const override;
+        const IGpuMemory&                     dstGpuMemory,
+        uint32                                regionCount,
+        const MemoryCopyRegion*               pRegions,
+        P2pBltWaRegionList<MemoryCopyRegion>* pNewRegions) const override;
 
     virtual Result P2pBltWaModifyRegionListImage(
-        const Pal::Image&            srcImage,
-        const Pal::Image&            dstImage,
-        uint32                       regionCount,
-        const ImageCopyRegion*       pRegions,
-        uint32*                      pNewRegionCount,
-        ImageCopyRegion*             pNewRegions,
-        gpusize*                     pChunkAddrs) const override;
+        const Pal::Image&                    srcImage,
+        const Pal::Image&                    dstImage,
+        uint32                               regionCount,
+        const ImageCopyRegion*               pRegions,
+        P2pBltWaRegionList<ImageCopyRegion>* pNewRegions) const override;
 
     virtual Result P2pBltWaModifyRegionListImageToMemory(
-        const Pal::Image&            srcImage,
-        const IGpuMemory&            dstGpuMemory,
-        uint32                       regionCount,
-        const MemoryImageCopyRegion* pRegions,
-        uint32*                      pNewRegionCount,
-        MemoryImageCopyRegion*       pNewRegions,
-        gpusize*                     pChunkAddrs) const override;
+        const Pal::Image&                          srcImage,
+        const IGpuMemory&                          dstGpuMemory,
+        uint32                                     regionCount,
+        const MemoryImageCopyRegion*               pRegions,
+        P2pBltWaRegionList<MemoryImageCopyRegion>* pNewRegions) const override;
 
     virtual Result P2pBltWaModifyRegionListMemoryToImage(
-        const IGpuMemory&            srcGpuMemory,
-        const Pal::Image&            dstImage,
-        uint32                       regionCount,
-        const MemoryImageCopyRegion* pRegions,
-        uint32*                      pNewRegionCount,
-        MemoryImageCopyRegion*       pNewRegions,
-        gpusize*                     pChunkAddrs) const override;
+        const IGpuMemory&                          srcGpuMemory,
+        const Pal::Image&                          dstImage,
+        uint32                                     regionCount,
+        const MemoryImageCopyRegion*               pRegions,
+        P2pBltWaRegionList<MemoryImageCopyRegion>* pNewRegions) const override;
 
     virtual void PatchPipelineInternalSrdTable(
         void*       pDstSrdTable,
@@ -544,6 +540,7 @@ public:
 
 private:
     Result InitOcclusionResetMem();
+    void   PrepareEngineRingSets();
     const regGB_ADDR_CONFIG& GetGbAddrConfig() const;
 
     void Gfx9CreateFmaskViewSrdsInternal(
@@ -355,6 +355,41 @@ Result GraphicsPipeline::HwlInit(
     return result;
 }
 
+// =====================================================================================================================
+// Copies the register images and signature of a prototype pipeline created from an identical ELF and create info.
+void GraphicsPipeline::CopyStateFrom(
+    const Pal::Pipeline& prototype)
+{
+    Pal::GraphicsPipeline::CopyStateFrom(prototype);
+
+    const auto& gfx9Prototype = static_cast<const GraphicsPipeline&>(prototype);
+
+    m_contextRegHash    = gfx9Prototype.m_contextRegHash;
+    m_sxPsDownconvert   = gfx9Prototype.m_sxPsDownconvert;
+    m_sxBlendOptEpsilon = gfx9Prototype.m_sxBlendOptEpsilon;
+    m_sxBlendOptControl = gfx9Prototype.m_sxBlendOptControl;
+    m_vgtLsHsConfig     = gfx9Prototype.m_vgtLsHsConfig;
+    m_spiVsOutConfig    = gfx9Prototype.m_spiVsOutConfig;
+    m_spiPsInControl    = gfx9Prototype.m_spiPsInControl;
+    m_paScModeCntl1     = gfx9Prototype.m_paScModeCntl1;
+    m_signature         = gfx9Prototype.m_signature;
+    m_commands          = gfx9Prototype.m_commands;
+
+    memcpy(&m_iaMultiVgtParam[0], &gfx9Prototype.m_iaMultiVgtParam[0], sizeof(m_iaMultiVgtParam));
+
+    m_chunkHs.Clone(gfx9Prototype.m_chunkHs);
+    m_chunkGs.Clone(gfx9Prototype.m_chunkGs);
+    m_chunkVsPs.Clone(gfx9Prototype.m_chunkVsPs);
+}
+
+// =====================================================================================================================
+// Client pipelines can share their state through the pipeline object cache unless their register setup depends on
+// whether or not they are internal.
+bool GraphicsPipeline::SupportsObjectCache() const
+{
+    return (m_pDevice->Parent()->Settings().tossPointMode != TossPointAfterPs);
+}
+
 // =====================================================================================================================
 // Retrieve the appropriate shader-stage-info based on the specifed shader type.
 const ShaderStageInfo* GraphicsPipeline::GetShaderStageInfo(
@@ -162,6 +162,9 @@ protected:
 
     virtual const ShaderStageInfo* GetShaderStageInfo(ShaderType shaderType) const override;
 
+    virtual void CopyStateFrom(const Pal::Pipeline& prototype) override;
+    virtual bool SupportsObjectCache() const override;
+
 private:
     void EarlyInit(
         const CodeObjectMetadata& metadata,
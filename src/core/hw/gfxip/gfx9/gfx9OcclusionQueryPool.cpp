@@ -422,33 +422,26 @@ static bool ComputeResultsForOneSlot(
     volatile const OcclusionQueryResultPair* pRbCounters,
     ResultUint*                              pOutputBuffer)
 {
-    ResultUint result     = 0;
-    bool       queryReady = true;
+    // The RBs will set the valid bits when they have written their data. We do not need to skip disabled RBs because
+    // they are initialized to valid with zPassData equal to zero.
+    uint64 zPassCount = 0;
+    bool   queryReady = ReduceOcclusionQueryCounters(pRbCounters, numTotalRbs, &zPassCount);
 
-    // Loop through all the RBs associated with this ASIC.
-    for (uint32 idx = 0; idx < numTotalRbs; idx++)
+    if ((queryReady == false) && TestAnyFlagSet(flags, QueryResultWait))
     {
-        bool countersReady = false;
+        // We will loop here for as long as necessary if the caller has requested it.
+        QueryPollBackoff backoff(flags);
 
         do
         {
-            // The RBs will set the valid bits when they have written their data. We do not need to skip disabled RBs
-            // because they are initialized to valid with zPassData equal to zero. We will loop here for as long as
-            // necessary if the caller has requested it.
-            countersReady = (pRbCounters[idx].begin.bits.valid == 1) && (pRbCounters[idx].end.bits.valid == 1);
+            backoff.Wait();
+            queryReady = ReduceOcclusionQueryCounters(pRbCounters, numTotalRbs, &zPassCount);
         }
-        while ((countersReady == false) && TestAnyFlagSet(flags, QueryResultWait));
-
-        if (countersReady)
-        {
-            result += static_cast<ResultUint>(pRbCounters[idx].end.bits.zPassData -
-                                              pRbCounters[idx].begin.bits.zPassData);
-        }
-
-        // The entire query will only be ready if all of its counters were ready.
-        queryReady = queryReady && countersReady;
+        while (queryReady == false);
     }
 
+    ResultUint result = static_cast<ResultUint>(zPassCount);
+
     // Store the result in the output buffer if it's legal for us to do so.
     if (queryReady || TestAnyFlagSet(flags, QueryResultPartial))
     {
@@ -72,6 +72,15 @@ PipelineChunkGs::PipelineChunkGs(
     m_stageInfo.stageId = Abi::HardwareStage::Gs;
 }
 
+// =====================================================================================================================
+// Copies the register state of another chunk which was initialized from an identical pipeline.
+void PipelineChunkGs::Clone(
+    const PipelineChunkGs& chunk)
+{
+    m_commands  = chunk.m_commands;
+    m_stageInfo = chunk.m_stageInfo;
+}
+
 // =====================================================================================================================
 // Early initialization for this pipeline chunk.  Responsible for determining the number of SH and context registers to
 // be loaded using LOAD_CNTX_REG_INDEX and LOAD_SH_REG_INDEX.
@@ -57,6 +57,8 @@ public:
         const PerfDataInfo* pPerfDataInfo);
     ~PipelineChunkGs() { }
 
+    void Clone(const PipelineChunkGs& chunk);
+
     void EarlyInit(
         GraphicsPipelineLoadInfo* pInfo);
 
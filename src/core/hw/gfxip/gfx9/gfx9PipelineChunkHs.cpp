@@ -64,6 +64,15 @@ PipelineChunkHs::PipelineChunkHs(
     m_stageInfo.stageId = Abi::HardwareStage::Hs;
 }
 
+// =====================================================================================================================
+// Copies the register state of another chunk which was initialized from an identical pipeline.
+void PipelineChunkHs::Clone(
+    const PipelineChunkHs& chunk)
+{
+    m_commands  = chunk.m_commands;
+    m_stageInfo = chunk.m_stageInfo;
+}
+
 // =====================================================================================================================
 // Early initialization for this pipeline chunk.  Responsible for determining the number of SH and context registers to
 // be loaded using LOAD_CNTX_REG_INDEX and LOAD_SH_REG_INDEX.
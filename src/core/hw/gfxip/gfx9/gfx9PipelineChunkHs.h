@@ -56,6 +56,8 @@ public:
         const PerfDataInfo* pPerfDataInfo);
     ~PipelineChunkHs() { }
 
+    void Clone(const PipelineChunkHs& chunk);
+
     void EarlyInit(
         GraphicsPipelineLoadInfo* pInfo);
 
@@ -98,6 +98,17 @@ PipelineChunkVsPs::PipelineChunkVsPs(
     m_paScShaderControl.u32All = 0;
 }
 
+// =====================================================================================================================
+// Copies the register state of another chunk which was initialized from an identical pipeline.
+void PipelineChunkVsPs::Clone(
+    const PipelineChunkVsPs& chunk)
+{
+    m_commands          = chunk.m_commands;
+    m_paScShaderControl = chunk.m_paScShaderControl;
+    m_stageInfoVs       = chunk.m_stageInfoVs;
+    m_stageInfoPs       = chunk.m_stageInfoPs;
+}
+
 // =====================================================================================================================
 // Early initialization for this pipeline chunk.  Responsible for determining the number of SH and context registers to
 // be loaded using LOAD_CNTX_REG_INDEX and LOAD_SH_REG_INDEX.
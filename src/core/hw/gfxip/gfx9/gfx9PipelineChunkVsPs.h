@@ -54,6 +54,8 @@ public:
         const PerfDataInfo* pPsPerfDataInfo);
     ~PipelineChunkVsPs() { }
 
+    void Clone(const PipelineChunkVsPs& chunk);
+
     void EarlyInit(
         const RegisterVector&     registers,
         GraphicsPipelineLoadInfo* pInfo);
@@ -405,6 +405,8 @@ static bool ComputeResultsForOneSlot(
     uint32     numStatsEnabled = 0;
     bool       queryReady      = true;
 
+    QueryPollBackoff backoff(resultFlags);
+
     for (uint32 layoutIdx = 0; layoutIdx < PipelineStatsMaxNumCounters; ++layoutIdx)
     {
         // Filter out stats that are not enabled for this pool.
@@ -413,14 +415,20 @@ static bool ComputeResultsForOneSlot(
             const uint32 counterOffset = PipelineStatsLayout[layoutIdx].counterOffset;
             bool         countersReady = false;
 
-            do
+            while (true)
             {
                 // If the initial value is still in one of the counters it implies that the query hasn't finished yet.
                 // We will loop here for as long as necessary if the caller has requested it.
                 countersReady = ((pBeginCounters[counterOffset] != PipelineStatsResetMemValue64) &&
                                  (pEndCounters[counterOffset]   != PipelineStatsResetMemValue64));
+
+                if (countersReady || (TestAnyFlagSet(resultFlags, QueryResultWait) == false))
+                {
+                    break;
+                }
+
+                backoff.Wait();
             }
-            while ((countersReady == false) && TestAnyFlagSet(resultFlags, QueryResultWait));
 
             if (countersReady)
             {
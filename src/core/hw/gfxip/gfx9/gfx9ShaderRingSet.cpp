@@ -23,6 +23,7 @@
  *
  **********************************************************************************************************************/
 
+#include "core/engine.h"
 #include "core/platform.h"
 #include "core/hw/gfxip/gfx9/g_gfx9PalSettings.h"
 #include "core/hw/gfxip/gfx9/gfx9CmdStream.h"
@@ -538,5 +539,232 @@ uint32* ComputeRingSet::WriteCommands(
     return pCmdStream->WritePm4Image(sizeof(m_pm4Commands) / sizeof(uint32), &m_pm4Commands, pCmdSpace);
 }
 
+// =====================================================================================================================
+ShaderRingSetMgr::ShaderRingSetMgr(
+    Device*      pDevice,
+    Pal::Engine* pEngine,
+    bool         isCompute)
+    :
+    m_pDevice(pDevice),
+    m_pEngine(pEngine),
+    m_isCompute(isCompute),
+    m_pRingSet(nullptr),
+    m_pStandbyRingSet(nullptr),
+    m_standbyUpdateCounter(0),
+    m_growingStandby(false),
+    m_numRetiredRingSets(0),
+    m_currentUpdateCounter(0)
+{
+    memset(&m_pRetiredRingSets[0], 0, sizeof(m_pRetiredRingSets));
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+// =====================================================================================================================
+ShaderRingSetMgr::~ShaderRingSetMgr()
+{
+    DestroyRetiredRingSets();
+    PAL_SAFE_DELETE(m_pStandbyRingSet, m_pDevice->GetPlatform());
+    PAL_SAFE_DELETE(m_pRingSet, m_pDevice->GetPlatform());
+}
+
+// =====================================================================================================================
+Result ShaderRingSetMgr::Init()
+{
+    Result result = m_lock.Init();
+
+    if (result == Result::Success)
+    {
+        m_pRingSet = CreateRingSet();
+        result     = (m_pRingSet != nullptr) ? Result::Success : Result::ErrorOutOfMemory;
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Allocates and initializes a new, empty ring set. Returns nullptr on failure.
+ShaderRingSet* ShaderRingSetMgr::CreateRingSet() const
+{
+    ShaderRingSet* pRingSet = nullptr;
+
+    if (m_isCompute)
+    {
+        pRingSet = PAL_NEW(ComputeRingSet, m_pDevice->GetPlatform(), AllocInternal)(m_pDevice);
+    }
+    else
+    {
+        pRingSet = PAL_NEW(UniversalRingSet, m_pDevice->GetPlatform(), AllocInternal)(m_pDevice);
+    }
+
+    if ((pRingSet != nullptr) && (pRingSet->Init() != Result::Success))
+    {
+        PAL_SAFE_DELETE(pRingSet, m_pDevice->GetPlatform());
+    }
+
+    return pRingSet;
+}
+
+// =====================================================================================================================
+// Destroys all ring sets which were replaced at a submit boundary. The caller must guarantee that none of the engine's
+// queues have work in flight.
+void ShaderRingSetMgr::DestroyRetiredRingSets()
+{
+    for (uint32 i = 0; i < m_numRetiredRingSets; ++i)
+    {
+        PAL_SAFE_DELETE(m_pRetiredRingSets[i], m_pDevice->GetPlatform());
+    }
+
+    m_numRetiredRingSets = 0;
+}
+
+// =====================================================================================================================
+// Called at pipeline-creation time when the device's shader ring requirements have grown and eager ring growth is
+// enabled. Grows a standby ring set which no queue references, so the next submit can switch to it instead of idling
+// the queues and reallocating the current ring set.
+//
+// The standby ring set is taken out of the manager while it is grown, so the ring memory is allocated without holding
+// m_lock. A submit which arrives in the meantime simply grows the current ring set in place.
+Result ShaderRingSetMgr::PrepareRingSet()
+{
+    Result result = Result::Success;
+
+    // Read the counter before the ring sizes: the standby ring set is then guaranteed to satisfy every update up to and
+    // including this counter value.
+    const uint32 currentCounter = m_pDevice->QueueContextUpdateCounter();
+
+    ShaderRingSet* pStandbyRingSet = nullptr;
+    bool           growStandby     = false;
+
+    m_lock.Lock();
+
+    // If too many replaced ring sets are still alive, let the next submit idle the queues and reclaim them instead.
+    if ((m_growingStandby == false)                   &&
+        (currentCounter > m_currentUpdateCounter)     &&
+        (currentCounter > m_standbyUpdateCounter)     &&
+        (m_numRetiredRingSets < MaxRetiredRingSets))
+    {
+        growStandby            = true;
+        m_growingStandby       = true;
+        pStandbyRingSet        = m_pStandbyRingSet;
+        m_pStandbyRingSet      = nullptr;
+        m_standbyUpdateCounter = 0;
+    }
+
+    m_lock.Unlock();
+
+    if (growStandby)
+    {
+        if (pStandbyRingSet == nullptr)
+        {
+            pStandbyRingSet = CreateRingSet();
+            result          = (pStandbyRingSet != nullptr) ? Result::Success : Result::ErrorOutOfMemory;
+        }
+
+        if (result == Result::Success)
+        {
+            ShaderRingItemSizes ringSizes = {};
+            m_pDevice->GetLargestRingSizes(&ringSizes);
+
+            SamplePatternPalette samplePatternPalette;
+            m_pDevice->GetSamplePatternPalette(&samplePatternPalette);
+
+            // No queue references the standby ring set, so it can be validated without waiting for the GPU.
+            result = pStandbyRingSet->Validate(ringSizes, samplePatternPalette);
+        }
+
+        if (result != Result::Success)
+        {
+            // A partially validated ring set is useless; the next submit will fall back to growing the rings in place.
+            PAL_SAFE_DELETE(pStandbyRingSet, m_pDevice->GetPlatform());
+        }
+
+        m_lock.Lock();
+
+        m_growingStandby = false;
+
+        if (pStandbyRingSet != nullptr)
+        {
+            m_pStandbyRingSet      = pStandbyRingSet;
+            m_standbyUpdateCounter = currentCounter;
+            m_stats.numPrepared++;
+        }
+
+        m_lock.Unlock();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+Result ShaderRingSetMgr::UpdateRingSet(
+    uint32* pCounterVal,  // [in, out] As input is the currently known counter value of the QueueContext.
+                          //           On output, this is the current counter value.
+    bool*   pHasChanged)  // [out]     Whether or not the ring set has updated. If true the ring set must rewrite its
+                          //           registers.
+{
+    PAL_ALERT((pCounterVal == nullptr) || (pHasChanged == nullptr));
+
+    Result result = Result::Success;
+
+    MutexAuto lock(&m_lock);
+
+    // Check if the queue context associated with this Queue is dirty, and obtain the ring item-sizes to validate
+    // against.
+    const uint32 currentCounter = m_pDevice->QueueContextUpdateCounter();
+
+    if (currentCounter > m_currentUpdateCounter)
+    {
+        m_currentUpdateCounter = currentCounter;
+
+        if ((m_pStandbyRingSet != nullptr)                &&
+            (m_standbyUpdateCounter >= currentCounter)    &&
+            (m_numRetiredRingSets < MaxRetiredRingSets))
+        {
+            // A ring set satisfying the current requirements was already grown at pipeline-creation time. Switch to it
+            // and keep the current ring set alive because work in flight may still reference it.
+            m_pRetiredRingSets[m_numRetiredRingSets++] = m_pRingSet;
+
+            m_pRingSet             = m_pStandbyRingSet;
+            m_pStandbyRingSet      = nullptr;
+            m_standbyUpdateCounter = 0;
+
+            m_stats.numSwaps++;
+        }
+        else
+        {
+            ShaderRingItemSizes ringSizes = {};
+            m_pDevice->GetLargestRingSizes(&ringSizes);
+
+            SamplePatternPalette samplePatternPalette;
+            m_pDevice->GetSamplePatternPalette(&samplePatternPalette);
+
+            // The ring-set may be dirty. First, we need to idle all queues so that we can reallocate the rings and
+            // update the ring-set's SRD table.
+            // This wait-for-idle is expensive, but it is expected that after a few frames, the application will reach
+            // a steady-state and no longer need to do any validation at submit-time.
+            //
+            // NOTE: If a batched command generates a submit which triggers ring validation we are in deep trouble
+            // because some of the commands further down in the batched queue might assume that the preamble stream
+            // hasn't been rebuilt. To prevent this, this preprocessing is done before the submission has a chance to
+            // be batched.
+            result = m_pEngine->WaitIdleAllQueues();
+
+            // The queues are idle, so it is safe to reclaim the retired ring sets and validate the rest of the RingSet.
+            if (result == Result::Success)
+            {
+                DestroyRetiredRingSets();
+                result = m_pRingSet->Validate(ringSizes, samplePatternPalette);
+            }
+
+            m_stats.numReallocs++;
+        }
+    }
+
+    (*pHasChanged) = (m_currentUpdateCounter > (*pCounterVal));
+    (*pCounterVal) = m_currentUpdateCounter;
+
+    return result;
+}
+
 } // Gfx9
 } // Pal
@@ -27,9 +27,13 @@
 
 #include "core/hw/gfxip/gfx9/gfx9Chip.h"
 #include "core/gpuMemory.h"
+#include "palMutex.h"
 
 namespace Pal
 {
+
+class Engine;
+
 namespace Gfx9
 {
 
@@ -82,6 +86,17 @@ struct ShaderRingItemSizes
                   "The compute ring set must be a subset of the universal ring set.");
 };
 
+// Maximum number of replaced ring sets an engine keeps alive while work which may reference them is still in flight.
+constexpr uint32 MaxRetiredRingSets = 2;
+
+// Counts how often an engine had to update its ring set because the device's ring requirements changed.
+struct ShaderRingSetStats
+{
+    uint32 numPrepared;  // Standby ring sets grown at pipeline-creation time.
+    uint32 numSwaps;     // Submits which switched to a standby ring set without idling the queues.
+    uint32 numReallocs;  // Submits which idled the queues and grew the current ring set in place.
+};
+
 // =====================================================================================================================
 // A ShaderRingSet object contains all of the shader Rings used by command buffers which run on a particular Queue.
 // Additionally, each Ring Set also manages the PM4 image of commands which write the ring state to hardware.
@@ -239,5 +254,51 @@ private:
     PAL_DISALLOW_COPY_AND_ASSIGN(ComputeRingSet);
 };
 
+// =====================================================================================================================
+// Owns the ring sets of a universal or compute engine.  Besides the ring set which the queue contexts' preambles
+// reference, it can grow a standby ring set at pipeline-creation time which the next submit switches to instead of
+// idling the engine's queues and growing the current ring set in place.
+class ShaderRingSetMgr
+{
+public:
+    ShaderRingSetMgr(Device* pDevice, Pal::Engine* pEngine, bool isCompute);
+    ~ShaderRingSetMgr();
+
+    Result Init();
+
+    ShaderRingSet* RingSet() const { return m_pRingSet; }
+
+    Result UpdateRingSet(uint32* pCounterVal, bool* pHasChanged);
+    Result PrepareRingSet();
+
+    const ShaderRingSetStats& Stats() const { return m_stats; }
+
+private:
+    ShaderRingSet* CreateRingSet() const;
+    void DestroyRetiredRingSets();
+
+    Device*const       m_pDevice;
+    Pal::Engine*const  m_pEngine;
+    const bool         m_isCompute;             // Selects between ComputeRingSet and UniversalRingSet.
+
+    ShaderRingSet*     m_pRingSet;              // Ring set referenced by the queue contexts' preambles.
+    ShaderRingSet*     m_pStandbyRingSet;       // Ring set grown ahead of time which no queue references yet.
+    uint32             m_standbyUpdateCounter;  // Device update counter value which the standby ring set satisfies.
+    bool               m_growingStandby;        // Set while a thread grows the standby ring set outside of m_lock.
+
+    // Ring sets which were replaced by a standby ring set at a submit boundary. They may still be referenced by work
+    // in flight on the GPU, so they are kept alive until all of the engine's queues are next idled.
+    ShaderRingSet*     m_pRetiredRingSets[MaxRetiredRingSets];
+    uint32             m_numRetiredRingSets;
+
+    Util::Mutex        m_lock;                  // Serializes submit-time and pipeline-creation-time ring set updates.
+    ShaderRingSetStats m_stats;
+    uint32             m_currentUpdateCounter;  // Current watermark for the device-initiated context updates that have
+                                                // been processed by the engine.
+
+    PAL_DISALLOW_DEFAULT_CTOR(ShaderRingSetMgr);
+    PAL_DISALLOW_COPY_AND_ASSIGN(ShaderRingSetMgr);
+};
+
 } // Gfx9
 } // Pal
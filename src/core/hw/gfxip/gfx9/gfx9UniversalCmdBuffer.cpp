@@ -3855,6 +3855,10 @@ template <bool indexed, bool indirect>
 void UniversalCmdBuffer::ValidateDraw(
     const ValidateDrawInfo& drawInfo)      // Draw info
 {
+#if PAL_DEVELOPER_CPU_EVENTS
+    m_cpuEventCounts.draws++;
+#endif
+
     if (m_deCmdStream.Pm4ImmediateOptimizerEnabled())
     {
         ValidateDraw<indexed, indirect, true>(drawInfo);
@@ -5413,6 +5417,10 @@ uint32* UniversalCmdBuffer::ValidateDispatch(
     uint32  zDim,
     uint32* pDeCmdSpace)
 {
+#if PAL_DEVELOPER_CPU_EVENTS
+    m_cpuEventCounts.dispatches++;
+#endif
+
     if (m_computeState.pipelineState.dirtyFlags.pipelineDirty)
     {
         const auto*const pNewPipeline = static_cast<const ComputePipeline*>(m_computeState.pipelineState.pPipeline);
@@ -54,7 +54,10 @@ GfxDevice::GfxDevice(
     m_waTcCompatZRange(false),
     m_degeneratePrimFilter(false),
     m_pSettingsLoader(nullptr),
-    m_allocator(pDevice->GetPlatform())
+    m_allocator(pDevice->GetPlatform()),
+    m_pipelineCodeCache(pDevice),
+    m_pipelineObjectCache(pDevice),
+    m_pipelineDiskCache(pDevice)
 {
     for (uint32 i = 0; i < QueueType::QueueTypeCount; i++)
     {
@@ -30,8 +30,13 @@
 #include "palSettingsLoader.h"
 #include "core/cmdStream.h"
 #include "core/platform.h"
+#include "core/hw/gfxip/pipelineCodeCache.h"
+#include "core/hw/gfxip/pipelineDiskCache.h"
+#include "core/hw/gfxip/pipelineObjectCache.h"
 #include "palHashMap.h"
+#include "palLinearAllocator.h"
 #include "palSysMemory.h"
+#include "palVector.h"
 
 typedef union _ADDR_CREATE_FLAGS ADDR_CREATE_FLAGS;
 typedef struct _ADDR_REGISTER_VALUE ADDR_REGISTER_VALUE;
@@ -283,6 +288,36 @@ enum OutOfOrderPrimMode : uint32
     OutOfOrderPrimAlways = 3,
 };
 
+// Output of the P2P BLT workaround region splitters: the modified copy regions and, for each of them, the VA of the
+// memory chunk in which the region begins.  The splitters append to this list in a single pass.  Callers normally back
+// it with the command buffer's linear allocator so that splitting long region lists never touches the heap.
+template <typename RegionType>
+struct P2pBltWaRegionList
+{
+    explicit P2pBltWaRegionList(Util::VirtualLinearAllocator* pAllocator)
+        :
+        regions(pAllocator),
+        chunkAddrs(pAllocator)
+        { }
+
+    Result PushBack(const RegionType& region, gpusize chunkAddr)
+    {
+        Result result = regions.PushBack(region);
+
+        if (result == Result::Success)
+        {
+            result = chunkAddrs.PushBack(chunkAddr);
+        }
+
+        return result;
+    }
+
+    uint32 NumRegions() const { return regions.NumElements(); }
+
+    Util::Vector<RegionType, 32, Util::VirtualLinearAllocator> regions;
+    Util::Vector<gpusize,    32, Util::VirtualLinearAllocator> chunkAddrs;
+};
+
 // =====================================================================================================================
 // Abstract class for accessing a Device's hardware-specific functionality common to all GFXIP hardware layers.
 class GfxDevice
@@ -328,6 +363,12 @@ public:
 
     virtual Result CreateDummyCommandStream(EngineType engineType, Pal::CmdStream** ppCmdStream) const = 0;
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+    // Pre-sizes the shader rings for the client's expected pipeline requirements. Called once the engines have been
+    // created during IDevice::Finalize(). Hardware layers which manage shader rings should override this.
+    virtual void ApplyShaderRingSizeHints(const ShaderRingSizeHints& hints) { }
+#endif
+
     // Determines the amount of storage needed for a QueueContext object for the given Queue type and ID. For Queue
     // types not supported by GFXIP hardware blocks, this should return zero.
     virtual size_t GetQueueContextSize(const QueueCreateInfo& createInfo) const = 0;
@@ -486,6 +527,10 @@ public:
 
     const RsrcProcMgr& RsrcProcMgr() const { return *m_pRsrcProcMgr; }
 
+    PipelineCodeCache* GetPipelineCodeCache() { return &m_pipelineCodeCache; }
+    PipelineObjectCache* GetPipelineObjectCache() { return &m_pipelineObjectCache; }
+    PipelineDiskCache* GetPipelineDiskCache() { return &m_pipelineDiskCache; }
+
     virtual Result SetSamplePatternPalette(const SamplePatternPalette& palette) = 0;
 
     virtual uint32 GetValidFormatFeatureFlags(
@@ -539,51 +584,43 @@ public:
 #endif
 
     virtual Result P2pBltWaModifyRegionListMemory(
-        const IGpuMemory&       dstGpuMemory,
-        uint32                  regionCount,
-        const MemoryCopyRegion* pRegions,
-        uint32*                 pNewRegionCount,
-        MemoryCopyRegion*       pNewRegions,
-        gpusize*                pChunkAddrs) const
+        const IGpuMemory&                     dstGpuMemory,
+        uint32                                regionCount,
+        const MemoryCopyRegion*               pRegions,
+        P2pBltWaRegionList<MemoryCopyRegion>* pNewRegions) const
     {
         PAL_NEVER_CALLED();
         return Result::Success;
     }
 
     virtual Result P2pBltWaModifyRegionListImage(
-        const Pal::Image&      srcImage,
-        const Pal::Image&      dstImage,
-        uint32                 regionCount,
-        const ImageCopyRegion* pRegions,
-        uint32*                pNewRegionCount,
-        ImageCopyRegion*       pNewRegions,
-        gpusize*               pChunkAddrs) const
+        const Pal::Image&                    srcImage,
+        const Pal::Image&                    dstImage,
+        uint32                               regionCount,
+        const ImageCopyRegion*               pRegions,
+        P2pBltWaRegionList<ImageCopyRegion>* pNewRegions) const
     {
         PAL_NEVER_CALLED();
         return Result::Success;
     }
 
     virtual Result P2pBltWaModifyRegionListImageToMemory(
-        const Pal::Image&            srcImage,
-        const IGpuMemory&            dstGpuMemory,
-        uint32                       regionCount,
-        const MemoryImageCopyRegion* pRegions,
-        uint32*                      pNewRegionCount,
-        MemoryImageCopyRegion*       pNewRegions,
-        gpusize*                     pChunkAddrs) const
+        const Pal::Image&                          srcImage,
+        const IGpuMemory&                          dstGpuMemory,
+        uint32                                     regionCount,
+        const MemoryImageCopyRegion*               pRegions,
+        P2pBltWaRegionList<MemoryImageCopyRegion>* pNewRegions) const
     {
         PAL_NEVER_CALLED();
         return Result::Success;
     }
 
     virtual Result P2pBltWaModifyRegionListMemoryToImage(
-        const IGpuMemory&            srcGpuMemory,
-        const Pal::Image&            dstImage,
-        uint32                       regionCount,
-        const MemoryImageCopyRegion* pRegions,
-        uint32*                      pNewRegionCount,
-        MemoryImageCopyRegion*       pNewRegions,
-        gpusize*                     pChunkAddrs) const
+        const IGpuMemory&                          srcGpuMemory,
+        const Pal::Image&                          dstImage,
+        uint32                                     regionCount,
+        const MemoryImageCopyRegion*               pRegions,
+        P2pBltWaRegionList<MemoryImageCopyRegion>* pNewRegions) const
     {
         PAL_NEVER_CALLED();
         return Result::Success;
@@ -640,6 +677,15 @@ protected:
     ISettingsLoader*  m_pSettingsLoader;
     Util::IndirectAllocator m_allocator;
 
+    // Shares identical pipeline code and data uploads between all pipelines created on this device.
+    PipelineCodeCache  m_pipelineCodeCache;
+
+    // Shares the hardware-specific state of identical client pipelines when the client opts in.
+    PipelineObjectCache  m_pipelineObjectCache;
+
+    // Persists the deserialized metadata of pipeline ELF binaries across runs when the client opts in.
+    PipelineDiskCache  m_pipelineDiskCache;
+
     PAL_ALIGN(32) uint32 m_fastClearImageRefs[MaxNumFastClearImageRefs];
 
 private:
@@ -31,6 +31,7 @@
 #include "palMetroHash.h"
 #include "palPipelineAbi.h"
 #include "palPipelineAbiProcessorImpl.h"
+#include "palSysUtil.h"
 
 using namespace Util;
 
@@ -82,12 +83,149 @@ Result GraphicsPipeline::Init(
     if (result == Result::Success)
     {
         PAL_ASSERT(m_pPipelineBinary != nullptr);
-        result = InitFromPipelineBinary(createInfo, internalInfo);
+
+        if ((IsInternal() == false) &&
+            SupportsObjectCache()   &&
+            m_pDevice->GetGfxDevice()->GetPipelineObjectCache()->IsEnabled())
+        {
+            result = InitThroughObjectCache(createInfo, internalInfo);
+        }
+        else
+        {
+            result = InitFromPipelineBinary(createInfo, internalInfo);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Adds every create info field which affects a graphics pipeline's state to its object cache key.  The fields are
+// hashed one at a time because the create info structures contain padding bytes whose values are undefined.
+static void HashCreateInfo(
+    const GraphicsPipelineCreateInfo&         createInfo,
+    const GraphicsPipelineInternalCreateInfo& internalInfo,
+    MetroHash128*                             pHasher)
+{
+    pHasher->Update(createInfo.flags.u32All);
+    pHasher->Update(createInfo.useLateAllocVsLimit);
+    pHasher->Update(createInfo.lateAllocVsLimit);
+
+    const auto& topologyInfo = createInfo.iaState.topologyInfo;
+    pHasher->Update(topologyInfo.primitiveType);
+    pHasher->Update(topologyInfo.patchControlPoints);
+    pHasher->Update(topologyInfo.adjacency);
+
+    const auto& rsState = createInfo.rsState;
+    pHasher->Update(rsState.pointCoordOrigin);
+    pHasher->Update(rsState.expandLineWidth);
+    pHasher->Update(rsState.shadeMode);
+    pHasher->Update(rsState.rasterizeLastLinePixel);
+    pHasher->Update(rsState.outOfOrderPrimsEnable);
+    pHasher->Update(rsState.perpLineEndCapsEnable);
+    pHasher->Update(rsState.binningOverride);
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 381
+    pHasher->Update(rsState.depthClampDisable);
+#else
+    pHasher->Update(rsState.depthClampEnable);
+#endif
+
+    const auto& cbState = createInfo.cbState;
+    pHasher->Update(cbState.alphaToCoverageEnable);
+    pHasher->Update(cbState.dualSourceBlendEnable);
+    pHasher->Update(cbState.logicOp);
+
+    for (uint32 i = 0; i < MaxColorTargets; ++i)
+    {
+        pHasher->Update(cbState.target[i].swizzledFormat.format);
+        pHasher->Update(cbState.target[i].swizzledFormat.swizzle.swizzleValue);
+        pHasher->Update(cbState.target[i].channelWriteMask);
+    }
+
+    const auto& viewInstancingDesc = createInfo.viewInstancingDesc;
+    pHasher->Update(viewInstancingDesc.viewInstanceCount);
+    pHasher->Update(viewInstancingDesc.viewId);
+    pHasher->Update(viewInstancingDesc.renderTargetArrayIdx);
+    pHasher->Update(viewInstancingDesc.viewportArrayIdx);
+    pHasher->Update(viewInstancingDesc.enableMasking);
+
+    pHasher->Update(internalInfo.flags.u32All);
+}
+
+// =====================================================================================================================
+// Initializes this pipeline through the device's PipelineObjectCache.  On a hit, the cached prototype's state is copied.
+// On a miss, an internal prototype is created from the same create info and adopted by this pipeline.
+Result GraphicsPipeline::InitThroughObjectCache(
+    const GraphicsPipelineCreateInfo&         createInfo,
+    const GraphicsPipelineInternalCreateInfo& internalInfo)
+{
+#if PAL_DEVELOPER_CPU_EVENTS
+    const int64 startTime = GetPerfCpuTime();
+#endif
+
+    MetroHash128 hasher;
+    hasher.Update(static_cast<const uint8*>(m_pPipelineBinary), m_pipelineBinaryLen);
+    HashCreateInfo(createInfo, internalInfo, &hasher);
+
+    MetroHash::Hash hash = { };
+    hasher.Finalize(hash.bytes);
+
+    Result result = Result::Success;
+
+    if (CopyFromCachedPrototype(hash))
+    {
+#if PAL_DEVELOPER_CPU_EVENTS
+        const PipelineObjectCache& cache = *m_pDevice->GetGfxDevice()->GetPipelineObjectCache();
+
+        Developer::PipelineCpuData cpuData = {};
+        cpuData.internalPipelineHash = m_info.internalPipelineHash;
+        cpuData.palRuntimeHash       = m_info.palRuntimeHash;
+        cpuData.isCompute            = false;
+        cpuData.cpuTimestamp         = GetPerfCpuTime();
+        cpuData.hwlInitCpuTime       = cpuData.cpuTimestamp - startTime;
+        cpuData.objectCacheHit       = true;
+        cpuData.objectCacheHits      = cache.NumHits();
+        cpuData.objectCacheMisses    = cache.NumMisses();
+
+        m_pDevice->DeveloperCb(Developer::CallbackType::CreatePipeline, &cpuData);
+#endif
+    }
+    else
+    {
+        GraphicsPipeline* pPrototype = nullptr;
+        result = m_pDevice->GetGfxDevice()->CreateGraphicsPipelineInternal(createInfo,
+                                                                           internalInfo,
+                                                                           &pPrototype,
+                                                                           AllocInternal);
+        if (result == Result::Success)
+        {
+            AdoptPrototype(hash, pPrototype);
+        }
     }
 
     return result;
 }
 
+// =====================================================================================================================
+void GraphicsPipeline::CopyStateFrom(
+    const Pipeline& prototype)
+{
+    Pipeline::CopyStateFrom(prototype);
+
+    const auto& graphicsPrototype = static_cast<const GraphicsPipeline&>(prototype);
+
+    m_flags              = graphicsPrototype.m_flags;
+    m_binningOverride    = graphicsPrototype.m_binningOverride;
+    m_vertsPerPrim       = graphicsPrototype.m_vertsPerPrim;
+    m_lateAllocVsLimit   = graphicsPrototype.m_lateAllocVsLimit;
+    m_viewInstancingDesc = graphicsPrototype.m_viewInstancingDesc;
+
+    memcpy(&m_targetSwizzledFormats[0],
+           &graphicsPrototype.m_targetSwizzledFormats[0],
+           sizeof(m_targetSwizzledFormats));
+    memcpy(&m_targetWriteMasks[0], &graphicsPrototype.m_targetWriteMasks[0], sizeof(m_targetWriteMasks));
+}
+
 // =====================================================================================================================
 // Initializes this pipeline from the pipeline binary data stored in this object, combined with the specified create
 // info.
@@ -150,17 +288,31 @@ Result GraphicsPipeline::InitFromPipelineBinary(
     m_viewInstancingDesc.viewInstanceCount = Max(m_viewInstancingDesc.viewInstanceCount, 1u);
     hasher.Update(m_viewInstancingDesc);
 
+#if PAL_DEVELOPER_CPU_EVENTS
+    Developer::PipelineCpuData cpuData = {};
+    cpuData.isCompute = false;
+
+    const int64 startTime = GetPerfCpuTime();
+#endif
+
     AbiProcessor abiProcessor(m_pDevice->GetPlatform());
     Result result = abiProcessor.LoadFromBuffer(m_pPipelineBinary, m_pipelineBinaryLen);
 
     MsgPackReader      metadataReader;
     CodeObjectMetadata metadata;
+    bool               diskCacheHit = false;
 
     if (result == Result::Success)
     {
-        result = abiProcessor.GetMetadata(&metadataReader, &metadata);
+        result = GetCodeObjectMetadata(abiProcessor, &metadataReader, &metadata, &diskCacheHit);
     }
 
+#if PAL_DEVELOPER_CPU_EVENTS
+    const int64 elfParsedTime = GetPerfCpuTime();
+    cpuData.elfParseCpuTime   = elfParsedTime - startTime;
+    cpuData.diskCacheHit      = diskCacheHit;
+#endif
+
     if (result == Result::Success)
     {
         ExtractPipelineInfo(metadata, ShaderType::Vertex, ShaderType::Pixel);
@@ -205,6 +357,11 @@ Result GraphicsPipeline::InitFromPipelineBinary(
         m_flags.psUsesAppendConsume = (psStageMetadata.flags.usesAppendConsume != 0);
 
         result = HwlInit(createInfo, abiProcessor, metadata, &metadataReader);
+
+#if PAL_DEVELOPER_CPU_EVENTS
+        cpuData.cpuTimestamp   = GetPerfCpuTime();
+        cpuData.hwlInitCpuTime = cpuData.cpuTimestamp - elfParsedTime;
+#endif
     }
 
     // Finalize the hash.
@@ -213,6 +370,16 @@ Result GraphicsPipeline::InitFromPipelineBinary(
     m_info.pipelineHash = m_info.palRuntimeHash;
 #endif
 
+#if PAL_DEVELOPER_CPU_EVENTS
+    if (result == Result::Success)
+    {
+        cpuData.internalPipelineHash = m_info.internalPipelineHash;
+        cpuData.palRuntimeHash       = m_info.palRuntimeHash;
+
+        m_pDevice->DeveloperCb(Developer::CallbackType::CreatePipeline, &cpuData);
+    }
+#endif
+
     return result;
 }
 
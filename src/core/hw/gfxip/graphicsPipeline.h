@@ -84,11 +84,17 @@ protected:
 
     uint32 GetLateAllocVsLimit() const { return m_lateAllocVsLimit; }
 
+    virtual void CopyStateFrom(const Pipeline& prototype) override;
+
 private:
     Result InitFromPipelineBinary(
         const GraphicsPipelineCreateInfo&         createInfo,
         const GraphicsPipelineInternalCreateInfo& internalInfo);
 
+    Result InitThroughObjectCache(
+        const GraphicsPipelineCreateInfo&         createInfo,
+        const GraphicsPipelineInternalCreateInfo& internalInfo);
+
     union
     {
         struct
@@ -28,6 +28,8 @@
 #include "core/platform.h"
 #include "core/hw/gfxip/gfxDevice.h"
 #include "core/hw/gfxip/pipeline.h"
+#include "core/hw/gfxip/pipelineCodeCache.h"
+#include "core/hw/gfxip/pipelineObjectCache.h"
 #include "palFile.h"
 #include "palPipelineAbiProcessorImpl.h"
 
@@ -61,6 +63,9 @@ struct SerializedPipelineHeader
     SerializedPipelineGenerator generator; // Indicates what generated this pipeline.
 };
 
+// Alignment of the GPU memory allocations made by the PipelineUploader.
+constexpr gpusize GpuMemByteAlign = 256;
+
 // Private structure used to store/load a data members of a pipeline object.
 struct SerializedData
 {
@@ -69,6 +74,14 @@ struct SerializedData
     ShaderMetadata  shaderMetadata;
 };
 
+// Payload stored in the device's PipelineDiskCache for each pipeline binary.
+struct DiskCachedMetadata
+{
+    CodeObjectMetadata metadata;
+    uint32             registersOffset;      // Offset of the register map within the ELF's metadata blob.
+    uint32             apiCreateInfoOffset;  // Offset of the API create info within the ELF's metadata blob.
+};
+
 // =====================================================================================================================
 Pipeline::Pipeline(
     Device* pDevice,
@@ -77,6 +90,10 @@ Pipeline::Pipeline(
     m_pDevice(pDevice),
     m_gpuMem(),
     m_gpuMemSize(0),
+    m_codeGpuMem(),
+    m_codeGpuMemSize(0),
+    m_codeCacheKey(0),
+    m_objectCacheKey(0),
     m_pPipelineBinary(nullptr),
     m_pipelineBinaryLen(0),
     m_apiHwMapping()
@@ -94,12 +111,32 @@ Pipeline::Pipeline(
 // =====================================================================================================================
 Pipeline::~Pipeline()
 {
+    if (m_flags.sharedState != 0)
+    {
+        // All of our GPU memory belongs to the prototype, which is destroyed along with its last user.
+        m_pDevice->GetGfxDevice()->GetPipelineObjectCache()->Release(m_objectCacheKey);
+        m_gpuMem.Update(nullptr, 0);
+        m_codeGpuMem.Update(nullptr, 0);
+        m_flags.codeInCache = 0;
+    }
+
     if (m_gpuMem.IsBound())
     {
         m_pDevice->MemMgr()->FreeGpuMem(m_gpuMem.Memory(), m_gpuMem.Offset());
         m_gpuMem.Update(nullptr, 0);
     }
 
+    if (m_flags.codeInCache != 0)
+    {
+        m_pDevice->GetGfxDevice()->GetPipelineCodeCache()->Release(m_codeCacheKey);
+        m_codeGpuMem.Update(nullptr, 0);
+    }
+    else if (m_codeGpuMem.IsBound())
+    {
+        m_pDevice->MemMgr()->FreeGpuMem(m_codeGpuMem.Memory(), m_codeGpuMem.Offset());
+        m_codeGpuMem.Update(nullptr, 0);
+    }
+
     PAL_SAFE_FREE(m_pPipelineBinary, m_pDevice->GetPlatform());
 }
 
@@ -129,6 +166,174 @@ Result Pipeline::PerformRelocationsAndUploadToGpuMemory(
     {
         m_gpuMemSize = pUploader->GpuMemSize();
         m_gpuMem.Update(pUploader->GpuMem(), pUploader->GpuMemOffset());
+
+        m_codeGpuMemSize    = pUploader->CodeGpuMemSize();
+        m_codeCacheKey      = pUploader->CodeCacheKey();
+        m_flags.codeInCache = pUploader->IsCodeShared();
+        m_codeGpuMem.Update(pUploader->CodeGpuMem(), pUploader->CodeGpuMemOffset());
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Copies the hardware-independent state of a prototype pipeline.  The GPU memory is not duplicated; the caller decides
+// whether this pipeline shares it with the prototype or takes ownership of it.
+void Pipeline::CopyStateFrom(
+    const Pipeline& prototype)
+{
+    m_info           = prototype.m_info;
+    m_shaderMetaData = prototype.m_shaderMetaData;
+    m_apiHwMapping   = prototype.m_apiHwMapping;
+
+    m_gpuMemSize     = prototype.m_gpuMemSize;
+    m_codeGpuMemSize = prototype.m_codeGpuMemSize;
+    m_codeCacheKey   = prototype.m_codeCacheKey;
+
+    m_gpuMem.Update(prototype.m_gpuMem.Memory(), prototype.m_gpuMem.Offset());
+    m_codeGpuMem.Update(prototype.m_codeGpuMem.Memory(), prototype.m_codeGpuMem.Offset());
+
+    m_flags.codeInCache = prototype.m_flags.codeInCache;
+
+    memcpy(&m_perfDataInfo[0], &prototype.m_perfDataInfo[0], sizeof(m_perfDataInfo));
+}
+
+// =====================================================================================================================
+// Initializes this pipeline by copying the state of a prototype from the device's PipelineObjectCache.  Returns false
+// if no prototype has been cached for the given hash.
+bool Pipeline::CopyFromCachedPrototype(
+    const MetroHash::Hash& hash)
+{
+    const Pipeline*const pPrototype = m_pDevice->GetGfxDevice()->GetPipelineObjectCache()->Acquire(hash);
+
+    if (pPrototype != nullptr)
+    {
+        CopyStateFrom(*pPrototype);
+
+        m_flags.sharedState = 1;
+        m_objectCacheKey    = PipelineObjectCache::KeyFromHash(hash);
+    }
+
+    return (pPrototype != nullptr);
+}
+
+// =====================================================================================================================
+// Initializes this pipeline from a freshly created internal prototype and tries to publish the prototype to the
+// device's PipelineObjectCache.  If the prototype can't be published, this pipeline takes ownership of its GPU memory
+// and the prototype is destroyed.
+void Pipeline::AdoptPrototype(
+    const MetroHash::Hash& hash,
+    Pipeline*              pPrototype)
+{
+    PAL_ASSERT((pPrototype != nullptr) && pPrototype->IsInternal());
+
+    CopyStateFrom(*pPrototype);
+
+    // Every client pipeline keeps its own copy of the ELF, so the prototype doesn't need one.
+    PAL_SAFE_FREE(pPrototype->m_pPipelineBinary, m_pDevice->GetPlatform());
+    pPrototype->m_pipelineBinaryLen = 0;
+
+    // Performance data buffers are written by the shaders, so pipelines which have them can't share GPU memory.
+    bool hasPerfData = false;
+    for (uint32 s = 0; s < static_cast<uint32>(Abi::HardwareStage::Count); ++s)
+    {
+        hasPerfData |= (m_perfDataInfo[s].sizeInBytes != 0);
+    }
+
+    if ((hasPerfData == false) &&
+        m_pDevice->GetGfxDevice()->GetPipelineObjectCache()->Insert(hash, pPrototype))
+    {
+        m_flags.sharedState = 1;
+        m_objectCacheKey    = PipelineObjectCache::KeyFromHash(hash);
+    }
+    else
+    {
+        pPrototype->m_gpuMem.Update(nullptr, 0);
+        pPrototype->m_codeGpuMem.Update(nullptr, 0);
+        pPrototype->m_flags.codeInCache = 0;
+        pPrototype->DestroyInternal();
+    }
+}
+
+// =====================================================================================================================
+// Deserializes the code object metadata of the pipeline ELF and leaves pReader positioned at the pipeline's register
+// map, just like AbiProcessor::GetMetadata().  When the device's on-disk pipeline cache is enabled, the deserialized
+// metadata is first looked up by a hash of the pipeline binary so that a binary seen in a previous run skips the
+// MsgPack parse; on a miss the parsed metadata is added to the cache.
+Result Pipeline::GetCodeObjectMetadata(
+    const AbiProcessor& abiProcessor,
+    MsgPackReader*      pReader,
+    CodeObjectMetadata* pMetadata,
+    bool*               pDiskCacheHit)
+{
+    PipelineDiskCache*const pDiskCache = m_pDevice->GetGfxDevice()->GetPipelineDiskCache();
+
+    uint32 majorVersion = 0;
+    uint32 minorVersion = 0;
+    abiProcessor.GetMetadataVersion(&majorVersion, &minorVersion);
+
+    *pDiskCacheHit = false;
+
+    Result result = Result::Success;
+
+    // Legacy metadata is translated into a temporary buffer owned by the reader, so it can't be cached.
+    if ((majorVersion == 0)                                  ||
+        (majorVersion != Abi::PipelineMetadataMajorVersion) ||
+        (pDiskCache->IsEnabled() == false))
+    {
+        result = abiProcessor.GetMetadata(pReader, pMetadata);
+    }
+    else
+    {
+        const void* pBlob    = nullptr;
+        size_t      blobSize = 0;
+        abiProcessor.GetMetadata(&pBlob, &blobSize);
+
+        MetroHash::Hash hash = { };
+        MetroHash128::Hash(static_cast<const uint8*>(m_pPipelineBinary), m_pipelineBinaryLen, &hash.bytes[0]);
+
+        DiskCachedMetadata cached;
+        result = pReader->InitFromBuffer(pBlob, static_cast<uint32>(blobSize));
+
+        if (result == Result::Success)
+        {
+            if (pDiskCache->Find(hash, &cached, sizeof(cached)))
+            {
+                *pDiskCacheHit = true;
+            }
+            else
+            {
+                memset(&cached.metadata, 0, sizeof(cached.metadata));
+                cached.registersOffset = UINT_MAX;
+
+                result = Abi::Metadata::DeserializePalCodeObjectMetadata(pReader,
+                                                                         &cached.metadata,
+                                                                         &cached.registersOffset);
+
+                if (result == Result::Success)
+                {
+                    // The API create info points into the metadata blob, so it is stored as an offset.
+                    const auto& apiCreateInfo   = cached.metadata.pipeline.apiCreateInfo;
+                    cached.apiCreateInfoOffset = (cached.metadata.pipeline.hasEntry.apiCreateInfo != 0)
+                                                 ? static_cast<uint32>(VoidPtrDiff(apiCreateInfo.pBuffer, pBlob))
+                                                 : 0;
+
+                    pDiskCache->Insert(hash, &cached, sizeof(cached));
+                }
+            }
+        }
+
+        if (result == Result::Success)
+        {
+            memcpy(pMetadata, &cached.metadata, sizeof(*pMetadata));
+
+            if (pMetadata->pipeline.hasEntry.apiCreateInfo != 0)
+            {
+                pMetadata->pipeline.apiCreateInfo.pBuffer = VoidPtrInc(pBlob, cached.apiCreateInfoOffset);
+            }
+
+            result = pReader->Seek(cached.registersOffset);
+        }
     }
 
     return result;
@@ -177,16 +382,43 @@ Result Pipeline::QueryAllocationInfo(
 
     if (pNumEntries != nullptr)
     {
-        (*pNumEntries) = 1;
+        // Pipelines using the code cache have a (possibly shared) code image followed by an optional per-pipeline
+        // allocation for registers and performance data.  All other pipelines have one allocation holding everything.
+        const size_t numEntries = (m_codeGpuMem.IsBound() ? 1 : 0) + (m_gpuMem.IsBound() ? 1 : 0);
 
-        if (pGpuMemList != nullptr)
+        if (pGpuMemList == nullptr)
+        {
+            (*pNumEntries) = numEntries;
+            result         = Result::Success;
+        }
+        else if ((numEntries > 1) && ((*pNumEntries) < numEntries))
         {
-            pGpuMemList[0].offset     = m_gpuMem.Offset();
-            pGpuMemList[0].pGpuMemory = m_gpuMem.Memory();
-            pGpuMemList[0].size       = m_gpuMemSize;
+            // Before interface version 465 a pipeline always had exactly one allocation and the input entry count was
+            // ignored, so it is only checked when there is more than one.
+            result = Result::ErrorInvalidValue;
         }
+        else
+        {
+            size_t entry = 0;
+
+            if (m_codeGpuMem.IsBound())
+            {
+                pGpuMemList[entry].offset     = m_codeGpuMem.Offset();
+                pGpuMemList[entry].pGpuMemory = m_codeGpuMem.Memory();
+                pGpuMemList[entry].size       = m_codeGpuMemSize;
+                entry++;
+            }
 
-        result = Result::Success;
+            if (m_gpuMem.IsBound())
+            {
+                pGpuMemList[entry].offset     = m_gpuMem.Offset();
+                pGpuMemList[entry].pGpuMemory = m_gpuMem.Memory();
+                pGpuMemList[entry].size       = m_gpuMemSize;
+            }
+
+            (*pNumEntries) = numEntries;
+            result         = Result::Success;
+        }
     }
 
     return result;
@@ -470,6 +702,13 @@ PipelineUploader::PipelineUploader(
     m_pGpuMemory(nullptr),
     m_baseOffset(0),
     m_gpuMemSize(0),
+    m_pCodeGpuMemory(nullptr),
+    m_codeBaseOffset(0),
+    m_codeGpuMemSize(0),
+    m_codeCacheKey(0),
+    m_codeShared(false),
+    m_prefetchGpuVirtAddr(0),
+    m_prefetchSize(0),
     m_codeGpuVirtAddr(0),
     m_dataGpuVirtAddr(0),
     m_ctxRegGpuVirtAddr(0),
@@ -496,6 +735,11 @@ PipelineUploader::~PipelineUploader()
 // Allocates GPU memory for the current pipeline.  Also, maps the memory for CPU access and uploads the pipeline code
 // and data.  The GPU virtual addresses for the code, data, and register segments are also computed.  The caller is
 // responsible for calling End() which unmaps the GPU memory.
+//
+// For clients at interface version 465 or newer, and unless the EnablePipelineCodeCache setting is off, the code and
+// data image is looked up in the device's PipelineCodeCache first so that pipelines whose code and data are
+// byte-identical share a single upload.  Registers and performance data are private to each pipeline, so they then
+// live in a separate allocation.  Otherwise, everything lives in one allocation as older clients expect.
 Result PipelineUploader::Begin(
     Device*                   pDevice,
     const AbiProcessor&       abiProcessor,
@@ -504,80 +748,288 @@ Result PipelineUploader::Begin(
 {
     PAL_ASSERT(pPerfDataInfoList != nullptr);
 
-    constexpr size_t GpuMemByteAlign = 256;
-
-    GpuMemoryCreateInfo createInfo = { };
-    createInfo.alignment = GpuMemByteAlign;
-    createInfo.vaRange   = VaRange::DescriptorTable;
-    createInfo.heaps[0]  = GpuHeapLocal;
-    createInfo.heaps[1]  = GpuHeapGartUswc;
-    createInfo.heapCount = 2;
-    createInfo.priority  = GpuMemPriority::High;
-
-    GpuMemoryInternalCreateInfo internalInfo = { };
-    internalInfo.flags.alwaysResident = 1;
-
     const void* pCodeBuffer = nullptr;
     size_t      codeLength  = 0;
     abiProcessor.GetPipelineCode(&pCodeBuffer, &codeLength);
 
-    createInfo.size = codeLength;
-
     const void* pDataBuffer   = nullptr;
     size_t      dataLength    = 0;
     gpusize     dataAlignment = 0;
     abiProcessor.GetData(&pDataBuffer, &dataLength, &dataAlignment);
 
+    gpusize imageSize = codeLength;
     if (dataLength > 0)
     {
-        createInfo.size = (Pow2Align(createInfo.size, dataAlignment) + dataLength);
+        imageSize = (Pow2Align(imageSize, dataAlignment) + dataLength);
     }
 
+    // The driver must make sure there is a distance of at least gpuInfo.shaderPrefetchBytes
+    // that follows the end of the shader to avoid a page fault when the SQ tries to
+    // prefetch past the end of a shader
+
+    // shaderPrefetchBytes is set from "SQC_CONFIG.INST_PRF_COUNT" (gfx8-9)
+    // defaulting to the hardware supported maximum if necessary
+
+    const gpusize minSafeSize = Pow2Align(codeLength, ShaderICacheLineSize) +
+                                pDevice->ChipProperties().gfxip.shaderPrefetchBytes;
+
+    // The registers and performance data are laid out in their own region; the performance data offsets computed here
+    // are relative to the start of that region.
+    gpusize privateSize = 0;
+
     const uint32 totalRegisters = (m_ctxRegisterCount + m_shRegisterCount);
     if (totalRegisters > 0)
     {
         constexpr uint32 RegisterEntryBytes = (sizeof(uint32) << 1);
-        createInfo.size = (Pow2Align(createInfo.size, sizeof(uint32)) + (RegisterEntryBytes * totalRegisters));
+        privateSize = (RegisterEntryBytes * totalRegisters);
     }
 
     // Compute the total size of all shader stages' performance data buffers.
-    gpusize performanceDataOffset = createInfo.size;
     for (uint32 s = 0; s < static_cast<uint32>(Abi::HardwareStage::Count); ++s)
     {
         const uint32 performanceDataBytes = metadata.pipeline.hardwareStage[s].perfDataBufferSize;
         if (performanceDataBytes != 0)
         {
             pPerfDataInfoList[s].sizeInBytes = performanceDataBytes;
-            pPerfDataInfoList[s].cpuOffset   = static_cast<size_t>(performanceDataOffset);
+            pPerfDataInfoList[s].cpuOffset   = static_cast<size_t>(privateSize);
 
-            createInfo.size       += performanceDataBytes;
-            performanceDataOffset += performanceDataBytes;
+            privateSize += performanceDataBytes;
         }
     } // for each hardware stage
 
-    // The driver must make sure there is a distance of at least gpuInfo.shaderPrefetchBytes
-    // that follows the end of the shader to avoid a page fault when the SQ tries to
-    // prefetch past the end of a shader
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+    const bool useCodeCache = pDevice->Settings().enablePipelineCodeCache;
+#else
+    const bool useCodeCache = false;
+#endif
 
-    // shaderPrefetchBytes is set from "SQC_CONFIG.INST_PRF_COUNT" (gfx8-9)
-    // defaulting to the hardware supported maximum if necessary
+    Result  result        = Result::Success;
+    gpusize privateOffset = 0; // Offset of the register and performance data region within m_pGpuMemory.
 
-    const gpusize minSafeSize = Pow2Align(codeLength, ShaderICacheLineSize) +
-                                pDevice->ChipProperties().gfxip.shaderPrefetchBytes;
+    if (useCodeCache)
+    {
+        imageSize = Max(imageSize, minSafeSize);
+
+        // The uploaded image depends on the raw code and data sections and on which parts of the data section get
+        // patched with internal SRD tables, so all of those go into the content hash.
+        MetroHash128 hasher;
+        hasher.Update(codeLength);
+        hasher.Update(static_cast<const uint8*>(pCodeBuffer), codeLength);
+        hasher.Update(dataLength);
+        hasher.Update(dataAlignment);
+        if (dataLength > 0)
+        {
+            hasher.Update(static_cast<const uint8*>(pDataBuffer), dataLength);
+
+            for (uint32 s = 0; s < static_cast<uint32>(Abi::HardwareStage::Count); ++s)
+            {
+                const Abi::PipelineSymbolType symbolType =
+                    Abi::GetSymbolForStage(Abi::PipelineSymbolType::ShaderIntrlTblPtr,
+                                           static_cast<Abi::HardwareStage>(s));
 
-    createInfo.size = Max(createInfo.size, minSafeSize);
+                Abi::PipelineSymbolEntry symbol = { };
+                if (abiProcessor.HasPipelineSymbolEntry(symbolType, &symbol) &&
+                    (symbol.sectionType == Abi::AbiSectionType::Data))
+                {
+                    hasher.Update(symbol.value);
+                    hasher.Update(symbol.size);
+                }
+            }
+        }
+        hasher.Update(imageSize);
+
+        MetroHash::Hash hash = { };
+        hasher.Finalize(hash.bytes);
+
+        m_codeCacheKey = PipelineCodeCache::KeyFromHash(hash);
+
+        PipelineCodeCache*const pCodeCache = pDevice->GetGfxDevice()->GetPipelineCodeCache();
+        PipelineCodeCacheEntry  entry      = { };
+
+        if (pCodeCache->Acquire(hash, &entry))
+        {
+            m_pCodeGpuMemory  = entry.pGpuMemory;
+            m_codeBaseOffset  = entry.offset;
+            m_codeGpuMemSize  = entry.size;
+            m_codeGpuVirtAddr = entry.codeGpuVirtAddr;
+            m_dataGpuVirtAddr = entry.dataGpuVirtAddr;
+            m_prefetchSize    = entry.prefetchSize;
+            m_codeShared      = true;
+        }
+        else
+        {
+            result = UploadCode(pDevice, abiProcessor, imageSize, &m_pCodeGpuMemory, &m_codeBaseOffset, nullptr);
 
-    Result result = pDevice->MemMgr()->AllocateGpuMem(createInfo, internalInfo, false, &m_pGpuMemory, &m_baseOffset);
+            if (result == Result::Success)
+            {
+                m_codeGpuMemSize = imageSize;
+
+                entry.pGpuMemory      = m_pCodeGpuMemory;
+                entry.offset          = m_codeBaseOffset;
+                entry.size            = m_codeGpuMemSize;
+                entry.codeGpuVirtAddr = m_codeGpuVirtAddr;
+                entry.dataGpuVirtAddr = m_dataGpuVirtAddr;
+                entry.prefetchSize    = m_prefetchSize;
+
+                // If this fails, another thread has published the same image first.  Keep ours as a private copy.
+                m_codeShared = pCodeCache->Insert(hash, entry);
+            }
+        }
+
+        if ((result == Result::Success) && (privateSize > 0))
+        {
+            GpuMemoryCreateInfo createInfo = { };
+            createInfo.size      = privateSize;
+            createInfo.alignment = GpuMemByteAlign;
+            createInfo.vaRange   = VaRange::DescriptorTable;
+            createInfo.heaps[0]  = GpuHeapLocal;
+            createInfo.heaps[1]  = GpuHeapGartUswc;
+            createInfo.heapCount = 2;
+            createInfo.priority  = GpuMemPriority::High;
+
+            GpuMemoryInternalCreateInfo internalInfo = { };
+            internalInfo.flags.alwaysResident = 1;
+
+            result = pDevice->MemMgr()->AllocateGpuMem(createInfo, internalInfo, false, &m_pGpuMemory, &m_baseOffset);
+            if (result == Result::Success)
+            {
+                result = m_pGpuMemory->Map(&m_pMappedPtr);
+                if (result == Result::Success)
+                {
+                    m_gpuMemSize = createInfo.size;
+                    m_pMappedPtr = VoidPtrInc(m_pMappedPtr, static_cast<size_t>(m_baseOffset));
+                }
+                else
+                {
+                    m_pMappedPtr = nullptr;
+                    pDevice->MemMgr()->FreeGpuMem(m_pGpuMemory, m_baseOffset);
+                    m_pGpuMemory = nullptr;
+                    m_baseOffset = 0;
+                }
+            }
+        }
+    }
+    else
+    {
+        // The code and data image is followed by the registers and performance data in a single allocation which
+        // stays mapped until End().  The pipeline owns it as its only allocation.
+        privateOffset = Pow2Align(imageSize, sizeof(uint32));
+
+        const gpusize allocSize = Max(privateOffset + privateSize, minSafeSize);
+
+        result = UploadCode(pDevice, abiProcessor, allocSize, &m_pGpuMemory, &m_baseOffset, &m_pMappedPtr);
+
+        if (result == Result::Success)
+        {
+            m_gpuMemSize = allocSize;
+        }
+    }
+
+    m_prefetchGpuVirtAddr = m_codeGpuVirtAddr;
+
+    if ((result == Result::Success) && (privateSize > 0))
+    {
+        void*const    pPrivateData    = VoidPtrInc(m_pMappedPtr, static_cast<size_t>(privateOffset));
+        const gpusize privateVirtAddr = (m_pGpuMemory->Desc().gpuVirtAddr + m_baseOffset + privateOffset);
+
+        if (totalRegisters > 0)
+        {
+            gpusize regGpuVirtAddr = privateVirtAddr;
+            uint32* pRegWritePtr   = static_cast<uint32*>(pPrivateData);
+
+            if (m_ctxRegisterCount > 0)
+            {
+                m_ctxRegGpuVirtAddr = regGpuVirtAddr;
+                m_pCtxRegWritePtr   = pRegWritePtr;
+
+                regGpuVirtAddr += (m_ctxRegisterCount * (sizeof(uint32) * 2));
+                pRegWritePtr   += (m_ctxRegisterCount * 2);
+            }
+
+            if (m_shRegisterCount > 0)
+            {
+                m_shRegGpuVirtAddr = regGpuVirtAddr;
+                m_pShRegWritePtr   = pRegWritePtr;
+            }
+
+#if PAL_ENABLE_PRINTS_ASSERTS
+            m_pCtxRegWritePtrStart = m_pCtxRegWritePtr;
+            m_pShRegWritePtrStart  = m_pShRegWritePtr;
+#endif
+        }
+
+        // Initialize the performance data buffer for each shader stage and finalize its GPU virtual address.  Its CPU
+        // offset is rebased to be relative to the start of the pipeline's allocation.
+        for (uint32 s = 0; s < static_cast<uint32>(Abi::HardwareStage::Count); ++s)
+        {
+            if (pPerfDataInfoList[s].sizeInBytes != 0)
+            {
+                const size_t offset = pPerfDataInfoList[s].cpuOffset;
+                pPerfDataInfoList[s].gpuVirtAddr = LowPart(privateVirtAddr + offset);
+                pPerfDataInfoList[s].cpuOffset   = static_cast<size_t>(privateOffset + offset);
+                memset(VoidPtrInc(pPrivateData, offset), 0, pPerfDataInfoList[s].sizeInBytes);
+            }
+        } // for each hardware stage
+    }
+
+    if (result != Result::Success)
+    {
+        ReleaseCode(pDevice);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Allocates a new allocation of allocSize bytes, copies the pipeline code and data into the start of it and patches the
+// internal SRD tables.  If ppMappedPtr is null, the allocation is unmapped again before returning since the image is
+// never written after upload; otherwise the caller receives the mapped address of the allocation and must unmap it.
+Result PipelineUploader::UploadCode(
+    Device*             pDevice,
+    const AbiProcessor& abiProcessor,
+    gpusize             allocSize,
+    GpuMemory**         ppGpuMemory,
+    gpusize*            pOffset,
+    void**              ppMappedPtr)
+{
+    const void* pCodeBuffer = nullptr;
+    size_t      codeLength  = 0;
+    abiProcessor.GetPipelineCode(&pCodeBuffer, &codeLength);
+
+    const void* pDataBuffer   = nullptr;
+    size_t      dataLength    = 0;
+    gpusize     dataAlignment = 0;
+    abiProcessor.GetData(&pDataBuffer, &dataLength, &dataAlignment);
+
+    GpuMemoryCreateInfo createInfo = { };
+    createInfo.size      = allocSize;
+    createInfo.alignment = GpuMemByteAlign;
+    createInfo.vaRange   = VaRange::DescriptorTable;
+    createInfo.heaps[0]  = GpuHeapLocal;
+    createInfo.heaps[1]  = GpuHeapGartUswc;
+    createInfo.heapCount = 2;
+    createInfo.priority  = GpuMemPriority::High;
+
+    GpuMemoryInternalCreateInfo internalInfo = { };
+    internalInfo.flags.alwaysResident = 1;
+
+    Result result = pDevice->MemMgr()->AllocateGpuMem(createInfo, internalInfo, false, ppGpuMemory, pOffset);
     if (result == Result::Success)
     {
-        result = m_pGpuMemory->Map(&m_pMappedPtr);
+        GpuMemory*const pGpuMemory = *ppGpuMemory;
+
+        void* pMappedPtr = nullptr;
+        result = pGpuMemory->Map(&pMappedPtr);
         if (result == Result::Success)
         {
-            m_gpuMemSize = createInfo.size;
-            m_pMappedPtr = VoidPtrInc(m_pMappedPtr, static_cast<size_t>(m_baseOffset));
+            pMappedPtr = VoidPtrInc(pMappedPtr, static_cast<size_t>(*pOffset));
+
+            if (ppMappedPtr != nullptr)
+            {
+                *ppMappedPtr = pMappedPtr;
+            }
 
-            gpusize gpuVirtAddr = (m_pGpuMemory->Desc().gpuVirtAddr + m_baseOffset);
-            void*   pMappedPtr  = m_pMappedPtr;
+            gpusize gpuVirtAddr = (pGpuMemory->Desc().gpuVirtAddr + *pOffset);
 
             m_codeGpuVirtAddr = gpuVirtAddr;
             memcpy(pMappedPtr, pCodeBuffer, codeLength);
@@ -585,8 +1037,7 @@ Result PipelineUploader::Begin(
             pMappedPtr   = VoidPtrInc(pMappedPtr, codeLength);
             gpuVirtAddr += codeLength;
 
-            m_prefetchGpuVirtAddr = m_codeGpuVirtAddr;
-            m_prefetchSize        = codeLength;
+            m_prefetchSize = codeLength;
 
             if (dataLength > 0)
             {
@@ -617,55 +1068,50 @@ Result PipelineUploader::Begin(
                 } // for each hardware stage
                 // End temporary code
 
-                pMappedPtr   = VoidPtrInc(pMappedPtr, dataLength);
                 gpuVirtAddr += dataLength;
 
-                m_prefetchSize = gpuVirtAddr - m_prefetchGpuVirtAddr;
+                m_prefetchSize = gpuVirtAddr - m_codeGpuVirtAddr;
             } // if dataLength > 0
 
-            if (totalRegisters > 0)
+            if (ppMappedPtr == nullptr)
             {
-                gpusize regGpuVirtAddr = Pow2Align(gpuVirtAddr, sizeof(uint32));
-                uint32* pRegWritePtr   = static_cast<uint32*>(VoidPtrAlign(pMappedPtr, sizeof(uint32)));
-
-                if (m_ctxRegisterCount > 0)
-                {
-                    m_ctxRegGpuVirtAddr = regGpuVirtAddr;
-                    m_pCtxRegWritePtr   = pRegWritePtr;
-
-                    regGpuVirtAddr += (m_ctxRegisterCount * (sizeof(uint32) * 2));
-                    pRegWritePtr   += (m_ctxRegisterCount * 2);
-                }
-
-                if (m_shRegisterCount > 0)
-                {
-                    m_shRegGpuVirtAddr = regGpuVirtAddr;
-                    m_pShRegWritePtr   = pRegWritePtr;
-                }
-
-#if PAL_ENABLE_PRINTS_ASSERTS
-                m_pCtxRegWritePtrStart = m_pCtxRegWritePtr;
-                m_pShRegWritePtrStart  = m_pShRegWritePtr;
-#endif
+                pGpuMemory->Unmap();
             }
-
-            // Initialize the performance data buffer for each shader stage and finalize its GPU virtual address.
-            for (uint32 s = 0; s < static_cast<uint32>(Abi::HardwareStage::Count); ++s)
-            {
-                if (pPerfDataInfoList[s].sizeInBytes != 0)
-                {
-                    const size_t offset = pPerfDataInfoList[s].cpuOffset;
-                    pPerfDataInfoList[s].gpuVirtAddr = LowPart(gpuVirtAddr + offset);
-                    memset(VoidPtrInc(m_pMappedPtr, offset), 0, pPerfDataInfoList[s].sizeInBytes);
-                }
-            } // for each hardware stage
-
-        } // if Map() succeeded
+        }
+        else
+        {
+            pDevice->MemMgr()->FreeGpuMem(pGpuMemory, *pOffset);
+            *ppGpuMemory = nullptr;
+            *pOffset     = 0;
+        }
     } // if AllocateGpuMem() succeeded
 
     return result;
 }
 
+// =====================================================================================================================
+// Drops this uploader's claim on the code and data image after a failed Begin().
+void PipelineUploader::ReleaseCode(
+    Device* pDevice)
+{
+    if (m_pCodeGpuMemory != nullptr)
+    {
+        if (m_codeShared)
+        {
+            pDevice->GetGfxDevice()->GetPipelineCodeCache()->Release(m_codeCacheKey);
+        }
+        else
+        {
+            pDevice->MemMgr()->FreeGpuMem(m_pCodeGpuMemory, m_codeBaseOffset);
+        }
+
+        m_pCodeGpuMemory = nullptr;
+        m_codeBaseOffset = 0;
+        m_codeGpuMemSize = 0;
+        m_codeShared     = false;
+    }
+}
+
 // =====================================================================================================================
 // "Finishes" uploading a pipeline to GPU memory by unmapping the GPU allocation.
 void PipelineUploader::End()
@@ -139,11 +139,25 @@ protected:
 
     bool IsInternal() const { return m_flags.isInternal != 0; }
 
+    // Copies all state except the ELF binary from a prototype of the same concrete type.  Hardware layers which can
+    // share their state through the PipelineObjectCache override this and SupportsObjectCache().
+    virtual void CopyStateFrom(const Pipeline& prototype);
+    virtual bool SupportsObjectCache() const { return false; }
+
+    bool CopyFromCachedPrototype(const Util::MetroHash::Hash& hash);
+    void AdoptPrototype(const Util::MetroHash::Hash& hash, Pipeline* pPrototype);
+
     Result PerformRelocationsAndUploadToGpuMemory(
         const AbiProcessor&       abiProcessor,
         const CodeObjectMetadata& metadata,
         PipelineUploader*         pUploader);
 
+    Result GetCodeObjectMetadata(
+        const AbiProcessor&  abiProcessor,
+        Util::MsgPackReader* pReader,
+        CodeObjectMetadata*  pMetadata,
+        bool*                pDiskCacheHit);
+
     void ExtractPipelineInfo(
         const CodeObjectMetadata& metadata,
         ShaderType                firstShader,
@@ -171,8 +185,12 @@ protected:
     PipelineInfo    m_info;             // Public info structure available to the client.
     ShaderMetadata  m_shaderMetaData;   // Metadata flags for each shader type.
 
-    BoundGpuMemory  m_gpuMem;
+    BoundGpuMemory  m_gpuMem;           // Per-pipeline registers and performance data; may be unbound.
     gpusize         m_gpuMemSize;
+    BoundGpuMemory  m_codeGpuMem;       // Code and data image; may be shared with other pipelines.
+    gpusize         m_codeGpuMemSize;
+    uint64          m_codeCacheKey;     // Key of the shared code image in the device's PipelineCodeCache.
+    uint64          m_objectCacheKey;   // Key of the prototype in the device's PipelineObjectCache.
 
     void*   m_pPipelineBinary;      // Buffer containing the pipeline binary data (Pipeline ELF ABI).
     size_t  m_pipelineBinaryLen;    // Size of the pipeline binary data, in bytes.
@@ -186,7 +204,9 @@ private:
         struct
         {
             uint32  isInternal       :  1;  // True if this Pipeline object was created internally by PAL.
-            uint32  reserved         : 31;
+            uint32  codeInCache      :  1;  // True if m_codeGpuMem is owned by the device's PipelineCodeCache.
+            uint32  sharedState      :  1;  // True if all GPU memory is owned by a PipelineObjectCache prototype.
+            uint32  reserved         : 29;
         };
         uint32  value;  // Flags packed as a uint32.
     } m_flags;
@@ -222,6 +242,12 @@ public:
     gpusize GpuMemSize() const { return m_gpuMemSize; }
     gpusize GpuMemOffset() const { return m_baseOffset; }
 
+    GpuMemory* CodeGpuMem() const { return m_pCodeGpuMemory; }
+    gpusize CodeGpuMemSize() const { return m_codeGpuMemSize; }
+    gpusize CodeGpuMemOffset() const { return m_codeBaseOffset; }
+    bool IsCodeShared() const { return m_codeShared; }
+    uint64 CodeCacheKey() const { return m_codeCacheKey; }
+
     gpusize CodeGpuVirtAddr() const { return m_codeGpuVirtAddr; }
     gpusize DataGpuVirtAddr() const { return m_dataGpuVirtAddr; }
     gpusize CtxRegGpuVirtAddr() const { return m_ctxRegGpuVirtAddr; }
@@ -248,10 +274,26 @@ protected:
     }
 
 private:
-    GpuMemory*  m_pGpuMemory;
+    Result UploadCode(
+        Device*             pDevice,
+        const AbiProcessor& abiProcessor,
+        gpusize             allocSize,
+        GpuMemory**         ppGpuMemory,
+        gpusize*            pOffset,
+        void**              ppMappedPtr);
+
+    void ReleaseCode(Device* pDevice);
+
+    GpuMemory*  m_pGpuMemory;   // Registers and performance data, private to this pipeline.
     gpusize     m_baseOffset;
     gpusize     m_gpuMemSize;
 
+    GpuMemory*  m_pCodeGpuMemory;   // Code and data image, possibly shared through the PipelineCodeCache.
+    gpusize     m_codeBaseOffset;
+    gpusize     m_codeGpuMemSize;
+    uint64      m_codeCacheKey;
+    bool        m_codeShared;
+
     gpusize     m_prefetchGpuVirtAddr;
     gpusize     m_prefetchSize;
 
@@ -0,0 +1,142 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2014-2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/device.h"
+#include "core/platform.h"
+#include "core/hw/gfxip/pipelineCodeCache.h"
+#include "palHashMapImpl.h"
+
+using namespace Util;
+
+namespace Pal
+{
+
+// =====================================================================================================================
+PipelineCodeCache::PipelineCodeCache(
+    Device* pDevice)
+    :
+    m_pDevice(pDevice),
+    m_entryMap(NumBuckets, pDevice->GetPlatform()),
+    m_initialized(false)
+{
+}
+
+// =====================================================================================================================
+PipelineCodeCache::~PipelineCodeCache()
+{
+    // Every pipeline must have released its reference before the device is destroyed.
+    PAL_ASSERT((m_initialized == false) || (m_entryMap.GetNumEntries() == 0));
+}
+
+// =====================================================================================================================
+Result PipelineCodeCache::Init()
+{
+    Result result = m_lock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_entryMap.Init();
+    }
+
+    m_initialized = (result == Result::Success);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Looks up a previously uploaded image with the given content hash.  On a hit, a reference is added on behalf of the
+// caller and the image's description is returned in pEntry.  Returns false if no matching image exists.
+bool PipelineCodeCache::Acquire(
+    const MetroHash::Hash&  hash,
+    PipelineCodeCacheEntry* pEntry)
+{
+    PAL_ASSERT(pEntry != nullptr);
+
+    bool found = false;
+
+    if (m_initialized)
+    {
+        MutexAuto lock(&m_lock);
+
+        PipelineCodeCacheEntry*const pCached = m_entryMap.FindKey(KeyFromHash(hash));
+        if ((pCached != nullptr) && (pCached->hashHigh == hash.qwords[1]))
+        {
+            pCached->refCount++;
+            (*pEntry) = (*pCached);
+            found     = true;
+        }
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Publishes a freshly uploaded image under the given content hash.  On success, the cache takes ownership of the
+// image's GPU memory and the caller holds the first reference.  Returns false if the image could not be added (e.g.,
+// another thread published an identical image first), in which case the caller keeps ownership of its private copy.
+bool PipelineCodeCache::Insert(
+    const MetroHash::Hash&        hash,
+    const PipelineCodeCacheEntry& entry)
+{
+    bool inserted = false;
+
+    if (m_initialized)
+    {
+        MutexAuto lock(&m_lock);
+
+        bool                    existed = false;
+        PipelineCodeCacheEntry* pCached = nullptr;
+        if ((m_entryMap.FindAllocate(KeyFromHash(hash), &existed, &pCached) == Result::Success) && (existed == false))
+        {
+            (*pCached)        = entry;
+            pCached->hashHigh = hash.qwords[1];
+            pCached->refCount = 1;
+            inserted          = true;
+        }
+    }
+
+    return inserted;
+}
+
+// =====================================================================================================================
+// Drops one reference on the image stored under the given key, freeing its GPU memory once no pipeline uses it.
+void PipelineCodeCache::Release(
+    uint64 key)
+{
+    PAL_ASSERT(m_initialized);
+
+    MutexAuto lock(&m_lock);
+
+    PipelineCodeCacheEntry*const pCached = m_entryMap.FindKey(key);
+    PAL_ASSERT((pCached != nullptr) && (pCached->refCount > 0));
+
+    if ((pCached != nullptr) && (--pCached->refCount == 0))
+    {
+        m_pDevice->MemMgr()->FreeGpuMem(pCached->pGpuMemory, pCached->offset);
+        m_entryMap.Erase(key);
+    }
+}
+
+} // Pal
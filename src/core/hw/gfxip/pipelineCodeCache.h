@@ -0,0 +1,87 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2014-2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "core/gpuMemory.h"
+#include "palHashMap.h"
+#include "palMetroHash.h"
+#include "palMutex.h"
+
+namespace Pal
+{
+
+class Device;
+class Platform;
+
+// Describes one uploaded pipeline code and data image which may be shared by several pipelines.
+struct PipelineCodeCacheEntry
+{
+    GpuMemory*  pGpuMemory;       // Sub-allocation holding the code and data image.
+    gpusize     offset;           // Offset of the image within pGpuMemory.
+    gpusize     size;             // Size of the image, including the shader prefetch padding.
+    gpusize     codeGpuVirtAddr;  // GPU virtual address of the pipeline code.
+    gpusize     dataGpuVirtAddr;  // GPU virtual address of the pipeline data, or zero if there is none.
+    gpusize     prefetchSize;     // Number of bytes of code and data which may be prefetched.
+    uint64      hashHigh;         // High half of the 128-bit content hash; guards against key collisions.
+    uint32      refCount;         // Number of pipelines referencing this image.
+};
+
+// =====================================================================================================================
+// Device-wide, reference-counted store of pipeline code and data images keyed by a hash of their contents.  Pipelines
+// which are byte-identical in their code and (pre-relocation) data sections share a single GPU upload; the upload is
+// freed when the last pipeline referencing it is destroyed.
+//
+// All methods are thread-safe.
+class PipelineCodeCache
+{
+public:
+    explicit PipelineCodeCache(Device* pDevice);
+    ~PipelineCodeCache();
+
+    Result Init();
+
+    bool Acquire(const Util::MetroHash::Hash& hash, PipelineCodeCacheEntry* pEntry);
+    bool Insert(const Util::MetroHash::Hash& hash, const PipelineCodeCacheEntry& entry);
+    void Release(uint64 key);
+
+    // Returns the key under which an image with the specified content hash is stored.
+    static uint64 KeyFromHash(const Util::MetroHash::Hash& hash) { return hash.qwords[0]; }
+
+private:
+    typedef Util::HashMap<uint64, PipelineCodeCacheEntry, Platform> EntryMap;
+
+    static constexpr uint32 NumBuckets = 256;
+
+    Device*const  m_pDevice;
+    EntryMap      m_entryMap;
+    Util::Mutex   m_lock;
+    bool          m_initialized;
+
+    PAL_DISALLOW_DEFAULT_CTOR(PipelineCodeCache);
+    PAL_DISALLOW_COPY_AND_ASSIGN(PipelineCodeCache);
+};
+
+} // Pal
@@ -0,0 +1,639 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2014-2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/device.h"
+#include "core/platform.h"
+#include "core/hw/gfxip/pipeline.h"
+#include "core/hw/gfxip/pipelineDiskCache.h"
+#include "palDbgPrint.h"
+#include "palFile.h"
+#include "palHashMapImpl.h"
+#include <cstdio>
+
+using namespace Util;
+
+namespace Pal
+{
+
+// Identifies a PAL pipeline disk cache file ("PPDC").
+constexpr uint32 DiskCacheMagic         = 0x43445050;
+// Version of the file layout described by DiskHeader and RecordHeader.
+constexpr uint32 DiskCacheLayoutVersion = 1;
+// Size new cache files start out with.  The MemMapFile grows it as records are appended.
+constexpr size_t InitialFileSize        = 0x10000;
+// Number of records appended between flushes of the cache file.  Any records still unflushed are flushed when the file
+// is closed.
+constexpr uint32 FlushBatchSize         = 16;
+
+// =====================================================================================================================
+// Returns a version for the payloads stored by pipelines.  Records hold deserialized pipeline metadata (see
+// Pipeline::GetCodeObjectMetadata()), so files written by a PAL with a different metadata layout must be discarded.
+static uint32 ContentVersion()
+{
+    const uint32 versionInfo[] =
+    {
+        PAL_CLIENT_INTERFACE_MAJOR_VERSION,
+        Abi::PipelineMetadataMajorVersion,
+        Abi::PipelineMetadataMinorVersion,
+        static_cast<uint32>(sizeof(CodeObjectMetadata)),
+    };
+
+    uint64 hash = 0;
+    MetroHash64::Hash(reinterpret_cast<const uint8*>(&versionInfo[0]),
+                      sizeof(versionInfo),
+                      reinterpret_cast<uint8*>(&hash));
+
+    return MetroHash::Compact32(hash);
+}
+
+// =====================================================================================================================
+PipelineDiskCache::PipelineDiskCache(
+    Device* pDevice)
+    :
+    m_pDevice(pDevice),
+    m_entryMap(NumBuckets, pDevice->GetPlatform()),
+    m_viewSize(0),
+    m_indexedSize(0),
+    m_maxSize(0),
+    m_numUnflushed(0),
+    m_initialized(false),
+    m_openAttempted(false),
+    m_isOpen(false),
+    m_numHits(0),
+    m_numMisses(0)
+{
+    m_filePath[0] = '\0';
+    m_lockPath[0] = '\0';
+}
+
+// =====================================================================================================================
+PipelineDiskCache::~PipelineDiskCache()
+{
+    CloseFile();
+}
+
+// =====================================================================================================================
+Result PipelineDiskCache::Init()
+{
+    Result result = m_lock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_entryMap.Init();
+    }
+
+    m_initialized = (result == Result::Success);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Returns true if pipelines should consult this cache.
+bool PipelineDiskCache::IsEnabled() const
+{
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+    const PalPublicSettings& settings = *m_pDevice->GetPublicSettings();
+
+    return m_initialized                                 &&
+           (settings.shaderCacheMode == ShaderCacheOnDisk) &&
+           (settings.pipelineDiskCacheDirectory[0] != '\0');
+#else
+    // Older clients have no way to tell PAL where to put the cache file.
+    return false;
+#endif
+}
+
+// =====================================================================================================================
+// Copies the payload stored for the given hash into pData.  Returns false on a miss, or if the stored payload isn't
+// exactly dataSize bytes.
+bool PipelineDiskCache::Find(
+    const MetroHash::Hash& hash,
+    void*                  pData,
+    size_t                 dataSize)
+{
+    bool found = false;
+
+    MutexAuto lock(&m_lock);
+
+    if (BeginFileAccess())
+    {
+        const Entry*const pEntry = m_entryMap.FindKey(hash.qwords[0]);
+
+        if ((pEntry != nullptr) && (pEntry->hashHigh == hash.qwords[1]))
+        {
+            RecordHeader*const pRecord = RecordAt(pEntry->offset);
+
+            // The file is shared with other processes, so validate the record again before trusting its payload.
+            if ((pRecord->hash[0]     == hash.qwords[0]) &&
+                (pRecord->hash[1]     == hash.qwords[1]) &&
+                (pRecord->payloadSize == dataSize)       &&
+                (pRecord->checksum    == ChecksumPayload(*pRecord)))
+            {
+                memcpy(pData, (pRecord + 1), dataSize);
+
+                pRecord->lastUse = ++Header()->useClock;
+                found            = true;
+            }
+        }
+
+        EndFileAccess();
+    }
+
+    if (found)
+    {
+        m_numHits++;
+    }
+    else
+    {
+        m_numMisses++;
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Appends a record holding a copy of pData under the given hash, unless one is already stored.  Failures are not
+// reported since the cache is only an optimization; a file which can't be written to is simply no longer used.
+void PipelineDiskCache::Insert(
+    const MetroHash::Hash& hash,
+    const void*            pData,
+    size_t                 dataSize)
+{
+    MutexAuto lock(&m_lock);
+
+    if (BeginFileAccess())
+    {
+        if (m_entryMap.FindKey(hash.qwords[0]) == nullptr)
+        {
+            const size_t offset     = m_file.GetUsedStorageSize();
+            const size_t recordSize = RecordSize(dataSize);
+
+            Result result = m_file.GetNewStorageSpace(recordSize, false, nullptr);
+
+            if ((result == Result::Success) && (m_file.GetStorageSize() != m_viewSize))
+            {
+                // The file grew, so the view must be extended to cover the new space.
+                result = MapStorage();
+            }
+
+            if (result == Result::Success)
+            {
+                RecordHeader*const pRecord = RecordAt(offset);
+
+                pRecord->hash[0]     = hash.qwords[0];
+                pRecord->hash[1]     = hash.qwords[1];
+                pRecord->payloadSize = static_cast<uint32>(dataSize);
+                pRecord->reserved    = 0;
+                pRecord->lastUse     = ++Header()->useClock;
+                memcpy((pRecord + 1), pData, dataSize);
+                pRecord->checksum    = ChecksumPayload(*pRecord);
+
+                result = m_file.ManualStorageAdvance(recordSize);
+            }
+
+            if ((result == Result::Success) && (++m_numUnflushed >= FlushBatchSize))
+            {
+                // Flushing every record would stall each miss on the disk while other threads and processes wait for
+                // the cache.  A record whose data is lost in a crash while the storage end already covers it fails its
+                // checksum, and is dropped the next time the file is opened.
+                m_file.Flush();
+                m_numUnflushed = 0;
+            }
+
+            if (result == Result::Success)
+            {
+                bool   existed = false;
+                Entry* pEntry  = nullptr;
+                result = m_entryMap.FindAllocate(hash.qwords[0], &existed, &pEntry);
+
+                if (result == Result::Success)
+                {
+                    pEntry->hashHigh = hash.qwords[1];
+                    pEntry->offset   = offset;
+                    m_indexedSize    = offset + recordSize;
+                }
+            }
+
+            if ((result == Result::Success) && (m_maxSize != 0) && (m_file.GetUsedStorageSize() > m_maxSize))
+            {
+                result = Compact();
+            }
+
+            if (result != Result::Success)
+            {
+                CloseFile();
+                m_isOpen = false;
+            }
+        }
+
+        EndFileAccess();
+    }
+}
+
+// =====================================================================================================================
+// Takes the lock which serializes access to the cache file between processes, then brings this process's view of the
+// file up to date.  The cache file's name is built the first time the cache is used.  Returns true if the file is
+// usable, in which case EndFileAccess() must be called once the caller is done with it.  Must be called with m_lock
+// held.
+bool PipelineDiskCache::BeginFileAccess()
+{
+    if (m_openAttempted == false)
+    {
+        m_openAttempted = true;
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+        const PalPublicSettings& settings  = *m_pDevice->GetPublicSettings();
+        const GpuChipProperties& chipProps = m_pDevice->ChipProperties();
+
+        // Each GPU gets its own file, named after its PCI location so that the name is stable across runs.
+        Snprintf(&m_filePath[0],
+                 sizeof(m_filePath),
+                 "%s/PalPipelineCache_%x_%x_%x_%x.bin",
+                 &settings.pipelineDiskCacheDirectory[0],
+                 chipProps.pciDomainNumber,
+                 chipProps.pciBusNumber,
+                 chipProps.pciDeviceNumber,
+                 chipProps.pciFunctionNumber);
+        Snprintf(&m_lockPath[0], sizeof(m_lockPath), "%s.lock", &m_filePath[0]);
+
+        m_maxSize = static_cast<size_t>(settings.pipelineDiskCacheMaxSize);
+
+        // The lock file stays empty and is never renamed or deleted, so every process locks the same file.
+        m_isOpen = (m_lockFile.Create(&m_lockPath[0], true, 0, nullptr) == Result::Success);
+#endif
+    }
+
+    bool usable = m_isOpen && (m_lockFile.Lock(true) == Result::Success);
+
+    if (usable && (SyncWithFile() != Result::Success))
+    {
+        EndFileAccess();
+        usable = false;
+    }
+
+    if ((usable == false) && m_isOpen)
+    {
+        CloseFile();
+        m_isOpen = false;
+    }
+
+    return usable;
+}
+
+// =====================================================================================================================
+// Catches up with the changes other processes made to the cache file since this process last held the file lock.  This
+// also opens and indexes the file the first time the cache is used.  Any file which can't be read back is replaced by
+// an empty one.  Must be called with m_lock and the file lock held.
+Result PipelineDiskCache::SyncWithFile()
+{
+    Result result          = Result::Success;
+    bool   needsCompaction = false;
+
+    if (m_file.IsFileReplaced())
+    {
+        // Either the file isn't open yet, or another process compacted it (or discarded it) since we last looked.  Our
+        // view still maps the old file in the latter case, so it is reopened by name and indexed from scratch.
+        result = OpenFile(false);
+
+        if (result == Result::Success)
+        {
+            result = BuildIndex(&needsCompaction);
+        }
+
+        if (result != Result::Success)
+        {
+            // The file is unreadable or was written by an incompatible version of PAL.  Start over.
+            needsCompaction = false;
+            result          = OpenFile(true);
+        }
+    }
+    else if (m_file.GetUsedStorageSize() > m_indexedSize)
+    {
+        // Other processes appended records.  The file may have grown past the end of our view while doing so.
+        result = m_file.ReloadIfNeeded(nullptr);
+
+        if ((result == Result::Success) && (m_file.GetStorageSize() != m_viewSize))
+        {
+            result = MapStorage();
+        }
+
+        if (result == Result::Success)
+        {
+            result = IndexRecords(&needsCompaction);
+        }
+    }
+
+    if ((result == Result::Success) &&
+        (needsCompaction || ((m_maxSize != 0) && (m_file.GetUsedStorageSize() > m_maxSize))))
+    {
+        result = Compact();
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Opens (or creates) the cache file and maps its storage.  When discardContents is set, any existing file is deleted
+// first.  A new file is given a fresh DiskHeader.
+Result PipelineDiskCache::OpenFile(
+    bool discardContents)
+{
+    CloseFile();
+
+    if (discardContents)
+    {
+        remove(&m_filePath[0]);
+    }
+
+    const bool existed = File::Exists(&m_filePath[0]);
+
+    Result result = m_file.OpenStorageFile((StorageAccessModeFlags::Writeable | StorageAccessModeFlags::AllowGrowth),
+                                           (existed ? 0 : InitialFileSize),
+                                           &m_filePath[0],
+                                           nullptr);
+
+    if (result == Result::Success)
+    {
+        result = MapStorage();
+    }
+
+    if ((result == Result::Success) && (existed == false))
+    {
+        result = m_file.GetNewStorageSpace(sizeof(DiskHeader), true, nullptr);
+
+        if (result == Result::Success)
+        {
+            DiskHeader*const pHeader = Header();
+
+            pHeader->magic          = DiskCacheMagic;
+            pHeader->layoutVersion  = DiskCacheLayoutVersion;
+            pHeader->contentVersion = ContentVersion();
+            pHeader->reserved       = 0;
+            pHeader->useClock       = 0;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+void PipelineDiskCache::CloseFile()
+{
+    if (m_numUnflushed > 0)
+    {
+        m_file.Flush();
+        m_numUnflushed = 0;
+    }
+
+    m_view.UnMap(false);
+    m_viewSize    = 0;
+    m_indexedSize = 0;
+
+    m_file.CloseStorageFile();
+    m_entryMap.Reset();
+}
+
+// =====================================================================================================================
+// (Re)maps a view covering all of the file's storage.
+Result PipelineDiskCache::MapStorage()
+{
+    m_view.UnMap(false);
+    m_viewSize = m_file.GetStorageSize();
+
+    return m_file.GetExistingStorage(0, m_viewSize, &m_view);
+}
+
+// =====================================================================================================================
+// Validates the file's header and builds the in-memory index of its records from scratch.
+Result PipelineDiskCache::BuildIndex(
+    bool* pNeedsCompaction)
+{
+    Result result = Result::ErrorUnknown;
+
+    m_entryMap.Reset();
+    m_indexedSize = sizeof(DiskHeader);
+
+    const DiskHeader* pHeader = Header();
+
+    if ((m_file.GetUsedStorageSize() >= sizeof(DiskHeader))     &&
+        (m_viewSize                  >= sizeof(DiskHeader))     &&
+        (pHeader->magic              == DiskCacheMagic)         &&
+        (pHeader->layoutVersion      == DiskCacheLayoutVersion) &&
+        (pHeader->contentVersion     == ContentVersion()))
+    {
+        result = IndexRecords(pNeedsCompaction);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Adds the records between m_indexedSize and the end of the used storage to the index.  Scanning stops at the first
+// record which is torn or corrupt, in which case the file needs to be compacted before anything new is appended after
+// it.
+Result PipelineDiskCache::IndexRecords(
+    bool* pNeedsCompaction)
+{
+    const size_t usedSize = m_file.GetUsedStorageSize();
+
+    Result result = (usedSize <= m_viewSize) ? Result::Success : Result::ErrorUnknown;
+
+    while ((result == Result::Success) && (m_indexedSize < usedSize))
+    {
+        const RecordHeader*const pRecord  = RecordAt(m_indexedSize);
+        const size_t             sizeLeft = usedSize - m_indexedSize;
+
+        if ((sizeLeft < sizeof(RecordHeader))               ||
+            (RecordSize(pRecord->payloadSize) > sizeLeft) ||
+            (pRecord->checksum != ChecksumPayload(*pRecord)))
+        {
+            *pNeedsCompaction = true;
+            break;
+        }
+
+        // A later record for the same key (e.g., appended by another process) replaces the earlier one.
+        bool   existed = false;
+        Entry* pEntry  = nullptr;
+        result = m_entryMap.FindAllocate(pRecord->hash[0], &existed, &pEntry);
+
+        if (result == Result::Success)
+        {
+            pEntry->hashHigh = pRecord->hash[1];
+            pEntry->offset   = m_indexedSize;
+        }
+
+        m_indexedSize += RecordSize(pRecord->payloadSize);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Rewrites the cache file with only the most recently used records which fit in three quarters of the size cap, leaving
+// headroom so that the next few appends don't immediately compact again.  Unindexed data after a torn record is dropped
+// as well.  The new file is written under a temporary name and then renamed over the old one, so a crash part way
+// through leaves the old file intact.
+Result PipelineDiskCache::Compact()
+{
+    const uint64 targetSize = (m_maxSize != 0) ? ((m_maxSize / 4) * 3) : UINT64_MAX;
+
+    // Find the oldest use count for which keeping every record used since then still fits the target size.
+    uint64 low  = 0;
+    uint64 high = Header()->useClock + 1;
+
+    while (low < high)
+    {
+        const uint64 mid = low + ((high - low) / 2);
+
+        if ((sizeof(DiskHeader) + BytesUsedSince(mid)) <= targetSize)
+        {
+            high = mid;
+        }
+        else
+        {
+            low = mid + 1;
+        }
+    }
+
+    const uint64 oldestUse = low;
+    const size_t newSize   = sizeof(DiskHeader) + static_cast<size_t>(BytesUsedSince(oldestUse));
+
+    char tempPath[MaxPathStrLen];
+    Snprintf(&tempPath[0], sizeof(tempPath), "%s.tmp", &m_filePath[0]);
+    remove(&tempPath[0]);
+
+    MemMapFile newFile;
+    FileView   newView;
+
+    Result result = newFile.OpenStorageFile(StorageAccessModeFlags::Writeable,
+                                            Pow2Align(sizeof(MemMapFileHeader) + newSize, InitialFileSize),
+                                            &tempPath[0],
+                                            nullptr);
+
+    if (result == Result::Success)
+    {
+        result = newFile.GetNewStorageSpace(newSize, true, &newView);
+    }
+
+    if (result == Result::Success)
+    {
+        void* pDst = newView.Ptr();
+
+        memcpy(pDst, Header(), sizeof(DiskHeader));
+        pDst = VoidPtrInc(pDst, sizeof(DiskHeader));
+
+        for (auto iter = m_entryMap.Begin(); iter.Get() != nullptr; iter.Next())
+        {
+            const RecordHeader*const pRecord = RecordAt(iter.Get()->value.offset);
+
+            if (pRecord->lastUse >= oldestUse)
+            {
+                const size_t recordSize = RecordSize(pRecord->payloadSize);
+
+                memcpy(pDst, pRecord, recordSize);
+                pDst = VoidPtrInc(pDst, recordSize);
+            }
+        }
+
+        PAL_ASSERT(VoidPtrDiff(pDst, newView.Ptr()) == newSize);
+
+        newView.UnMap(false);
+        newFile.Flush();
+        newFile.CloseStorageFile();
+
+        // Every record worth keeping was just flushed to the new file, so don't bother flushing the old one.
+        m_numUnflushed = 0;
+        CloseFile();
+
+        if (rename(&tempPath[0], &m_filePath[0]) != 0)
+        {
+            result = Result::ErrorUnknown;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        bool needsCompaction = false;
+
+        result = OpenFile(false);
+
+        if (result == Result::Success)
+        {
+            result = BuildIndex(&needsCompaction);
+        }
+    }
+    else
+    {
+        remove(&tempPath[0]);
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Returns the total size of the records which were last used at or after the specified use count.
+uint64 PipelineDiskCache::BytesUsedSince(
+    uint64 useCount
+    ) const
+{
+    uint64 totalSize = 0;
+
+    for (auto iter = m_entryMap.Begin(); iter.Get() != nullptr; iter.Next())
+    {
+        const RecordHeader*const pRecord = RecordAt(iter.Get()->value.offset);
+
+        if (pRecord->lastUse >= useCount)
+        {
+            totalSize += RecordSize(pRecord->payloadSize);
+        }
+    }
+
+    return totalSize;
+}
+
+// =====================================================================================================================
+// Computes the checksum of a record's payload.  The key and payload size seed the hash so that a torn record header is
+// detected as well.
+uint64 PipelineDiskCache::ChecksumPayload(
+    const RecordHeader& record)
+{
+    uint64 checksum = 0;
+    MetroHash64::Hash(reinterpret_cast<const uint8*>(&record + 1),
+                      record.payloadSize,
+                      reinterpret_cast<uint8*>(&checksum),
+                      (record.hash[0] ^ record.hash[1] ^ record.payloadSize));
+
+    return checksum;
+}
+
+// =====================================================================================================================
+// Returns the size of a record holding a payload of the specified size, including padding.
+size_t PipelineDiskCache::RecordSize(
+    size_t payloadSize)
+{
+    return Pow2Align(sizeof(RecordHeader) + payloadSize, sizeof(uint64));
+}
+
+} // Pal
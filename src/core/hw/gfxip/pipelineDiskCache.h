@@ -0,0 +1,148 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2014-2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "palDevice.h"
+#include "palFileMap.h"
+#include "palHashMap.h"
+#include "palMemMapFile.h"
+#include "palMetroHash.h"
+#include "palMutex.h"
+
+namespace Pal
+{
+
+class Device;
+class Platform;
+
+// =====================================================================================================================
+// Persistent store of per-pipeline blobs keyed by a 128-bit hash of the pipeline ELF binary, backed by a memory-mapped
+// file (Util::MemMapFile).  Unlike the PipelineCodeCache and PipelineObjectCache it survives across processes, which
+// lets a pipeline whose binary was seen in a previous run skip the work captured by its blob.
+//
+// The file holds a DiskHeader followed by append-only records (a RecordHeader and its payload).  A record is written
+// before the storage end is advanced past it, and the file is flushed once every few records rather than on every
+// append.  Each payload is checksummed, so a record torn by a crash is dropped the next time the file is opened.
+// Every hit stamps the record with a monotonically increasing use count; once the file grows past the client's size cap
+// it is rewritten with only the most recently used records.
+//
+// Processes sharing the file serialize their accesses with an advisory lock on a companion ".lock" file, which unlike
+// the cache file is never renamed.  Whoever takes the lock first catches up with what other processes did since it last
+// held it: records they appended are indexed, and a file they compacted (i.e., renamed over the one this process has
+// mapped) is reopened.
+//
+// The cache is active when the client selects ShaderCacheOnDisk and provides PalPublicSettings::
+// pipelineDiskCacheDirectory.  The file is opened on first use so that the committed public settings are honored.  All
+// methods are thread-safe.
+class PipelineDiskCache
+{
+public:
+    explicit PipelineDiskCache(Device* pDevice);
+    ~PipelineDiskCache();
+
+    Result Init();
+
+    bool IsEnabled() const;
+
+    bool Find(const Util::MetroHash::Hash& hash, void* pData, size_t dataSize);
+    void Insert(const Util::MetroHash::Hash& hash, const void* pData, size_t dataSize);
+
+    uint32 NumHits() const { return m_numHits; }
+    uint32 NumMisses() const { return m_numMisses; }
+
+private:
+    // Lives at the start of the file's storage.  A file whose magic or versions don't match is discarded.
+    struct DiskHeader
+    {
+        uint32  magic;
+        uint32  layoutVersion;   // Version of this file layout.
+        uint32  contentVersion;  // Version of the payloads stored by the pipelines.
+        uint32  reserved;
+        uint64  useClock;        // Last use count handed out to a record.
+    };
+
+    // Precedes each record's payload.  Records are padded to a multiple of 8 bytes.
+    struct RecordHeader
+    {
+        uint64  hash[2];      // Full 128-bit key.
+        uint64  checksum;     // MetroHash64 of the payload.
+        uint64  lastUse;      // Use count of the most recent hit; not covered by the checksum.
+        uint32  payloadSize;
+        uint32  reserved;
+    };
+
+    struct Entry
+    {
+        uint64  hashHigh;     // High half of the 128-bit hash; guards against key collisions.
+        size_t  offset;       // Storage offset of the record's header.
+    };
+
+    typedef Util::HashMap<uint64, Entry, Platform> EntryMap;
+
+    static constexpr uint32 NumBuckets = 256;
+
+    bool   BeginFileAccess();
+    void   EndFileAccess() { m_lockFile.Unlock(); }
+    Result SyncWithFile();
+    Result OpenFile(bool discardContents);
+    void   CloseFile();
+    Result MapStorage();
+    Result BuildIndex(bool* pNeedsCompaction);
+    Result IndexRecords(bool* pNeedsCompaction);
+    Result Compact();
+    uint64 BytesUsedSince(uint64 useCount) const;
+
+    DiskHeader*   Header() const { return static_cast<DiskHeader*>(m_view.Ptr()); }
+    RecordHeader* RecordAt(size_t offset) const
+        { return static_cast<RecordHeader*>(Util::VoidPtrInc(m_view.Ptr(), offset)); }
+
+    static uint64 ChecksumPayload(const RecordHeader& record);
+    static size_t RecordSize(size_t payloadSize);
+
+    Device*const      m_pDevice;
+    EntryMap          m_entryMap;
+    Util::Mutex       m_lock;
+    Util::MemMapFile  m_file;
+    Util::FileView    m_view;           // Maps the file's entire storage.
+    Util::FileMapping m_lockFile;       // Holds the advisory lock which serializes access to m_file between processes.
+    size_t            m_viewSize;
+    size_t            m_indexedSize;    // Storage offset up to which records have been added to m_entryMap.
+    size_t            m_maxSize;        // Size cap; exceeding it evicts the least recently used records.
+    uint32            m_numUnflushed;   // Records appended since m_file was last flushed.
+    char              m_filePath[MaxPathStrLen];
+    char              m_lockPath[MaxPathStrLen];
+    bool              m_initialized;
+    bool              m_openAttempted;
+    bool              m_isOpen;
+
+    volatile uint32  m_numHits;
+    volatile uint32  m_numMisses;
+
+    PAL_DISALLOW_DEFAULT_CTOR(PipelineDiskCache);
+    PAL_DISALLOW_COPY_AND_ASSIGN(PipelineDiskCache);
+};
+
+} // Pal
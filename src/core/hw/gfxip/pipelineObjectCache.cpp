@@ -0,0 +1,162 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2014-2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "core/device.h"
+#include "core/platform.h"
+#include "core/hw/gfxip/pipeline.h"
+#include "core/hw/gfxip/pipelineObjectCache.h"
+#include "palHashMapImpl.h"
+
+using namespace Util;
+
+namespace Pal
+{
+
+// =====================================================================================================================
+PipelineObjectCache::PipelineObjectCache(
+    Device* pDevice)
+    :
+    m_pDevice(pDevice),
+    m_entryMap(NumBuckets, pDevice->GetPlatform()),
+    m_initialized(false),
+    m_numHits(0),
+    m_numMisses(0)
+{
+}
+
+// =====================================================================================================================
+PipelineObjectCache::~PipelineObjectCache()
+{
+    // Every client pipeline must have released its prototype before the device is destroyed.
+    PAL_ASSERT((m_initialized == false) || (m_entryMap.GetNumEntries() == 0));
+}
+
+// =====================================================================================================================
+Result PipelineObjectCache::Init()
+{
+    Result result = m_lock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_entryMap.Init();
+    }
+
+    m_initialized = (result == Result::Success);
+
+    return result;
+}
+
+// =====================================================================================================================
+// Returns true if client pipelines should consult this cache.
+bool PipelineObjectCache::IsEnabled() const
+{
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+    return m_initialized && m_pDevice->GetPublicSettings()->enablePipelineObjectCache;
+#else
+    return false;
+#endif
+}
+
+// =====================================================================================================================
+// Looks up the prototype stored for the given hash.  On a hit, a reference is added on behalf of the caller, which must
+// later call Release().  Returns nullptr on a miss.
+const Pipeline* PipelineObjectCache::Acquire(
+    const MetroHash::Hash& hash)
+{
+    const Pipeline* pPrototype = nullptr;
+
+    MutexAuto lock(&m_lock);
+
+    Entry*const pEntry = m_entryMap.FindKey(KeyFromHash(hash));
+    if ((pEntry != nullptr) && (pEntry->hashHigh == hash.qwords[1]))
+    {
+        pEntry->refCount++;
+        pPrototype = pEntry->pPrototype;
+        m_numHits++;
+    }
+    else
+    {
+        m_numMisses++;
+    }
+
+    return pPrototype;
+}
+
+// =====================================================================================================================
+// Publishes a freshly created prototype under the given hash.  On success, the cache takes ownership of the prototype
+// and the caller holds the first reference.  Returns false if another prototype is already stored under the same key
+// (e.g., another thread missed on the same pipeline concurrently), in which case the caller keeps ownership.
+bool PipelineObjectCache::Insert(
+    const MetroHash::Hash& hash,
+    Pipeline*              pPrototype)
+{
+    PAL_ASSERT(pPrototype != nullptr);
+
+    bool inserted = false;
+
+    MutexAuto lock(&m_lock);
+
+    bool   existed = false;
+    Entry* pEntry  = nullptr;
+    if ((m_entryMap.FindAllocate(KeyFromHash(hash), &existed, &pEntry) == Result::Success) && (existed == false))
+    {
+        pEntry->pPrototype = pPrototype;
+        pEntry->hashHigh   = hash.qwords[1];
+        pEntry->refCount   = 1;
+        inserted           = true;
+    }
+
+    return inserted;
+}
+
+// =====================================================================================================================
+// Drops one reference on the prototype stored under the given key, destroying it once no client pipeline shares its
+// state.
+void PipelineObjectCache::Release(
+    uint64 key)
+{
+    Pipeline* pPrototype = nullptr;
+
+    {
+        MutexAuto lock(&m_lock);
+
+        Entry*const pEntry = m_entryMap.FindKey(key);
+        PAL_ASSERT((pEntry != nullptr) && (pEntry->refCount > 0));
+
+        if ((pEntry != nullptr) && (--pEntry->refCount == 0))
+        {
+            pPrototype = pEntry->pPrototype;
+            m_entryMap.Erase(key);
+        }
+    }
+
+    // Destroy the prototype outside of the lock since doing so frees GPU memory.
+    if (pPrototype != nullptr)
+    {
+        pPrototype->DestroyInternal();
+    }
+}
+
+} // Pal
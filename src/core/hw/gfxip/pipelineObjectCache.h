@@ -0,0 +1,91 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2014-2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "palHashMap.h"
+#include "palMetroHash.h"
+#include "palMutex.h"
+
+namespace Pal
+{
+
+class Device;
+class Pipeline;
+class Platform;
+
+// =====================================================================================================================
+// Device-wide, reference-counted store of fully initialized prototype pipelines keyed by a hash of the pipeline ELF
+// binary and the create info.  Client pipelines with a matching key copy the prototype's hardware-specific state and
+// share its GPU memory rather than parsing the ELF and rebuilding their register images.  A prototype is destroyed
+// when the last pipeline sharing its state is destroyed.
+//
+// The cache is only active when the client sets PalPublicSettings::enablePipelineObjectCache.  All methods are
+// thread-safe.
+class PipelineObjectCache
+{
+public:
+    explicit PipelineObjectCache(Device* pDevice);
+    ~PipelineObjectCache();
+
+    Result Init();
+
+    bool IsEnabled() const;
+
+    const Pipeline* Acquire(const Util::MetroHash::Hash& hash);
+    bool Insert(const Util::MetroHash::Hash& hash, Pipeline* pPrototype);
+    void Release(uint64 key);
+
+    uint32 NumHits() const { return m_numHits; }
+    uint32 NumMisses() const { return m_numMisses; }
+
+    // Returns the key under which a prototype with the specified hash is stored.
+    static uint64 KeyFromHash(const Util::MetroHash::Hash& hash) { return hash.qwords[0]; }
+
+private:
+    struct Entry
+    {
+        Pipeline*  pPrototype;  // Internal pipeline which owns the shared state and GPU memory.
+        uint64     hashHigh;    // High half of the 128-bit hash; guards against key collisions.
+        uint32     refCount;    // Number of client pipelines sharing the prototype's state.
+    };
+
+    typedef Util::HashMap<uint64, Entry, Platform> EntryMap;
+
+    static constexpr uint32 NumBuckets = 256;
+
+    Device*const  m_pDevice;
+    EntryMap      m_entryMap;
+    Util::Mutex   m_lock;
+    bool          m_initialized;
+
+    volatile uint32  m_numHits;
+    volatile uint32  m_numMisses;
+
+    PAL_DISALLOW_DEFAULT_CTOR(PipelineObjectCache);
+    PAL_DISALLOW_COPY_AND_ASSIGN(PipelineObjectCache);
+};
+
+} // Pal
@@ -26,6 +26,11 @@
 #include "core/device.h"
 #include "core/hw/gfxip/gfxCmdBuffer.h"
 #include "core/hw/gfxip/queryPool.h"
+#include "palSysUtil.h"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
 
 using namespace Util;
 
@@ -276,4 +281,114 @@ gpusize QueryPool::GetTimestampOffset(
     return m_gpuMemory.Offset() + m_timestampStartOffset + slot * m_timestampSizePerSlotInBytes;
 }
 
+// =====================================================================================================================
+// Called after a poll of a query slot found it incomplete.
+void QueryPollBackoff::Wait()
+{
+    // Number of polls which just pause the CPU before we start yielding, and the number of yields before we start
+    // sleeping. The sleep length doubles each time up to MaxSleepUs so that we still notice completion reasonably soon.
+    constexpr uint32 SpinPolls  = 64;
+    constexpr uint32 YieldPolls = 64;
+    constexpr uint32 MaxSleepUs = 1000;
+
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+    const bool backoff = TestAnyFlagSet(m_flags, QueryResultWaitBackoff);
+#else
+    const bool backoff = false;
+#endif
+
+    if (backoff == false)
+    {
+        CpuPause();
+    }
+    else if (m_pollCount < SpinPolls)
+    {
+        CpuPause();
+    }
+    else if (m_pollCount < (SpinPolls + YieldPolls))
+    {
+        YieldThread();
+    }
+    else
+    {
+        m_sleepUs = Min(Max(m_sleepUs * 2, 1u), MaxSleepUs);
+        SleepMicroseconds(m_sleepUs);
+    }
+
+    m_pollCount++;
+}
+
+// =====================================================================================================================
+// Sums the zPass deltas of all RB counter pairs of one occlusion query slot. Returns true if all of them were valid.
+bool ReduceOcclusionQueryCounters(
+    volatile const void* pRbCounters,
+    uint32               numRbs,
+    uint64*              pResult)
+{
+    constexpr uint64 ValidMask = (1ull << 63);
+    constexpr uint64 DataMask  = ~ValidMask;
+
+    volatile const uint64* pCounters = static_cast<volatile const uint64*>(pRbCounters);
+
+    uint64 result   = 0;
+    bool   allValid = true;
+    uint32 rbIdx    = 0;
+
+#if defined(__SSE2__)
+    // Each RB writes a { begin, end } pair. Handle two RBs per iteration: gather their counters into a begin vector and
+    // an end vector, then mask off the deltas of any RB whose begin and end values aren't both valid. The counters are
+    // volatile, so they're gathered with scalar loads rather than a 128-bit load.
+    const __m128i validMask = _mm_set1_epi64x(static_cast<int64>(ValidMask));
+    const __m128i dataMask  = _mm_set1_epi64x(static_cast<int64>(DataMask));
+
+    __m128i sum   = _mm_setzero_si128();
+    __m128i valid = validMask;
+
+    for (; (rbIdx + 2) <= numRbs; rbIdx += 2)
+    {
+        const uint64  begin0 = pCounters[rbIdx * 2];
+        const uint64  end0   = pCounters[(rbIdx * 2) + 1];
+        const uint64  begin1 = pCounters[(rbIdx * 2) + 2];
+        const uint64  end1   = pCounters[(rbIdx * 2) + 3];
+        const __m128i begins = _mm_set_epi64x(static_cast<int64>(begin1), static_cast<int64>(begin0));
+        const __m128i ends   = _mm_set_epi64x(static_cast<int64>(end1), static_cast<int64>(end0));
+
+        // Broadcast each lane's valid bit (bit 63) to the whole lane. SSE2 has no 64-bit arithmetic shift, so shift
+        // the high dwords and copy them down into the low dwords.
+        const __m128i rbValid  = _mm_and_si128(_mm_and_si128(begins, ends), validMask);
+        const __m128i laneMask = _mm_shuffle_epi32(_mm_srai_epi32(rbValid, 31), _MM_SHUFFLE(3, 3, 1, 1));
+        const __m128i delta    = _mm_sub_epi64(_mm_and_si128(ends, dataMask), _mm_and_si128(begins, dataMask));
+
+        sum   = _mm_add_epi64(sum, _mm_and_si128(delta, laneMask));
+        valid = _mm_and_si128(valid, rbValid);
+    }
+
+    uint64 lanes[2] = {};
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), sum);
+    result = lanes[0] + lanes[1];
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(lanes), valid);
+    allValid = ((lanes[0] & lanes[1] & ValidMask) != 0);
+#endif
+
+    for (; rbIdx < numRbs; ++rbIdx)
+    {
+        const uint64 begin = pCounters[rbIdx * 2];
+        const uint64 end   = pCounters[(rbIdx * 2) + 1];
+
+        if ((begin & end & ValidMask) != 0)
+        {
+            result += (end & DataMask) - (begin & DataMask);
+        }
+        else
+        {
+            allValid = false;
+        }
+    }
+
+    *pResult = result;
+
+    return allValid;
+}
+
 } // Pal
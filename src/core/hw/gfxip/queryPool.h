@@ -36,6 +36,37 @@ class CmdStream;
 class Device;
 class GfxCmdBuffer;
 
+// =====================================================================================================================
+// Helper for CPU-side query result waits which is called each time a poll finds that the GPU hasn't finished writing a
+// query slot. By default this only issues a CPU pause hint, so the caller effectively busy-waits. If the client set
+// QueryResultWaitBackoff, the thread is backed off in bounded steps instead: a short pause spin, then thread yields,
+// and finally sleeps which double in length up to a fixed cap.
+class QueryPollBackoff
+{
+public:
+    explicit QueryPollBackoff(QueryResultFlags flags) : m_flags(flags), m_pollCount(0), m_sleepUs(0) { }
+    ~QueryPollBackoff() { }
+
+    void Wait();
+
+private:
+    const QueryResultFlags m_flags;
+    uint32                 m_pollCount; // Number of times Wait() has been called.
+    uint32                 m_sleepUs;   // Length of the next sleep, in microseconds.
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(QueryPollBackoff);
+    PAL_DISALLOW_DEFAULT_CTOR(QueryPollBackoff);
+};
+
+// Sums the (end - begin) zPass deltas of an occlusion query slot's per-RB counter pairs. Each pair is two 64-bit values
+// whose most-significant bit is set by the RB once the value is valid. Returns true if every pair was valid; otherwise
+// pResult only includes the deltas of the valid pairs. The counters are read through a volatile pointer because the GPU
+// may write them at any time, so each call observes their current values.
+extern bool ReduceOcclusionQueryCounters(
+    volatile const void* pRbCounters,
+    uint32               numRbs,
+    uint64*              pResult);
+
 // =====================================================================================================================
 // Represents a set of queries that can be used to retrieve detailed info about the GPU's execution of a particular
 // range of a command buffer.
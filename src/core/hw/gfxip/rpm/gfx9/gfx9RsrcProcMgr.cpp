@@ -402,33 +402,26 @@ void RsrcProcMgr::CmdCopyMemory(
     {
         bool p2pBltInfoRequired = m_pDevice->Parent()->IsP2pBltWaRequired(dstGpuMemory);
 
-        uint32 newRegionCount = 0;
-        if (p2pBltInfoRequired)
-        {
-            m_pDevice->P2pBltWaModifyRegionListMemory(dstGpuMemory,
-                                                      regionCount,
-                                                      pRegions,
-                                                      &newRegionCount,
-                                                      nullptr,
-                                                      nullptr);
-        }
+        // The P2P BLT workaround splits the regions into small chunks. The new region list is built in the command
+        // buffer's linear allocator and is released when this function returns.
+        LinearAllocatorAuto<VirtualLinearAllocator> p2pAllocator(pCmdBuffer->Allocator(), false);
+        P2pBltWaRegionList<MemoryCopyRegion>        p2pRegions(pCmdBuffer->Allocator());
+        const gpusize*                              pChunkAddrs = nullptr;
 
-        AutoBuffer<MemoryCopyRegion, 32, Platform> newRegions(newRegionCount, m_pDevice->GetPlatform());
-        AutoBuffer<gpusize, 32, Platform> chunkAddrs(newRegionCount, m_pDevice->GetPlatform());
         if (p2pBltInfoRequired)
         {
-            if ((newRegions.Capacity() >= newRegionCount) && (chunkAddrs.Capacity() >= newRegionCount))
+            const Result result = m_pDevice->P2pBltWaModifyRegionListMemory(dstGpuMemory,
+                                                                            regionCount,
+                                                                            pRegions,
+                                                                            &p2pRegions);
+
+            if (result == Result::Success)
             {
-                m_pDevice->P2pBltWaModifyRegionListMemory(dstGpuMemory,
-                                                          regionCount,
-                                                          pRegions,
-                                                          &newRegionCount,
-                                                          &newRegions[0],
-                                                          &chunkAddrs[0]);
-                regionCount = newRegionCount;
-                pRegions    = &newRegions[0];
-
-                pCmdBuffer->P2pBltWaCopyBegin(&dstGpuMemory, regionCount, &chunkAddrs[0]);
+                regionCount = p2pRegions.NumRegions();
+                pRegions    = p2pRegions.regions.Data();
+                pChunkAddrs = p2pRegions.chunkAddrs.Data();
+
+                pCmdBuffer->P2pBltWaCopyBegin(&dstGpuMemory, regionCount, pChunkAddrs);
             }
             else
             {
@@ -441,7 +434,7 @@ void RsrcProcMgr::CmdCopyMemory(
         {
             if (p2pBltInfoRequired)
             {
-                pCmdBuffer->P2pBltWaCopyNextRegion(chunkAddrs[i]);
+                pCmdBuffer->P2pBltWaCopyNextRegion(pChunkAddrs[i]);
             }
 
             const gpusize dstAddr = dstGpuMemory.Desc().gpuVirtAddr + pRegions[i].dstOffset;
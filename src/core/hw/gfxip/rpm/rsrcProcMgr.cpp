@@ -243,33 +243,26 @@ void RsrcProcMgr::CopyMemoryCs(
 
     bool p2pBltInfoRequired = m_pDevice->Parent()->IsP2pBltWaRequired(dstGpuMemory);
 
-    uint32 newRegionCount = 0;
-    if (p2pBltInfoRequired)
-    {
-        m_pDevice->P2pBltWaModifyRegionListMemory(dstGpuMemory,
-                                                  regionCount,
-                                                  pRegions,
-                                                  &newRegionCount,
-                                                  nullptr,
-                                                  nullptr);
-    }
+    // The P2P BLT workaround splits the regions into small chunks. The new region list is built in the command
+    // buffer's linear allocator and is released when this function returns.
+    LinearAllocatorAuto<VirtualLinearAllocator> p2pAllocator(pCmdBuffer->Allocator(), false);
+    P2pBltWaRegionList<MemoryCopyRegion>        p2pRegions(pCmdBuffer->Allocator());
+    const gpusize*                              pChunkAddrs = nullptr;
 
-    AutoBuffer<MemoryCopyRegion, 32, Platform> newRegions(newRegionCount, m_pDevice->GetPlatform());
-    AutoBuffer<gpusize, 32, Platform> chunkAddrs(newRegionCount, m_pDevice->GetPlatform());
     if (p2pBltInfoRequired)
     {
-        if ((newRegions.Capacity() >= newRegionCount) && (chunkAddrs.Capacity() >= newRegionCount))
+        const Result result = m_pDevice->P2pBltWaModifyRegionListMemory(dstGpuMemory,
+                                                                        regionCount,
+                                                                        pRegions,
+                                                                        &p2pRegions);
+
+        if (result == Result::Success)
         {
-            m_pDevice->P2pBltWaModifyRegionListMemory(dstGpuMemory,
-                                                      regionCount,
-                                                      pRegions,
-                                                      &newRegionCount,
-                                                      &newRegions[0],
-                                                      &chunkAddrs[0]);
-            regionCount = newRegionCount;
-            pRegions    = &newRegions[0];
+            regionCount = p2pRegions.NumRegions();
+            pRegions    = p2pRegions.regions.Data();
+            pChunkAddrs = p2pRegions.chunkAddrs.Data();
 
-            pCmdBuffer->P2pBltWaCopyBegin(&dstGpuMemory, regionCount, &chunkAddrs[0]);
+            pCmdBuffer->P2pBltWaCopyBegin(&dstGpuMemory, regionCount, pChunkAddrs);
         }
         else
         {
@@ -278,6 +271,24 @@ void RsrcProcMgr::CopyMemoryCs(
         }
     }
 
+    // Every region is split into slices of at most CopySizeLimit bytes and each slice needs its own pair of SRDs.
+    // Rather than allocating and binding a separate embedded table per slice, we build the tables for as many slices as
+    // will fit into one embedded data allocation and just repoint user-data entry 0 at the right one before each
+    // dispatch.
+    const uint32 srdTableDwords = SrdDwordAlignment() * NumGpuMemory;
+    const uint32 maxBatchSlices = Max(pCmdBuffer->GetEmbeddedDataLimit() / srdTableDwords, 1u);
+
+    uint32 remainingSlices = 0;
+    for (uint32 idx = 0; idx < regionCount; ++idx)
+    {
+        remainingSlices += static_cast<uint32>(RoundUpQuotient(pRegions[idx].copySize, CopySizeLimit));
+    }
+
+    uint32*                pSrdTable      = nullptr;
+    gpusize                tableGpuAddr   = 0;
+    uint32                 batchSlices    = 0;
+    const ComputePipeline* pBoundPipeline = nullptr;
+
     // Save current command buffer state.
     pCmdBuffer->CmdSaveComputeState(ComputeStatePipelineAndUserData);
 
@@ -286,7 +297,7 @@ void RsrcProcMgr::CopyMemoryCs(
     {
         if (p2pBltInfoRequired)
         {
-            pCmdBuffer->P2pBltWaCopyNextRegion(chunkAddrs[idx]);
+            pCmdBuffer->P2pBltWaCopyNextRegion(pChunkAddrs[idx]);
         }
 
         const gpusize srcOffset  = pRegions[idx].srcOffset;
@@ -297,13 +308,15 @@ void RsrcProcMgr::CopyMemoryCs(
         {
             const uint32 copySectionSize = static_cast<uint32>(Min(CopySizeLimit, copySize - copyOffset));
 
-            // Create an embedded user-data table and bind it to user data. We need buffer views for the source and
-            // destination.
-            uint32* pSrdTable = RpmUtil::CreateAndBindEmbeddedUserData(pCmdBuffer,
-                                                                       SrdDwordAlignment() * NumGpuMemory,
-                                                                       SrdDwordAlignment(),
-                                                                       PipelineBindPoint::Compute,
-                                                                       0);
+            if (batchSlices == 0)
+            {
+                // The current embedded table is used up, allocate space for the SRDs of the next batch of slices.
+                batchSlices = Min(remainingSlices, maxBatchSlices);
+                pSrdTable   = pCmdBuffer->CmdAllocateEmbeddedData(batchSlices * srdTableDwords,
+                                                                  SrdDwordAlignment(),
+                                                                  &tableGpuAddr);
+                PAL_ASSERT(pSrdTable != nullptr);
+            }
 
             // Populate the table with raw buffer views, by convention the destination is placed before the source.
             BufferViewInfo rawBufferView = {};
@@ -312,16 +325,21 @@ void RsrcProcMgr::CopyMemoryCs(
                                             dstOffset + copyOffset,
                                             copySectionSize);
             m_pDevice->Parent()->CreateUntypedBufferViewSrds(1, &rawBufferView, pSrdTable);
-            pSrdTable += SrdDwordAlignment();
 
             RpmUtil::BuildRawBufferViewInfo(&rawBufferView,
                                             srcGpuMemory,
                                             srcOffset + copyOffset,
                                             copySectionSize);
-            m_pDevice->Parent()->CreateUntypedBufferViewSrds(1, &rawBufferView, pSrdTable);
+            m_pDevice->Parent()->CreateUntypedBufferViewSrds(1, &rawBufferView, pSrdTable + SrdDwordAlignment());
+
+            // Bind this slice's table and copy size with a single user-data update.
+            const uint32 regionUserData[4] = { LowPart(tableGpuAddr), 0, 0, copySectionSize };
+            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 0, 4, regionUserData);
 
-            const uint32 regionUserData[3] = { 0, 0, copySectionSize };
-            pCmdBuffer->CmdSetUserData(PipelineBindPoint::Compute, 1, 3, regionUserData);
+            pSrdTable    += srdTableDwords;
+            tableGpuAddr += srdTableDwords * sizeof(uint32);
+            batchSlices--;
+            remainingSlices--;
 
             // Get the pipeline object and number of thread groups.
             const ComputePipeline* pPipeline = nullptr;
@@ -343,8 +361,13 @@ void RsrcProcMgr::CopyMemoryCs(
                 numThreadGroups = RpmUtil::MinThreadGroups(copySectionSize, pPipeline->ThreadsPerGroup());
             }
 
-            // Bind pipeline and dispatch.
-            pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+            // Bind the pipeline if it changed since the last slice and dispatch.
+            if (pPipeline != pBoundPipeline)
+            {
+                pCmdBuffer->CmdBindPipeline({ PipelineBindPoint::Compute, pPipeline, });
+                pBoundPipeline = pPipeline;
+            }
+
             pCmdBuffer->CmdDispatch(numThreadGroups, 1, 1);
         }
     }
@@ -1051,37 +1074,27 @@ void RsrcProcMgr::CopyImageCompute(
 
     bool p2pBltInfoRequired = m_pDevice->Parent()->IsP2pBltWaRequired(*dstImage.GetBoundGpuMemory().Memory());
 
-    uint32 newRegionCount = 0;
-    if (p2pBltInfoRequired)
-    {
-        m_pDevice->P2pBltWaModifyRegionListImage(srcImage,
-                                                 dstImage,
-                                                 regionCount,
-                                                 pRegions,
-                                                 &newRegionCount,
-                                                 nullptr,
-                                                 nullptr);
-    }
-
-    AutoBuffer<ImageCopyRegion, 32, Platform> newRegions(newRegionCount, m_pDevice->GetPlatform());
-    AutoBuffer<gpusize, 32, Platform> chunkAddrs(newRegionCount, m_pDevice->GetPlatform());
+    // The P2P BLT workaround splits the regions into small chunks. The new region list is built in the command
+    // buffer's linear allocator and is released when this function returns.
+    LinearAllocatorAuto<VirtualLinearAllocator> p2pAllocator(pCmdBuffer->Allocator(), false);
+    P2pBltWaRegionList<ImageCopyRegion>         p2pRegions(pCmdBuffer->Allocator());
+    const gpusize*                              pChunkAddrs = nullptr;
 
     if (p2pBltInfoRequired)
     {
-        if ((newRegions.Capacity() >= newRegionCount) && (chunkAddrs.Capacity() >= newRegionCount))
-        {
-            m_pDevice->P2pBltWaModifyRegionListImage(srcImage,
-                                                     dstImage,
-                                                     regionCount,
-                                                     pRegions,
-                                                     &newRegionCount,
-                                                     &newRegions[0],
-                                                     &chunkAddrs[0]);
+        const Result result = m_pDevice->P2pBltWaModifyRegionListImage(srcImage,
+                                                                       dstImage,
+                                                                       regionCount,
+                                                                       pRegions,
+                                                                       &p2pRegions);
 
-            regionCount = newRegionCount;
-            pRegions    = &newRegions[0];
+        if (result == Result::Success)
+        {
+            regionCount = p2pRegions.NumRegions();
+            pRegions    = p2pRegions.regions.Data();
+            pChunkAddrs = p2pRegions.chunkAddrs.Data();
 
-            pCmdBuffer->P2pBltWaCopyBegin(dstImage.GetBoundGpuMemory().Memory(), regionCount, &chunkAddrs[0]);
+            pCmdBuffer->P2pBltWaCopyBegin(dstImage.GetBoundGpuMemory().Memory(), regionCount, pChunkAddrs);
         }
         else
         {
@@ -1117,7 +1130,7 @@ void RsrcProcMgr::CopyImageCompute(
 
         if (p2pBltInfoRequired)
         {
-            pCmdBuffer->P2pBltWaCopyNextRegion(chunkAddrs[idx]);
+            pCmdBuffer->P2pBltWaCopyNextRegion(pChunkAddrs[idx]);
         }
 
         // Setup image formats per-region. This is different than the graphics path because the compute path must be
@@ -1567,64 +1580,42 @@ void RsrcProcMgr::CopyBetweenMemoryAndImage(
 
     bool p2pBltInfoRequired =
         m_pDevice->Parent()->IsP2pBltWaRequired(isImageDst ? *image.GetBoundGpuMemory().Memory() : gpuMemory);
-    uint32 newRegionCount = 0;
+
+    // The P2P BLT workaround splits the regions into small chunks. The new region list is built in the command
+    // buffer's linear allocator and is released when this function returns.
+    LinearAllocatorAuto<VirtualLinearAllocator> p2pAllocator(pCmdBuffer->Allocator(), false);
+    P2pBltWaRegionList<MemoryImageCopyRegion>   p2pRegions(pCmdBuffer->Allocator());
+    const gpusize*                              pChunkAddrs = nullptr;
+
     if (p2pBltInfoRequired)
     {
+        Result result = Result::Success;
+
         if (isImageDst)
         {
-            m_pDevice->P2pBltWaModifyRegionListMemoryToImage(gpuMemory,
-                                                             image,
-                                                             regionCount,
-                                                             pRegions,
-                                                             &newRegionCount,
-                                                             nullptr,
-                                                             nullptr);
+            result = m_pDevice->P2pBltWaModifyRegionListMemoryToImage(gpuMemory,
+                                                                      image,
+                                                                      regionCount,
+                                                                      pRegions,
+                                                                      &p2pRegions);
         }
         else
         {
-            m_pDevice->P2pBltWaModifyRegionListImageToMemory(image,
-                                                             gpuMemory,
-                                                             regionCount,
-                                                             pRegions,
-                                                             &newRegionCount,
-                                                             nullptr,
-                                                             nullptr);
+            result = m_pDevice->P2pBltWaModifyRegionListImageToMemory(image,
+                                                                      gpuMemory,
+                                                                      regionCount,
+                                                                      pRegions,
+                                                                      &p2pRegions);
         }
-    }
-
-    AutoBuffer<MemoryImageCopyRegion, 32, Platform> newRegions(newRegionCount, m_pDevice->GetPlatform());
-    AutoBuffer<gpusize, 32, Platform> chunkAddrs(newRegionCount, m_pDevice->GetPlatform());
 
-    if (p2pBltInfoRequired)
-    {
-        if ((newRegions.Capacity() >= newRegionCount) && (chunkAddrs.Capacity() >= newRegionCount))
+        if (result == Result::Success)
         {
-            if (isImageDst)
-            {
-                m_pDevice->P2pBltWaModifyRegionListMemoryToImage(gpuMemory,
-                                                                 image,
-                                                                 regionCount,
-                                                                 pRegions,
-                                                                 &newRegionCount,
-                                                                 &newRegions[0],
-                                                                 &chunkAddrs[0]);
-            }
-            else
-            {
-                m_pDevice->P2pBltWaModifyRegionListImageToMemory(image,
-                                                                 gpuMemory,
-                                                                 regionCount,
-                                                                 pRegions,
-                                                                 &newRegionCount,
-                                                                 &newRegions[0],
-                                                                 &chunkAddrs[0]);
-            }
-
-            regionCount = newRegionCount;
-            pRegions    = &newRegions[0];
+            regionCount = p2pRegions.NumRegions();
+            pRegions    = p2pRegions.regions.Data();
+            pChunkAddrs = p2pRegions.chunkAddrs.Data();
 
             const GpuMemory* pDstGpuMemory = isImageDst ? image.GetBoundGpuMemory().Memory() : &gpuMemory;
-            pCmdBuffer->P2pBltWaCopyBegin(pDstGpuMemory, regionCount, &chunkAddrs[0]);
+            pCmdBuffer->P2pBltWaCopyBegin(pDstGpuMemory, regionCount, pChunkAddrs);
         }
         else
         {
@@ -1648,7 +1639,7 @@ void RsrcProcMgr::CopyBetweenMemoryAndImage(
 
         if (p2pBltInfoRequired)
         {
-            pCmdBuffer->P2pBltWaCopyNextRegion(chunkAddrs[idx]);
+            pCmdBuffer->P2pBltWaCopyNextRegion(pChunkAddrs[idx]);
         }
 
         // It will be faster to use a raw format, but we must stick with the base format if replacement isn't an option.
@@ -382,27 +382,76 @@ Result DeviceDecorator::CreateQueue(
 }
 
 // =====================================================================================================================
-Result DeviceDecorator::ResetFences(
+// Returns an array holding the next layer's version of each fence or null if this thread's scratch array is unavailable.
+// If ppFences is the scratch array then an outer layer has already copied the client's fences into it and they are
+// unwrapped in place. Otherwise they are copied into the scratch array and the caller must release it.
+IFence** DeviceDecorator::UnwrapFences(
     uint32              fenceCount,
-    IFence*const*       ppFences
+    const IFence*const* ppFences,
+    bool*               pReleaseScratch
     ) const
 {
-    AutoBuffer<IFence*, 16, PlatformDecorator> fences(fenceCount, GetPlatform());
+    IFence** ppNextFences = nullptr;
 
-    Result result = Result::Success;
+    (*pReleaseScratch) = false;
 
-    if (fences.Capacity() < fenceCount)
+    if (m_pPlatform->IsFenceScratch(ppFences))
     {
-        result = Result::ErrorOutOfMemory;
+        ppNextFences = const_cast<IFence**>(ppFences);
     }
     else
+    {
+        ppNextFences       = m_pPlatform->AcquireFenceScratch(fenceCount);
+        (*pReleaseScratch) = (ppNextFences != nullptr);
+    }
+
+    if (ppNextFences != nullptr)
     {
         for (uint32 i = 0; i < fenceCount; i++)
         {
-            fences[i] = NextFence(ppFences[i]);
+            ppNextFences[i] = NextFence(ppFences[i]);
+        }
+    }
+
+    return ppNextFences;
+}
+
+// =====================================================================================================================
+Result DeviceDecorator::ResetFences(
+    uint32              fenceCount,
+    IFence*const*       ppFences
+    ) const
+{
+    Result   result         = Result::Success;
+    bool     releaseScratch = false;
+    IFence** ppNextFences   = UnwrapFences(fenceCount, ppFences, &releaseScratch);
+
+    if (ppNextFences != nullptr)
+    {
+        result = m_pNextLayer->ResetFences(fenceCount, ppNextFences);
+
+        if (releaseScratch)
+        {
+            m_pPlatform->ReleaseFenceScratch();
+        }
+    }
+    else
+    {
+        AutoBuffer<IFence*, 16, PlatformDecorator> fences(fenceCount, GetPlatform());
+
+        if (fences.Capacity() < fenceCount)
+        {
+            result = Result::ErrorOutOfMemory;
         }
+        else
+        {
+            for (uint32 i = 0; i < fenceCount; i++)
+            {
+                fences[i] = NextFence(ppFences[i]);
+            }
 
-        result = m_pNextLayer->ResetFences(fenceCount, &fences[0]);
+            result = m_pNextLayer->ResetFences(fenceCount, &fences[0]);
+        }
     }
 
     return result;
@@ -416,22 +465,36 @@ Result DeviceDecorator::WaitForFences(
     uint64              timeout
     ) const
 {
-    AutoBuffer<const IFence*, 16, PlatformDecorator> fences(fenceCount, GetPlatform());
-
-    Result result = Result::Success;
+    Result   result         = Result::Success;
+    bool     releaseScratch = false;
+    IFence** ppNextFences   = UnwrapFences(fenceCount, ppFences, &releaseScratch);
 
-    if (fences.Capacity() < fenceCount)
+    if (ppNextFences != nullptr)
     {
-        result = Result::ErrorOutOfMemory;
+        result = m_pNextLayer->WaitForFences(fenceCount, ppNextFences, waitAll, timeout);
+
+        if (releaseScratch)
+        {
+            m_pPlatform->ReleaseFenceScratch();
+        }
     }
     else
     {
-        for (uint32 i = 0; i < fenceCount; i++)
+        AutoBuffer<const IFence*, 16, PlatformDecorator> fences(fenceCount, GetPlatform());
+
+        if (fences.Capacity() < fenceCount)
         {
-            fences[i] = NextFence(ppFences[i]);
+            result = Result::ErrorOutOfMemory;
         }
+        else
+        {
+            for (uint32 i = 0; i < fenceCount; i++)
+            {
+                fences[i] = NextFence(ppFences[i]);
+            }
 
-        result = m_pNextLayer->WaitForFences(fenceCount, &fences[0], waitAll, timeout);
+            result = m_pNextLayer->WaitForFences(fenceCount, &fences[0], waitAll, timeout);
+        }
     }
 
     return result;
@@ -2110,6 +2173,10 @@ PlatformDecorator::PlatformDecorator(
     m_pClientPrivateData(nullptr),
     m_installDeveloperCb(installDeveloperCb),
     m_layerEnabled(isLayerEnabled),
+    m_pFenceScratchOwner(this),
+    m_fenceScratchKey(),
+    m_fenceScratchKeyValid(false),
+    m_fenceScratch(this),
     m_logDirCreated(false)
 {
     memset(&m_pDevices[0], 0, sizeof(m_pDevices));
@@ -2125,6 +2192,20 @@ PlatformDecorator::PlatformDecorator(
 PlatformDecorator::~PlatformDecorator()
 {
     TearDownGpus();
+
+    for (uint32 idx = 0; idx < m_fenceScratch.NumElements(); ++idx)
+    {
+        FenceScratch* pScratch = m_fenceScratch.At(idx);
+
+        PAL_SAFE_DELETE_ARRAY(pScratch->ppFences, this);
+        PAL_SAFE_DELETE(pScratch, this);
+    }
+
+    if (m_fenceScratchKeyValid)
+    {
+        const Result result = DeleteThreadLocalKey(m_fenceScratchKey);
+        PAL_ASSERT(result == Result::Success);
+    }
 }
 
 // =====================================================================================================================
@@ -2137,9 +2218,111 @@ Result PlatformDecorator::Init()
         result = m_logDirMutex.Init();
     }
 
+    if (result == Result::Success)
+    {
+        result = m_fenceScratchLock.Init();
+    }
+
     return result;
 }
 
+// =====================================================================================================================
+// Makes this platform the owner of every thread's fence scratch array. Called on the outermost layer once the layer
+// chain has been built. If this fails the layers fall back to copying fence arrays on the stack.
+void PlatformDecorator::InitFenceScratch()
+{
+    PAL_ASSERT(m_pFenceScratchOwner == this);
+
+    m_fenceScratchKeyValid = (CreateThreadLocalKey(&m_fenceScratchKey) == Result::Success);
+}
+
+// =====================================================================================================================
+// Returns the calling thread's fence scratch array or null if it hasn't been created yet.
+PlatformDecorator::FenceScratch* PlatformDecorator::GetFenceScratch() const
+{
+    const PlatformDecorator*const pOwner = m_pFenceScratchOwner;
+
+    return pOwner->m_fenceScratchKeyValid ? static_cast<FenceScratch*>(GetThreadLocalValue(pOwner->m_fenceScratchKey))
+                                          : nullptr;
+}
+
+// =====================================================================================================================
+// Returns true if pFences is the calling thread's fence scratch array and an outer layer is passing it down.
+bool PlatformDecorator::IsFenceScratch(
+    const void* pFences)
+{
+    const FenceScratch*const pScratch = GetFenceScratch();
+
+    return (pScratch != nullptr) && pScratch->inUse && (pScratch->ppFences == pFences);
+}
+
+// =====================================================================================================================
+// Returns the calling thread's fence scratch array, grown to hold at least fenceCount fences, or null if it is already
+// in use or couldn't be allocated. The caller must call ReleaseFenceScratch once the layers below have returned.
+IFence** PlatformDecorator::AcquireFenceScratch(
+    uint32 fenceCount)
+{
+    constexpr uint32 MinFenceScratchSize = 64;
+
+    PlatformDecorator*const pOwner   = m_pFenceScratchOwner;
+    FenceScratch*           pScratch = GetFenceScratch();
+    IFence**                ppFences = nullptr;
+
+    if ((pScratch == nullptr) && pOwner->m_fenceScratchKeyValid)
+    {
+        pScratch = PAL_NEW(FenceScratch, pOwner, AllocInternal);
+
+        if (pScratch != nullptr)
+        {
+            pScratch->ppFences = nullptr;
+            pScratch->capacity = 0;
+            pScratch->inUse    = false;
+
+            MutexAuto lock(&pOwner->m_fenceScratchLock);
+
+            if (pOwner->m_fenceScratch.PushBack(pScratch) != Result::Success)
+            {
+                PAL_SAFE_DELETE(pScratch, pOwner);
+            }
+            else if (SetThreadLocalValue(pOwner->m_fenceScratchKey, pScratch) != Result::Success)
+            {
+                // The destructor still frees it.
+                pScratch = nullptr;
+            }
+        }
+    }
+
+    if ((pScratch != nullptr) && (pScratch->inUse == false))
+    {
+        if (pScratch->capacity < fenceCount)
+        {
+            const uint32 capacity = Max(fenceCount, MinFenceScratchSize);
+
+            PAL_SAFE_DELETE_ARRAY(pScratch->ppFences, pOwner);
+            pScratch->ppFences = PAL_NEW_ARRAY(IFence*, capacity, pOwner, AllocInternal);
+            pScratch->capacity = (pScratch->ppFences != nullptr) ? capacity : 0;
+        }
+
+        if ((pScratch->ppFences != nullptr) && (pScratch->capacity >= fenceCount))
+        {
+            pScratch->inUse = true;
+            ppFences        = pScratch->ppFences;
+        }
+    }
+
+    return ppFences;
+}
+
+// =====================================================================================================================
+// Marks the calling thread's fence scratch array as free again after a successful AcquireFenceScratch.
+void PlatformDecorator::ReleaseFenceScratch()
+{
+    FenceScratch*const pScratch = GetFenceScratch();
+
+    PAL_ASSERT((pScratch != nullptr) && pScratch->inUse);
+    pScratch->inUse = false;
+}
+
 // =====================================================================================================================
 void PlatformDecorator::TearDownGpus()
 {
@@ -2279,6 +2462,24 @@ void PAL_STDCALL PlatformDecorator::DefaultDeveloperCb(
     case Developer::CallbackType::BarrierBegin:
     case Developer::CallbackType::BarrierEnd:
         break;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+    case Developer::CallbackType::CmdBufferBegin:
+    case Developer::CallbackType::CmdBufferEnd:
+        PAL_ASSERT(pCbData != nullptr);
+        TranslateCmdBufferCpuData(pCbData);
+        break;
+    case Developer::CallbackType::QueueSubmitBegin:
+    case Developer::CallbackType::QueueSubmitEnd:
+        PAL_ASSERT(pCbData != nullptr);
+        TranslateQueueSubmitCpuData(pCbData);
+        break;
+    case Developer::CallbackType::CmdAllocatorChunkMiss:
+        PAL_ASSERT(pCbData != nullptr);
+        TranslateCmdAllocatorChunkMissData(pCbData);
+        break;
+    case Developer::CallbackType::CreatePipeline:
+        break;
+#endif
 
     default:
         // If we are here, there is a callback we haven't implemented above!
@@ -52,6 +52,8 @@
 #include "palScreen.h"
 #include "palSwapChain.h"
 #include "palSysMemory.h"
+#include "palThread.h"
+#include "palVector.h"
 
 // =====================================================================================================================
 // The following classes are all implementations of the Decorator pattern for the public PAL interface.
@@ -192,6 +194,51 @@ static bool TranslateDrawDispatchData(
     return hasValidData;
 }
 
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+// =====================================================================================================================
+// Returns true if the PreviousObject was non-null, and thus the pData->pCmdBuffer data is valid for this layer.
+static bool TranslateCmdBufferCpuData(
+    void* pCbData)
+{
+    Developer::CmdBufferCpuData* pData = static_cast<Developer::CmdBufferCpuData*>(pCbData);
+
+    ICmdBuffer* pPrevCmdBuffer         = PreviousObject(pData->pCmdBuffer);
+    const bool  hasValidData           = (pPrevCmdBuffer != nullptr);
+    pData->pCmdBuffer                  = (hasValidData) ? pPrevCmdBuffer : pData->pCmdBuffer;
+
+    return hasValidData;
+}
+
+// =====================================================================================================================
+// Returns true if the PreviousObject was non-null, and thus the pData->pQueue data is valid for this layer.
+static bool TranslateQueueSubmitCpuData(
+    void* pCbData)
+{
+    Developer::QueueSubmitCpuData* pData = static_cast<Developer::QueueSubmitCpuData*>(pCbData);
+
+    IQueue*    pPrevQueue                = PreviousObject(pData->pQueue);
+    const bool hasValidData              = (pPrevQueue != nullptr);
+    pData->pQueue                        = (hasValidData) ? pPrevQueue : pData->pQueue;
+
+    return hasValidData;
+}
+
+// =====================================================================================================================
+// Returns true if the PreviousObject was non-null, and thus the pData->pCmdAllocator data is valid for this layer.
+static bool TranslateCmdAllocatorChunkMissData(
+    void* pCbData)
+{
+    Developer::CmdAllocatorChunkMissData* pData = static_cast<Developer::CmdAllocatorChunkMissData*>(pCbData);
+
+    ICmdAllocator* pPrevCmdAllocator            = PreviousObject(pData->pCmdAllocator);
+    const bool     hasValidData                 = (pPrevCmdAllocator != nullptr);
+    pData->pCmdAllocator                        = (hasValidData) ? pPrevCmdAllocator : pData->pCmdAllocator;
+
+    return hasValidData;
+}
+
+#endif
+
 // =====================================================================================================================
 class PlatformDecorator : public IPlatform
 {
@@ -288,6 +335,16 @@ public:
     IPlatform* GetNextLayer() const { return m_pNextLayer; }
     const char* LogDirPath() const { return m_logDirPath; }
 
+    // Fence arrays passed to IDevice::ResetFences and IDevice::WaitForFences are unwrapped through a per-thread scratch
+    // array owned by the outermost layer. That layer copies the client's array into the scratch array once and every
+    // layer below it unwraps the same array in place.
+    void InitFenceScratch();
+    void SetFenceScratchOwner(PlatformDecorator* pOwner) { m_pFenceScratchOwner = pOwner; }
+
+    IFence** AcquireFenceScratch(uint32 fenceCount);
+    void ReleaseFenceScratch();
+    bool IsFenceScratch(const void* pFences);
+
 protected:
     virtual ~PlatformDecorator();
 
@@ -310,6 +367,23 @@ protected:
     const bool             m_layerEnabled;
 
 private:
+    struct FenceScratch
+    {
+        IFence** ppFences;
+        uint32   capacity;
+        bool     inUse;    // Set while a layer is passing ppFences down the layer chain.
+    };
+
+    FenceScratch* GetFenceScratch() const;
+
+    PlatformDecorator*     m_pFenceScratchOwner;   // The outermost layer, which owns every thread's scratch array.
+    Util::ThreadLocalKey   m_fenceScratchKey;      // Maps each thread to its FenceScratch.
+    bool                   m_fenceScratchKeyValid;
+    Util::Mutex            m_fenceScratchLock;     // Serializes access to m_fenceScratch.
+
+    // Every thread's FenceScratch, so they can be freed when the platform is destroyed.
+    Util::Vector<FenceScratch*, 8, PlatformDecorator> m_fenceScratch;
+
     bool                   m_logDirCreated;        // The log dir can only be created once.
     Util::Mutex            m_logDirMutex;          // Grants access to CreateLogDir.
 
@@ -1066,6 +1140,8 @@ private:
     virtual PrivateScreenDecorator* NewPrivateScreenDecorator(IPrivateScreen* pNextScreen, uint32 deviceIdx);
     static void PAL_STDCALL DestroyPrivateScreen(void* pOwner);
 
+    IFence** UnwrapFences(uint32 fenceCount, const IFence*const* ppFences, bool* pReleaseScratch) const;
+
     PAL_DISALLOW_DEFAULT_CTOR(DeviceDecorator);
     PAL_DISALLOW_COPY_AND_ASSIGN(DeviceDecorator);
 };
@@ -53,13 +53,10 @@ CmdBuffer::CmdBuffer(
     m_pDevice(pDevice),
     m_queueType(createInfo.queueType),
     m_engineType(createInfo.engineType),
-#if (PAL_COMPILE_TYPE == 32)
-    m_tokenAllocator(4 * 1024 * 1024),
-#else
-    m_tokenAllocator(16 * 1024 * 1024),
-#endif
+    m_pTokenAllocator(nullptr),
     m_pTokenStream(nullptr),
     m_pTokenRdPtr(nullptr),
+    m_recordId(0),
     m_disableDataGathering(false),
     m_forceDrawGranularityLogging(false),
     m_curLogFrame(0)
@@ -90,14 +87,29 @@ CmdBuffer::CmdBuffer(
     m_flags.enableSqThreadTrace = enableSqThreadTrace;
 }
 
+// =====================================================================================================================
+CmdBuffer::~CmdBuffer()
+{
+    if (m_pTokenAllocator != nullptr)
+    {
+        m_pDevice->ReleaseLinearAllocator(LinearAllocType::TokenStream, m_pTokenAllocator);
+    }
+}
+
 // =====================================================================================================================
 Result CmdBuffer::Init()
 {
-    Result result = m_tokenAllocator.Init();
+    Result result = Result::Success;
 
-    if (result == Result::Success)
+    m_pTokenAllocator = m_pDevice->AcquireLinearAllocator(LinearAllocType::TokenStream);
+
+    if (m_pTokenAllocator == nullptr)
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+    else
     {
-        m_pTokenStream = m_tokenAllocator.Current();
+        m_pTokenStream = m_pTokenAllocator->Start();
     }
 
     return result;
@@ -108,10 +120,12 @@ Result CmdBuffer::Begin(
     const CmdBufferBuildInfo& info)
 {
     m_flags.containsPresent = 0;
+    m_flags.replayCacheable = (info.flags.optimizeOneTimeSubmit == 0);
+    m_recordId              = m_pDevice->NextRecordId();
 
     // Rewind the allocator to the beginning, overwriting any tokens stored from the last time this command buffer was
     // recorded.
-    m_tokenAllocator.Rewind(m_pTokenStream, false);
+    m_pTokenAllocator->Rewind(m_pTokenStream, false);
 
     InsertToken(CmdBufCallId::Begin);
     InsertToken(info);
@@ -243,6 +257,10 @@ Result CmdBuffer::Reset(
     ICmdAllocator* pCmdAllocator,
     bool           returnGpuMemory)
 {
+    // Any replay of the previous recording must not be reused once the client starts over.
+    m_flags.replayCacheable = 0;
+    m_recordId              = 0;
+
     return NextLayer()->Reset(NextCmdAllocator(pCmdAllocator), returnGpuMemory);
 }
 
@@ -2828,6 +2846,9 @@ void CmdBuffer::CmdExecuteNestedCmdBuffers(
 {
     InsertToken(CmdBufCallId::CmdExecuteNestedCmdBuffers);
     InsertTokenArray(ppCmdBuffers, cmdBufferCount);
+
+    // Nested command buffers are replayed into queue-owned command buffers which are recycled after every submit.
+    m_flags.replayCacheable = 0;
 }
 
 // =====================================================================================================================
@@ -3304,6 +3325,9 @@ void CmdBuffer::ReplayCmdSetUserClipPlanes(
 void CmdBuffer::CmdStartGpuProfilerLogging()
 {
     InsertToken(CmdBufCallId::CmdStartGpuProfilerLogging);
+
+    // This forces data gathering during replay so each submit needs a fresh replay.
+    m_flags.replayCacheable = 0;
 }
 
 // =====================================================================================================================
@@ -3627,32 +3651,46 @@ void CmdBuffer::ReplayCmdSetViewInstanceMask(
 TargetCmdBuffer::TargetCmdBuffer(
     const CmdBufferCreateInfo& createInfo,
     ICmdBuffer*                pNextCmdBuffer,
-    const DeviceDecorator*     pNextDevice)
+    Device*                    pDevice)
     :
-    CmdBufferFwdDecorator(pNextCmdBuffer, pNextDevice),
-#if (PAL_COMPILE_TYPE == 32)
-    m_allocator(2 * 1024 * 1024),
-#else
-    m_allocator(8 * 1024 * 1024),
-#endif
+    CmdBufferFwdDecorator(pNextCmdBuffer, pDevice),
+    m_pDevice(pDevice),
+    m_pAllocator(nullptr),
     m_pAllocatorStream(nullptr),
     m_pCurrentBarrierComment(nullptr),
     m_currentCommentSize(0),
     m_queueType(createInfo.queueType),
     m_engineType(createInfo.engineType),
     m_supportTimestamps(false),
-    m_pGpaSession(nullptr)
+    m_pGpaSession(nullptr),
+    m_pendingSubmits(0),
+    m_isReplayCached(false)
+{
+}
+
+// =====================================================================================================================
+TargetCmdBuffer::~TargetCmdBuffer()
 {
+    if (m_pAllocator != nullptr)
+    {
+        m_pDevice->ReleaseLinearAllocator(LinearAllocType::BarrierComment, m_pAllocator);
+    }
 }
 
 // =====================================================================================================================
 Result TargetCmdBuffer::Init()
 {
-    Result result = m_allocator.Init();
+    Result result = Result::Success;
 
-    if (result == Result::Success)
+    m_pAllocator = m_pDevice->AcquireLinearAllocator(LinearAllocType::BarrierComment);
+
+    if (m_pAllocator == nullptr)
+    {
+        result = Result::ErrorOutOfMemory;
+    }
+    else
     {
-        m_pAllocatorStream = m_allocator.Current();
+        m_pAllocatorStream = m_pAllocator->Start();
     }
 
     DeviceProperties info;
@@ -3675,7 +3713,7 @@ Result TargetCmdBuffer::Begin(
 {
     // Rewind the allocator to the beginning, overwriting any data stored from the last time this command buffer was
     // recorded.
-    m_allocator.Rewind(m_pAllocatorStream, false);
+    m_pAllocator->Rewind(m_pAllocatorStream, false);
     ResetBarrierString();
 
     return CmdBufferFwdDecorator::Begin(info);
@@ -3703,7 +3741,7 @@ void TargetCmdBuffer::AddBarrierString(
         newStringLenToAlloc -= 1;
     }
 
-    if (newStringLenToAlloc > m_allocator.Remaining())
+    if (newStringLenToAlloc > m_pAllocator->Remaining())
     {
         // Do nothing if this string won't fit in the linear allocator; this is better than crashing on release builds.
         // Increase the size of the linear allocator to see all of the strings.
@@ -3721,7 +3759,7 @@ void TargetCmdBuffer::AddBarrierString(
         const AllocInfo info(newStringLenToAlloc, 1, false, AllocInternal);
 #endif
 
-        char* pBarrierComment = static_cast<char*>(m_allocator.Alloc(info));
+        char* pBarrierComment = static_cast<char*>(m_pAllocator->Alloc(info));
         if (m_pCurrentBarrierComment == nullptr)
         {
             m_pCurrentBarrierComment = pBarrierComment;
@@ -66,6 +66,10 @@ public:
 
     bool ContainsPresent() const { return m_flags.containsPresent; }
 
+    // A recording can be replayed once and the result resubmitted if nothing in it depends on per-replay state.
+    bool   ReplayCacheable() const { return (m_flags.replayCacheable != 0); }
+    uint32 RecordId() const { return m_recordId; }
+
     ICmdBuffer* NextLayer() { return GetNextLayer(); }
     const ICmdBuffer* NextLayer() const { return GetNextLayer(); }
 
@@ -471,7 +475,7 @@ public:
     }
 
 private:
-    virtual ~CmdBuffer() { }
+    virtual ~CmdBuffer();
 
     static void PAL_STDCALL CmdSetUserDataCs(
         ICmdBuffer*   pCmdBuffer,
@@ -541,11 +545,11 @@ private:
     // where each free would be needed would be painful.
     void* AllocTokenSpace(size_t numBytes, size_t alignment)
     {
-        return m_tokenAllocator.Alloc(Util::AllocInfo(numBytes, alignment, false, Util::AllocInternal
+        return m_pTokenAllocator->Alloc(Util::AllocInfo(numBytes, alignment, false, Util::AllocInternal
 #if PAL_MEMTRACK
-                                                      , Util::MemBlkType::Malloc, nullptr, 0
+                                                        , Util::MemBlkType::Malloc, nullptr, 0
 #endif
-                                                      ));
+                                                        ));
     }
 
     // Insert a copy of the specified value into the token stream.
@@ -710,14 +714,14 @@ private:
 
     void LogPostTimedCall(Queue* pQueue, TargetCmdBuffer* pTgtCmdBuffer, LogItem* pLogItem);
 
-    Device*const                 m_pDevice;
-    const QueueType              m_queueType;
-    const EngineType             m_engineType;
+    Device*const                  m_pDevice;
+    const QueueType               m_queueType;
+    const EngineType              m_engineType;
 
-    Util::VirtualLinearAllocator m_tokenAllocator;   // Storage for tokenized commands.
-    void*                        m_pTokenStream;     // Base address of m_tokenAllocator.  Rewind here on command
+    Util::VirtualLinearAllocator* m_pTokenAllocator; // Storage for tokenized commands, borrowed from the device.
+    void*                         m_pTokenStream;    // Base address of m_pTokenAllocator.  Rewind here on command
                                                      // buffer reset.
-    void*                        m_pTokenRdPtr;      // Current read pointer used as a convenience by all replay
+    void*                         m_pTokenRdPtr;     // Current read pointer used as a convenience by all replay
                                                      // methods.
 
     struct
@@ -726,9 +730,12 @@ private:
         uint32 enableSqThreadTrace :  1;  // Thread traces should be collected based on specified data granularity.
         uint32 containsPresent     :  1;  // A CmdPresent() call is made in this command buffer.
         uint32 nested              :  1;  // This is a nested command buffer.
-        uint32 reserved            : 28;
+        uint32 replayCacheable     :  1;  // The result of replaying this recording may be reused by later submits.
+        uint32 reserved            : 27;
     } m_flags;
 
+    uint32 m_recordId; // Device-unique ID of the current recording, assigned at Begin().
+
     union
     {
         struct
@@ -771,7 +778,7 @@ public:
     TargetCmdBuffer(
         const CmdBufferCreateInfo& createInfo,
         ICmdBuffer*                pNextCmdBuffer,
-        const DeviceDecorator*     pNextDevice);
+        Device*                    pDevice);
 
     Result Init();
 
@@ -790,22 +797,33 @@ public:
     Result EndGpaSession(LogItem* pLogItem);
     GpuUtil::GpaSession* GetGpaSession() { return m_pGpaSession; }
 
+    // The owning queue tracks how many in-flight submits reference this command buffer and whether it holds a cached
+    // replay. It can only be recycled once neither is true.
+    void AddSubmitRef() { m_pendingSubmits++; }
+    void RemoveSubmitRef() { PAL_ASSERT(m_pendingSubmits > 0); m_pendingSubmits--; }
+    void SetReplayCached(bool isCached) { m_isReplayCached = isCached; }
+    bool IsReclaimable() const { return (m_pendingSubmits == 0) && (m_isReplayCached == false); }
+
 protected:
-    virtual ~TargetCmdBuffer() {}
+    virtual ~TargetCmdBuffer();
 
 private:
-    Util::VirtualLinearAllocator m_allocator;
-    void*                        m_pAllocatorStream; // Base address of m_allocator. Rewind here on reset.
+    Device*const                  m_pDevice;
+    Util::VirtualLinearAllocator* m_pAllocator;        // Barrier comment storage, borrowed from the device.
+    void*                         m_pAllocatorStream;  // Base address of m_pAllocator. Rewind here on reset.
 
     // Track the current comment string for the barrier call.
-    char*                        m_pCurrentBarrierComment;
-    size_t                       m_currentCommentSize;
+    char*                         m_pCurrentBarrierComment;
+    size_t                        m_currentCommentSize;
+
+    const QueueType               m_queueType;         // Universal, compute, etc.
+    const EngineType              m_engineType;
+    bool                          m_supportTimestamps; // This command buffer's engine supports timestamps.
 
-    const QueueType              m_queueType;         // Universal, compute, etc.
-    const EngineType             m_engineType;
-    bool                         m_supportTimestamps; // This command buffer (based on engine type) supports timestamps.
+    GpuUtil::GpaSession*          m_pGpaSession;
 
-    GpuUtil::GpaSession*         m_pGpaSession;
+    uint32                        m_pendingSubmits;    // Number of in-flight submits which reference this.
+    bool                          m_isReplayCached;    // Owned by the queue's replay cache rather than its free list.
 
     PAL_DISALLOW_DEFAULT_CTOR(TargetCmdBuffer);
     PAL_DISALLOW_COPY_AND_ASSIGN(TargetCmdBuffer);
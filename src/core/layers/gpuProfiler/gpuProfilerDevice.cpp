@@ -38,6 +38,21 @@ namespace GpuProfiler
 static GpuBlock StringToGpuBlock(const char* pString);
 static constexpr ShaderHash ZeroShaderHash = {};
 
+// Virtual address range reserved by each pooled linear allocator, indexed by LinearAllocType.
+static constexpr size_t LinearAllocSizes[] =
+{
+#if (PAL_COMPILE_TYPE == 32)
+    4 * 1024 * 1024, // TokenStream
+    2 * 1024 * 1024, // BarrierComment
+#else
+    16 * 1024 * 1024, // TokenStream
+    8 * 1024 * 1024,  // BarrierComment
+#endif
+};
+
+static_assert(ArrayLen(LinearAllocSizes) == static_cast<uint32>(LinearAllocType::Count),
+              "LinearAllocSizes must have one entry per LinearAllocType.");
+
 // =====================================================================================================================
 Device::Device(
     PlatformDecorator* pPlatform,
@@ -56,6 +71,8 @@ Device::Device(
     m_sqttCompilerHash(0),
     m_maxDrawsForThreadTrace(0),
     m_curDrawsForThreadTrace(0),
+    m_cacheIdleReplays(false),
+    m_nextRecordId(0),
     m_profilerGranularity(GpuProfilerGranularityDraw),
     m_stallMode(GpuProfilerStallAlways),
     m_startFrame(0),
@@ -84,6 +101,63 @@ Device::~Device()
     {
         PAL_SAFE_DELETE_ARRAY(m_pStreamingPerfCounters, GetPlatform());
     }
+
+    for (uint32 type = 0; type < static_cast<uint32>(LinearAllocType::Count); ++type)
+    {
+        for (auto iter = m_linearAllocFreeList[type].Begin(); iter.IsValid();)
+        {
+            VirtualLinearAllocatorWithNode*const pAllocator = iter.Get();
+            m_linearAllocFreeList[type].Erase(&iter);
+            PAL_DELETE(pAllocator, GetPlatform());
+        }
+    }
+}
+
+// =====================================================================================================================
+// Returns a linear allocator of the given type which is rewound to its start, or null if one couldn't be created.
+VirtualLinearAllocator* Device::AcquireLinearAllocator(
+    LinearAllocType type)
+{
+    const uint32 typeIdx = static_cast<uint32>(type);
+
+    VirtualLinearAllocatorWithNode* pAllocator = nullptr;
+
+    {
+        MutexAuto lock(&m_linearAllocLock);
+
+        if (m_linearAllocFreeList[typeIdx].IsEmpty() == false)
+        {
+            pAllocator = m_linearAllocFreeList[typeIdx].Back();
+            m_linearAllocFreeList[typeIdx].Erase(pAllocator->GetNode());
+        }
+    }
+
+    if (pAllocator == nullptr)
+    {
+        pAllocator = PAL_NEW(VirtualLinearAllocatorWithNode, GetPlatform(), AllocInternal)(LinearAllocSizes[typeIdx]);
+
+        if ((pAllocator != nullptr) && (pAllocator->Init() != Result::Success))
+        {
+            PAL_SAFE_DELETE(pAllocator, GetPlatform());
+        }
+    }
+
+    return pAllocator;
+}
+
+// =====================================================================================================================
+// Rewinds a linear allocator returned by AcquireLinearAllocator and puts it back on its free list. Its committed pages
+// are kept so that the next command buffer to use it doesn't have to fault them back in.
+void Device::ReleaseLinearAllocator(
+    LinearAllocType         type,
+    VirtualLinearAllocator* pAllocator)
+{
+    auto*const pPooledAllocator = static_cast<VirtualLinearAllocatorWithNode*>(pAllocator);
+
+    pPooledAllocator->Rewind(pPooledAllocator->Start(), false);
+
+    MutexAuto lock(&m_linearAllocLock);
+    m_linearAllocFreeList[static_cast<uint32>(type)].PushBack(pPooledAllocator->GetNode());
 }
 
 // =====================================================================================================================
@@ -117,6 +191,11 @@ Result Device::CommitSettingsAndInit()
 
     Result result = DeviceDecorator::CommitSettingsAndInit();
 
+    if (result == Result::Success)
+    {
+        result = m_linearAllocLock.Init();
+    }
+
     const auto& settings = GetPlatform()->PlatformSettings();
 
     // Capture properties and settings needed elsewhere in the GpuProfiler layer.
@@ -169,6 +248,7 @@ Result Device::CommitSettingsAndInit()
 
         m_startFrame          = settings.gpuProfilerConfig.startFrame;
         m_endFrame            = m_startFrame + settings.gpuProfilerConfig.frameCount;
+        m_cacheIdleReplays    = settings.gpuProfilerConfig.cacheIdleReplays;
 
         for (uint32 i = 0; i < EngineTypeCount; i++)
         {
@@ -28,6 +28,8 @@
 #include "core/layers/decorators.h"
 #include "core/layers/gpuProfiler/gpuProfilerPlatform.h"
 #include "core/g_palPlatformSettings.h"
+#include "palIntrusiveList.h"
+#include "palLinearAllocator.h"
 #include "palMutex.h"
 
 namespace Util { class File; }
@@ -40,6 +42,14 @@ enum class GpuBlock : uint32;
 namespace GpuProfiler
 {
 
+// Identifies the layer-internal storage backed by one of the Device's pooled linear allocators.
+enum class LinearAllocType : uint32
+{
+    TokenStream = 0, // Tokenized commands recorded by a CmdBuffer.
+    BarrierComment,  // Barrier comment strings gathered by a TargetCmdBuffer while it is replayed into.
+    Count
+};
+
 // Forward decl's.
 class TargetCmdBuffer;
 
@@ -87,8 +97,19 @@ public:
 
     bool LoggingEnabled(GpuProfilerGranularity granularity) const;
 
+    // Replayed command buffers may only be reused across submits while no profiling data is being gathered.
+    bool ReplayCachingAllowed() const { return m_cacheIdleReplays && (LoggingEnabled(m_profilerGranularity) == false); }
+
+    // Returns a new nonzero ID which identifies one recording of a command buffer.
+    uint32 NextRecordId() { return Util::AtomicIncrement(&m_nextRecordId); }
+
     bool SqttEnabledForPipeline(const PipelineInfo& info, PipelineBindPoint bindPoint) const;
 
+    // Command buffers take their linear allocators from these per-device free lists and return them on destruction so
+    // that creating a command buffer doesn't reserve and release a fresh range of virtual memory each time.
+    Util::VirtualLinearAllocator* AcquireLinearAllocator(LinearAllocType type);
+    void ReleaseLinearAllocator(LinearAllocType type, Util::VirtualLinearAllocator* pAllocator);
+
     // Public IDevice interface methods:
     virtual Result CommitSettingsAndInit() override;
     virtual size_t GetQueueSize(
@@ -185,6 +206,9 @@ private:
     uint32                 m_maxDrawsForThreadTrace;
     uint32                 m_curDrawsForThreadTrace;
 
+    bool                   m_cacheIdleReplays;
+    volatile uint32        m_nextRecordId;
+
     GpuProfilerGranularity m_profilerGranularity;
     GpuProfilerStallMode   m_stallMode;
     uint32                 m_startFrame;
@@ -204,6 +228,12 @@ private:
     static constexpr uint32 MaxEngineCount = 8;
     uint32 m_queueIds[EngineTypeCount][MaxEngineCount];
 
+    typedef Util::IntrusiveList<Util::VirtualLinearAllocatorWithNode> LinearAllocList;
+
+    // Rewound linear allocators which no command buffer currently owns, one list per LinearAllocType.
+    Util::Mutex     m_linearAllocLock;
+    LinearAllocList m_linearAllocFreeList[static_cast<uint32>(LinearAllocType::Count)];
+
     PAL_DISALLOW_DEFAULT_CTOR(Device);
     PAL_DISALLOW_COPY_AND_ASSIGN(Device);
 };
@@ -76,6 +76,7 @@ Queue::Queue(
     memset(&m_gpaSessionSampleConfig,    0, sizeof(m_gpaSessionSampleConfig));
     memset(&m_nextSubmitInfo,            0, sizeof(m_nextSubmitInfo));
     memset(&m_perFrameLogItem,           0, sizeof(m_perFrameLogItem));
+    memset(&m_replayCache[0],            0, sizeof(m_replayCache));
 
     // All nested allocations are set the the minimum size (4KB) because applications that submit hundreds of nested
     // command buffers can potentially exhaust the GPU VA range by simply playing back too many nested command buffers.
@@ -104,6 +105,12 @@ Queue::~Queue()
     PAL_ASSERT(m_pendingSubmits.NumElements() == 0);
     PAL_ASSERT(m_busyGpaSessions.NumElements() == 0);
 
+    // Everything is idle now, so releasing the replay cache moves its command buffers onto the available list.
+    for (uint32 idx = 0; idx < ReplayCacheSize; idx++)
+    {
+        ReleaseReplayCacheEntry(idx);
+    }
+
     while (m_availableCmdBufs.NumElements() > 0)
     {
         TargetCmdBuffer* pCmdBuf = nullptr;
@@ -402,16 +409,31 @@ Result Queue::Submit(
                     releaseObjects = true;
                 }
 
-                TargetCmdBuffer*const pTargetCmdBuffer = AcquireCmdBuf();
+                // If this exact recording was already replayed while no data was being gathered we can simply
+                // resubmit that replay.
+                const bool useReplayCache = pRecordedCmdBuffer->ReplayCacheable() &&
+                                            m_pDevice->ReplayCachingAllowed();
+
+                TargetCmdBuffer* pTargetCmdBuffer = useReplayCache ? AcquireCachedReplay(*pRecordedCmdBuffer) : nullptr;
+
+                if (pTargetCmdBuffer == nullptr)
+                {
+                    pTargetCmdBuffer = AcquireCmdBuf();
+
+                    // Replay the client-specified command buffer commands into the queue-owned command buffer.
+                    pRecordedCmdBuffer->Replay(this,
+                                               pTargetCmdBuffer,
+                                               static_cast<Platform*>(m_pDevice->GetPlatform())->FrameId());
+
+                    if (useReplayCache)
+                    {
+                        CacheReplay(*pRecordedCmdBuffer, pTargetCmdBuffer);
+                    }
+                }
 
                 // For the submit call, we need to make sure this array entry points to the next level ICmdBuffer.
                 nextCmdBuffers[cmdBufCnt] = NextCmdBuffer(pTargetCmdBuffer);
 
-                // Replay the client-specified command buffer commands into the queue-owned command buffer.
-                pRecordedCmdBuffer->Replay(this,
-                                           pTargetCmdBuffer,
-                                           static_cast<Platform*>(m_pDevice->GetPlatform())->FrameId());
-
                 if (hasCmdBufInfo)
                 {
                     // We need to copy the caller's CmdBufInfo.
@@ -665,12 +687,83 @@ TargetCmdBuffer* Queue::AcquireCmdBuf()
     // We always submit command buffers in the order they are acquired, so we can go ahead and add this to the busy
     // queue immediately.
     PAL_ASSERT(pCmdBuffer != nullptr);
+    pCmdBuffer->AddSubmitRef();
     m_busyCmdBufs.PushBack(pCmdBuffer);
     m_nextSubmitInfo.cmdBufCount++;
 
     return pCmdBuffer;
 }
 
+// =====================================================================================================================
+// Picks the replay cache slot for a recorded command buffer.
+uint32 Queue::ReplayCacheIndex(
+    const CmdBuffer& recordedCmdBuffer)
+{
+    // Command buffers are large objects so the low address bits carry no information.
+    return static_cast<uint32>((reinterpret_cast<size_t>(&recordedCmdBuffer) >> 8) % ReplayCacheSize);
+}
+
+// =====================================================================================================================
+// Returns the command buffer holding a cached replay of the current recording of recordedCmdBuffer, or null if there is
+// none. A hit is tracked with the next submit exactly like a freshly acquired command buffer.
+TargetCmdBuffer* Queue::AcquireCachedReplay(
+    const CmdBuffer& recordedCmdBuffer)
+{
+    const ReplayCacheEntry& entry      = m_replayCache[ReplayCacheIndex(recordedCmdBuffer)];
+    TargetCmdBuffer*        pCmdBuffer = nullptr;
+
+    if ((entry.pRecordedCmdBuffer == &recordedCmdBuffer) && (entry.recordId == recordedCmdBuffer.RecordId()))
+    {
+        pCmdBuffer = entry.pTargetCmdBuffer;
+
+        pCmdBuffer->AddSubmitRef();
+        m_busyCmdBufs.PushBack(pCmdBuffer);
+        m_nextSubmitInfo.cmdBufCount++;
+    }
+
+    return pCmdBuffer;
+}
+
+// =====================================================================================================================
+// Takes ownership of a freshly replayed command buffer so that later submits of the same recording can reuse it. This
+// evicts whatever was previously cached in the same slot.
+void Queue::CacheReplay(
+    const CmdBuffer& recordedCmdBuffer,
+    TargetCmdBuffer* pTargetCmdBuffer)
+{
+    const uint32 entryIdx = ReplayCacheIndex(recordedCmdBuffer);
+
+    ReleaseReplayCacheEntry(entryIdx);
+
+    ReplayCacheEntry*const pEntry = &m_replayCache[entryIdx];
+    pEntry->pRecordedCmdBuffer = &recordedCmdBuffer;
+    pEntry->recordId           = recordedCmdBuffer.RecordId();
+    pEntry->pTargetCmdBuffer   = pTargetCmdBuffer;
+
+    pTargetCmdBuffer->SetReplayCached(true);
+}
+
+// =====================================================================================================================
+// Empties a replay cache slot. Its command buffer returns to the available list now if it is idle; otherwise that
+// happens when its last submit retires.
+void Queue::ReleaseReplayCacheEntry(
+    uint32 entryIdx)
+{
+    ReplayCacheEntry*const pEntry = &m_replayCache[entryIdx];
+
+    if (pEntry->pTargetCmdBuffer != nullptr)
+    {
+        pEntry->pTargetCmdBuffer->SetReplayCached(false);
+
+        if (pEntry->pTargetCmdBuffer->IsReclaimable())
+        {
+            m_availableCmdBufs.PushBack(pEntry->pTargetCmdBuffer);
+        }
+    }
+
+    memset(pEntry, 0, sizeof(*pEntry));
+}
+
 // =====================================================================================================================
 // Acquires a queue-owned nested command buffer for execution of a replayed client nested command buffer.
 TargetCmdBuffer* Queue::AcquireNestedCmdBuf()
@@ -772,6 +865,11 @@ Result Queue::AcquireGpaSession(
         if (*ppGpaSession != nullptr)
         {
             result = (*ppGpaSession)->Init();
+
+            if (result != Result::Success)
+            {
+                PAL_SAFE_DELETE(*ppGpaSession, m_pDevice->GetPlatform());
+            }
         }
         else
         {
@@ -840,7 +938,13 @@ void Queue::ProcessIdleSubmits()
         {
             TargetCmdBuffer* pCmdBuffer = nullptr;
             m_busyCmdBufs.PopFront(&pCmdBuffer);
-            m_availableCmdBufs.PushBack(pCmdBuffer);
+            pCmdBuffer->RemoveSubmitRef();
+
+            // Command buffers in the replay cache stay there until they are evicted.
+            if (pCmdBuffer->IsReclaimable())
+            {
+                m_availableCmdBufs.PushBack(pCmdBuffer);
+            }
         }
 
         for (uint32 i = 0; i < submitInfo.nestedCmdBufCount; i++)
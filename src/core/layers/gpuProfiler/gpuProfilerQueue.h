@@ -212,6 +212,11 @@ private:
     IFence* AcquireFence();
     void ProcessIdleSubmits();
 
+    TargetCmdBuffer* AcquireCachedReplay(const CmdBuffer& recordedCmdBuffer);
+    void CacheReplay(const CmdBuffer& recordedCmdBuffer, TargetCmdBuffer* pTargetCmdBuffer);
+    void ReleaseReplayCacheEntry(uint32 entryIdx);
+    static uint32 ReplayCacheIndex(const CmdBuffer& recordedCmdBuffer);
+
     Result InternalSubmit(
         const SubmitInfo& submitInfo,
         bool              releaseObjects);
@@ -278,6 +283,19 @@ private:
 
     uint32                                      m_numReportedPerfCounters;
 
+    // Small direct-mapped cache of replayed command buffers which can be resubmitted as-is when the same recording is
+    // submitted again and no profiling data is being gathered. Entries are keyed by both the recorded command buffer
+    // and its record ID, so a stale entry can never match a re-recorded or recreated command buffer.
+    struct ReplayCacheEntry
+    {
+        const CmdBuffer* pRecordedCmdBuffer;
+        uint32           recordId;
+        TargetCmdBuffer* pTargetCmdBuffer;
+    };
+
+    static constexpr uint32 ReplayCacheSize = 64;
+    ReplayCacheEntry m_replayCache[ReplayCacheSize];
+
     // Tracks a list of fence objects owned by this queue that are ready for reuse.
     Util::Deque<IFence*, Platform>              m_availableFences;
 
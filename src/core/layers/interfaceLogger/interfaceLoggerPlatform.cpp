@@ -837,6 +837,24 @@ void PAL_STDCALL Platform::InterfaceLoggerCb(
         PAL_ASSERT(pCbData != nullptr);
         TranslateDrawDispatchData(pCbData);
         break;
+#if PAL_CLIENT_INTERFACE_MAJOR_VERSION >= 465
+    case Developer::CallbackType::CmdBufferBegin:
+    case Developer::CallbackType::CmdBufferEnd:
+        PAL_ASSERT(pCbData != nullptr);
+        TranslateCmdBufferCpuData(pCbData);
+        break;
+    case Developer::CallbackType::QueueSubmitBegin:
+    case Developer::CallbackType::QueueSubmitEnd:
+        PAL_ASSERT(pCbData != nullptr);
+        TranslateQueueSubmitCpuData(pCbData);
+        break;
+    case Developer::CallbackType::CmdAllocatorChunkMiss:
+        PAL_ASSERT(pCbData != nullptr);
+        TranslateCmdAllocatorChunkMissData(pCbData);
+        break;
+    case Developer::CallbackType::CreatePipeline:
+        break;
+#endif
     default:
         PAL_ASSERT_ALWAYS();
         break;
@@ -28,6 +28,9 @@
 #include "core/os/nullDevice/ndPlatform.h"
 #include "core/os/nullDevice/ndDevice.h"
 
+#if PAL_BUILD_LAYERS
+#include "core/layers/decorators.h"
+#endif
 #if PAL_BUILD_GPU_PROFILER
 #include "core/layers/gpuProfiler/gpuProfilerPlatform.h"
 #endif
@@ -225,6 +228,22 @@ Result PAL_STDCALL CreatePlatform(
     }
 #endif
 
+#if PAL_BUILD_LAYERS
+    if ((result == Result::Success) && (pCurPlatform != pCorePlatform))
+    {
+        // Every layer unwraps fence arrays in a per-thread scratch array owned by the outermost layer.
+        auto*const pOuterPlatform = static_cast<PlatformDecorator*>(pCurPlatform);
+        pOuterPlatform->InitFenceScratch();
+
+        for (IPlatform* pLayer = pCurPlatform;
+             pLayer != pCorePlatform;
+             pLayer = static_cast<PlatformDecorator*>(pLayer)->GetNextLayer())
+        {
+            static_cast<PlatformDecorator*>(pLayer)->SetFenceScratchOwner(pOuterPlatform);
+        }
+    }
+#endif
+
     if (result == Result::Success)
     {
         (*ppPlatform) = pCurPlatform;
@@ -40,7 +40,6 @@
 #include "palAutoBuffer.h"
 #include "palHashMapImpl.h"
 #include "palInlineFuncs.h"
-#include "palSettingsFileMgrImpl.h"
 #include "palSysMemory.h"
 #include "palSysUtil.h"
 #include "palVectorImpl.h"
@@ -106,8 +105,6 @@ static PAL_INLINE Result CheckResult(
 constexpr gpusize _4GB = (1ull << 32u);
 constexpr uint32 GpuPageSize = 4096;
 
-constexpr char SettingsFileName[]             = "amdPalSettings.cfg";
-constexpr char UserDefaultConfigFileSubPath[] = "/.config";
 constexpr char UserDefaultCacheFileSubPath[]  = "/.cache";
 constexpr char UserDefaultDebugFilePath[]     = "/var/tmp";
 
@@ -142,7 +139,6 @@ static Result OpenAndInitializeDrmDevice(
 // =====================================================================================================================
 Result Device::Create(
     Platform*               pPlatform,
-    const char*             pSettingsPath,
     const char*             pBusId,
     const char*             pPrimaryNode,
     const char*             pRenderNode,
@@ -204,7 +200,6 @@ Result Device::Create(
 
             DeviceConstructorParams constructorParams = {
                 .pPlatform             = pPlatform,
-                .pSettingsPath         = pSettingsPath,
                 .pBusId                = pBusId,
                 .pRenderNode           = pRenderNode,
                 .pPrimaryNode          = pPrimaryNode,
@@ -349,8 +344,6 @@ Device::Device(
     m_drmMajorVer(constructorParams.drmMajorVer),
     m_drmMinorVer(constructorParams.drmMinorVer),
     m_useDedicatedVmid(false),
-    m_pSettingsPath(constructorParams.pSettingsPath),
-    m_settingsMgr(SettingsFileName, constructorParams.pPlatform),
     m_pSvmMgr(nullptr),
     m_mapAllocator(),
     m_reservedVaMap(32, &m_mapAllocator),
@@ -580,46 +573,6 @@ Result Device::EarlyInit(
     // Init paths
     InitOutputPaths();
 
-    if (result == Result::Success)
-    {
-        // Step 1: try default(as well as global) path
-        result = m_settingsMgr.Init(m_pSettingsPath);
-
-        // Step 2: if no global setting found, try XDG_CONFIG_HOME and user specific path
-        if (result == Result::ErrorUnavailable)
-        {
-            const char* pXdgConfigPath = getenv("XDG_CONFIG_HOME");
-            if (pXdgConfigPath != nullptr)
-            {
-                result = m_settingsMgr.Init(pXdgConfigPath);
-            }
-            else
-            {
-                // XDG_CONFIG_HOME is not set, fall back to $HOME
-                char userDefaultConfigFilePath[MaxPathStrLen];
-
-                const char* pPath = getenv("HOME");
-                if (pPath != nullptr)
-                {
-                    Snprintf(userDefaultConfigFilePath, sizeof(userDefaultConfigFilePath), "%s%s",
-                             pPath, UserDefaultConfigFileSubPath);
-                    result = m_settingsMgr.Init(userDefaultConfigFilePath);
-                }
-                else
-                {
-                    result = Result::ErrorUnavailable;
-                }
-            }
-        }
-
-        if (result == Result::ErrorUnavailable)
-        {
-            //Unavailable means that the file was not found, which is an acceptable failure.
-            PAL_ALERT_ALWAYS();
-            result = Result::Success;
-        }
-    }
-
     if (result == Result::Success)
     {
         result = InitSettings();
@@ -1544,7 +1497,7 @@ Result Device::GetMultiGpuCompatibility(
 }
 
 // =====================================================================================================================
-// Reads a setting from a configuration file.
+// Reads a setting from the configuration file snapshot shared by all devices on the platform.
 bool Device::ReadSetting(
     const char*          pSettingName,
     Util::ValueType      valueType,
@@ -1553,7 +1506,10 @@ bool Device::ReadSetting(
     size_t               bufferSz
     ) const
 {
-    return m_settingsMgr.GetValue(pSettingName, valueType, pValue, bufferSz);
+    return static_cast<const Platform*>(m_pPlatform)->GetSettingsFileMgr().GetValue(pSettingName,
+                                                                                    valueType,
+                                                                                    pValue,
+                                                                                    bufferSz);
 }
 
 // =====================================================================================================================
@@ -27,7 +27,6 @@
 
 #include "core/device.h"
 #include "core/os/lnx/lnxHeaders.h"
-#include "palSettingsFileMgr.h"
 #include "palHashMap.h"
 #include "palIntrusiveList.h"
 #include "core/os/lnx/drmLoader.h"
@@ -73,7 +72,6 @@ struct ExternalSharedInfo
 struct DeviceConstructorParams
 {
     Platform*                   pPlatform;
-    const char*                 pSettingsPath;
     const char*                 pBusId;
     const char*                 pRenderNode;
     const char*                 pPrimaryNode;
@@ -99,7 +97,6 @@ class Device : public Pal::Device
 public:
     static Result Create(
         Platform*               pPlatform,
-        const char*             pSettingsPath,
         const char*             pBusId,
         const char*             pPrimaryNode,
         const char*             pRenderNode,
@@ -830,9 +827,6 @@ private:
     bool                 m_useDedicatedVmid;         // Indicate if use per-process VMID.
     bool                 m_supportExternalSemaphore; // Indicate if external semaphore is supported.
 
-    const char*                     m_pSettingsPath;
-    Util::SettingsFileMgr<Platform> m_settingsMgr;
-
     SvmMgr* m_pSvmMgr;
 
     struct ReservedVaRangeInfo
@@ -26,6 +26,7 @@
 #include "core/os/lnx/lnxPlatform.h"
 #include "core/os/lnx/lnxDevice.h"
 #include "core/os/lnx/lnxScreen.h"
+#include "palSettingsFileMgrImpl.h"
 #include "palSysMemory.h"
 #include "palSysUtil.h"
 #include "palFile.h"
@@ -57,12 +58,17 @@ Platform* Platform::CreateInstance(
 namespace Linux
 {
 
+constexpr char SettingsFileName[]             = "amdPalSettings.cfg";
+constexpr char UserDefaultConfigFileSubPath[] = "/.config";
+
 // =====================================================================================================================
 Platform::Platform(
     const PlatformCreateInfo&   createInfo,
     const Util::AllocCallbacks& allocCb)
     :
-    Pal::Platform(createInfo, allocCb)
+    Pal::Platform(createInfo, allocCb),
+    m_settingsMgr(SettingsFileName, this),
+    m_settingsMgrInitialized(false)
 {
     m_features.u32All = 0;
 }
@@ -159,6 +165,55 @@ Result Platform::ConnectToOsInterface()
     return Result::Success;
 }
 
+// =====================================================================================================================
+// Parses the settings file into the platform's settings snapshot. This only happens the first time devices are
+// enumerated; every device created on this platform (including after re-enumeration) reads from the same snapshot
+// instead of parsing the file again.
+Result Platform::InitSettingsFileMgr()
+{
+    Result result = Result::Success;
+
+    if (m_settingsMgrInitialized == false)
+    {
+        // Step 1: try default(as well as global) path
+        result = m_settingsMgr.Init(&m_settingsPath[0]);
+
+        // Step 2: if no global setting found, try XDG_CONFIG_HOME and user specific path
+        if (result == Result::ErrorUnavailable)
+        {
+            const char* pXdgConfigPath = getenv("XDG_CONFIG_HOME");
+            if (pXdgConfigPath != nullptr)
+            {
+                result = m_settingsMgr.Init(pXdgConfigPath);
+            }
+            else
+            {
+                // XDG_CONFIG_HOME is not set, fall back to $HOME
+                char userDefaultConfigFilePath[MaxPathStrLen];
+
+                const char* pPath = getenv("HOME");
+                if (pPath != nullptr)
+                {
+                    Util::Snprintf(userDefaultConfigFilePath, sizeof(userDefaultConfigFilePath), "%s%s",
+                                   pPath, UserDefaultConfigFileSubPath);
+                    result = m_settingsMgr.Init(userDefaultConfigFilePath);
+                }
+            }
+        }
+
+        if (result == Result::ErrorUnavailable)
+        {
+            //Unavailable means that the file was not found, which is an acceptable failure.
+            PAL_ALERT_ALWAYS();
+            result = Result::Success;
+        }
+
+        m_settingsMgrInitialized = (result == Result::Success);
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Enumerates all devices actived by the kernel device driver.
 // This method may be called multiple times, because clients will use it to re-enumerate devices after a Device lost
@@ -170,7 +225,15 @@ Result Platform::ReQueryDevices()
     const DrmLoaderFuncs& drmProcs    = GetDrmLoader().GetProcsTable();
     int32        deviceCount          = drmProcs.pfnDrmGetDevices(pDevices, MaxDevices);
 
-    for (int32 i = 0; i < deviceCount; i++)
+    // All devices read their settings from the same snapshot, so parse the settings file before creating any of them.
+    const Result settingsResult = InitSettingsFileMgr();
+
+    if (settingsResult != Result::Success)
+    {
+        result = settingsResult;
+    }
+
+    for (int32 i = 0; (settingsResult == Result::Success) && (i < deviceCount); i++)
     {
         char    busId[MaxBusIdStringLen] = {};
         Device* pDevice                  = nullptr;
@@ -190,7 +253,6 @@ Result Platform::ReQueryDevices()
                        pDevices[i]->businfo.pci->func);
 
         result = Device::Create(this,
-                                &m_settingsPath[0],
                                 busId,
                                 pDevices[i]->nodes[DRM_NODE_PRIMARY],
                                 pDevices[i]->nodes[DRM_NODE_RENDER],
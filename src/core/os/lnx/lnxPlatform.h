@@ -29,6 +29,7 @@
 #include "core/os/lnx/dri3/dri3Loader.h"
 #include "core/os/lnx/drmLoader.h"
 #include "core/os/lnx/lnxHeaders.h"
+#include "palSettingsFileMgr.h"
 
 #if PAL_HAVE_WAYLAND_PLATFORM
 #include "core/os/lnx/wayland/g_waylandLoader.h"
@@ -80,6 +81,9 @@ public:
     bool  IsCreateSignaledSyncObjectSupported() const { return m_features.supportCreateSignaledSyncobj == 1; }
     bool  IsSyncobjFenceSupported()  const { return m_features.supportSyncobjFence  == 1; }
     bool  IsHostMappedForeignMemorySupported() const { return m_features.suportHostMappedForeignMemory == 1; }
+
+    // Settings parsed from the config file once per platform and shared by every device.
+    const Util::SettingsFileMgr<Platform>& GetSettingsFileMgr() const { return m_settingsMgr; }
 protected:
     virtual Result InitProperties() override;
     virtual Result ConnectToOsInterface() override;
@@ -90,6 +94,8 @@ protected:
         void*    pStorage[MaxScreens],
         IScreen* pScreens[MaxScreens]) override;
 
+    Result InitSettingsFileMgr();
+
     Dri3Loader    m_dri3Loader;
     DrmLoader     m_drmLoader;
 #if PAL_HAVE_WAYLAND_PLATFORM
@@ -118,6 +124,9 @@ protected:
         uint32 u32All;
     } m_features;
 
+    Util::SettingsFileMgr<Platform> m_settingsMgr;
+    bool                            m_settingsMgrInitialized;
+
 private:
     PAL_DISALLOW_COPY_AND_ASSIGN(Platform);
 };
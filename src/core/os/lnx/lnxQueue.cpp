@@ -43,6 +43,7 @@
 #include "palDequeImpl.h"
 #include "palListImpl.h"
 #include "palHashMapImpl.h"
+#include "palSysUtil.h"
 #include "palVectorImpl.h"
 #include "lnxTimestampFence.h"
 #include "lnxSyncobjFence.h"
@@ -124,7 +125,8 @@ SubmissionContext::SubmissionContext(
     m_engineId(engineId),
     m_queuePriority(priority),
     m_lastSignaledSyncObject(0),
-    m_hContext(nullptr)
+    m_hContext(nullptr),
+    m_lastRetiredTimestamp(0)
 {
 }
 
@@ -152,15 +154,49 @@ bool SubmissionContext::IsTimestampRetired(
     uint64 timestamp
     ) const
 {
-    struct amdgpu_cs_fence queryFence = {};
+    bool retired = IsTimestampKnownRetired(timestamp);
 
-    queryFence.context     = m_hContext;
-    queryFence.fence       = timestamp;
-    queryFence.ring        = m_engineId;
-    queryFence.ip_instance = 0;
-    queryFence.ip_type     = m_ipType;
+    if (retired == false)
+    {
+        struct amdgpu_cs_fence queryFence = {};
+
+        queryFence.context     = m_hContext;
+        queryFence.fence       = timestamp;
+        queryFence.ring        = m_engineId;
+        queryFence.ip_instance = 0;
+        queryFence.ip_type     = m_ipType;
+
+        retired = (m_device.QueryFenceStatus(&queryFence, 0) == Result::Success);
+
+        if (retired)
+        {
+            SetTimestampRetired(timestamp);
+        }
+    }
+
+    return retired;
+}
+
+// =====================================================================================================================
+// Advances the last retired timestamp to the given value if it's newer. Multiple threads may race to do this, so we
+// loop until either our value is stored or somebody else stored a newer one.
+void SubmissionContext::SetTimestampRetired(
+    uint64 timestamp
+    ) const
+{
+    uint64 lastRetired = m_lastRetiredTimestamp;
 
-    return (m_device.QueryFenceStatus(&queryFence, 0) == Result::Success);
+    while (lastRetired < timestamp)
+    {
+        const uint64 prevValue = AtomicCompareAndSwap64(&m_lastRetiredTimestamp, lastRetired, timestamp);
+
+        if (prevValue == lastRetired)
+        {
+            break;
+        }
+
+        lastRetired = prevValue;
+    }
 }
 
 // =====================================================================================================================
@@ -566,7 +602,18 @@ Result Queue::OsSubmit(
     }
     else
     {
+#if PAL_DEVELOPER_CPU_EVENTS
+        const int64 startTime = GetPerfCpuTime();
+#endif
+
         result = UpdateResourceList(submitInfo.pGpuMemoryRefs, submitInfo.gpuMemRefCount);
+
+#if PAL_DEVELOPER_CPU_EVENTS
+        if (internalSubmitInfo.pResourceListCpuTime != nullptr)
+        {
+            *internalSubmitInfo.pResourceListCpuTime = GetPerfCpuTime() - startTime;
+        }
+#endif
     }
 
     if (result == Result::Success)
@@ -76,6 +76,12 @@ public:
 
     virtual bool IsTimestampRetired(uint64 timestamp) const override;
 
+    // Returns true if the timestamp is already known to have retired, without asking the kernel.
+    bool IsTimestampKnownRetired(uint64 timestamp) const { return (timestamp <= m_lastRetiredTimestamp); }
+
+    // Records that all timestamps up to and including the given one have retired.
+    void SetTimestampRetired(uint64 timestamp) const;
+
     uint32                IpType()   const { return m_ipType; }
     uint32                EngineId() const { return m_engineId; }
     amdgpu_context_handle Handle()   const { return m_hContext; }
@@ -96,6 +102,10 @@ private:
     amdgpu_syncobj_handle       m_lastSignaledSyncObject;
     amdgpu_context_handle       m_hContext;  // Command submission context handle.
 
+    // The most recent timestamp observed to have retired. Timestamps retire in order on a context, so any timestamp at
+    // or below this value can be reported as retired without a kernel query.
+    mutable volatile uint64     m_lastRetiredTimestamp;
+
     PAL_DISALLOW_DEFAULT_CTOR(SubmissionContext);
     PAL_DISALLOW_COPY_AND_ASSIGN(SubmissionContext);
 };
@@ -100,7 +100,7 @@ Result SyncobjFence::WaitForFences(
 
     Result result = Result::ErrorOutOfMemory;
 
-    AutoBuffer<amdgpu_syncobj_handle, 16, Pal::Platform> fenceList(fenceCount, device.GetPlatform());
+    AutoBuffer<amdgpu_syncobj_handle, 64, Pal::Platform> fenceList(fenceCount, device.GetPlatform());
 
     uint32 count = 0;
     bool   isNeverSubmitted = false;
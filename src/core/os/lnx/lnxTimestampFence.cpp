@@ -174,7 +174,7 @@ Result TimestampFence::WaitForFences(
     const TimestampFence*const* ppLnxFenceList = reinterpret_cast<const TimestampFence*const*>(ppFenceList);
     const Device& lnxDevice                    = reinterpret_cast<const Device&>(device);
 
-    AutoBuffer<amdgpu_cs_fence, 16, Platform> fenceList(fenceCount, lnxDevice.GetPlatform());
+    AutoBuffer<amdgpu_cs_fence, 64, Platform> fenceList(fenceCount, lnxDevice.GetPlatform());
 
     uint32 count = 0;
 
@@ -223,6 +223,20 @@ Result TimestampFence::WaitForFences(
             // once PAL swap chain presents have been refactored because they will trigger batching internally.
             PAL_ASSERT(ppLnxFenceList[fence]->IsBatched() == false);
 
+            // Skip the kernel entirely for fences whose timestamp we've already seen retire.
+            if (pContext->IsTimestampKnownRetired(ppLnxFenceList[fence]->Timestamp()))
+            {
+                if (waitAll == true)
+                {
+                    continue;
+                }
+                else
+                {
+                    result = Result::Success;
+                    break;
+                }
+            }
+
             fenceList[count].context = pContext->Handle();
             fenceList[count].ip_type = pContext->IpType();
             fenceList[count].ip_instance = 0;
@@ -247,6 +261,21 @@ Result TimestampFence::WaitForFences(
                 count,
                 waitAll,
                 timeout);
+
+            // If we waited for all of them then every timestamp we passed to the kernel has retired; remember that so
+            // later status queries and waits on these contexts don't need a syscall.
+            if (waitAll && (result == Result::Success))
+            {
+                for (uint32 fence = 0; fence < fenceCount; ++fence)
+                {
+                    const auto*const pContext = ppLnxFenceList[fence]->m_pContext;
+
+                    if ((pContext != nullptr) && (ppLnxFenceList[fence]->IsBatched() == false))
+                    {
+                        pContext->SetTimestampRetired(ppLnxFenceList[fence]->Timestamp());
+                    }
+                }
+            }
         }
         else
         {
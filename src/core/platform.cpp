@@ -134,6 +134,10 @@ Platform::~Platform()
     SystemEventDestroy();
 #endif
 
+#if PAL_LOCK_CONTENTION_STATS
+    Util::ReportLockContention();
+#endif
+
 #if PAL_ENABLE_PRINTS_ASSERTS
     // Unhook the debug print callback to keep assert/alert function (majorly for client driver) after platform get
     // destroyed. Otherwise random crash can be triggered when calling g_dbgPrintCallback with a dangling pointer.
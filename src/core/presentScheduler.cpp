@@ -27,77 +27,44 @@
 #include "core/presentScheduler.h"
 #include "core/queue.h"
 #include "core/swapChain.h"
-#include "palIntrusiveListImpl.h"
+#include "palLockFreeRingBufferImpl.h"
+#include "palMutex.h"
 using namespace Util;
 
 namespace Pal
 {
 
-// =====================================================================================================================
-Result PresentSchedulerJob::CreateInternal(
-    Device*               pDevice,
-    PresentSchedulerJob** ppPresentSchedulerJob)
-{
-    const size_t totalSize = sizeof(PresentSchedulerJob) + pDevice->GetFenceSize(nullptr);
-    void*        pMemory   = PAL_MALLOC(totalSize, pDevice->GetPlatform(), AllocInternal);
-    Result       result    = Result::Success;
-
-    if (pMemory == nullptr)
-    {
-        result = Result::ErrorOutOfMemory;
-    }
-    else
-    {
-        PresentSchedulerJob*const pJob = PAL_PLACEMENT_NEW(pMemory) PresentSchedulerJob();
-
-        if (result == Result::Success)
-        {
-            *ppPresentSchedulerJob = pJob;
-        }
-        else
-        {
-            pJob->DestroyInternal(pDevice);
-        }
-    }
-
-    return result;
-}
-
-// =====================================================================================================================
-void PresentSchedulerJob::DestroyInternal(
-    Device* pDevice)
-{
-    Platform*const pPlatform = pDevice->GetPlatform();
-    this->~PresentSchedulerJob();
-    PAL_FREE(this, pPlatform);
-}
-
 // =====================================================================================================================
 PresentSchedulerJob::PresentSchedulerJob()
     :
-    m_node(this),
-    m_type(PresentJobType::Terminate)
+    m_type(PresentJobType::Terminate),
+    m_pQueue(nullptr)
 {
     memset(&m_presentInfo, 0, sizeof(m_presentInfo));
 }
 
-// =====================================================================================================================
-PresentSchedulerJob::~PresentSchedulerJob()
-{
-}
-
 // =====================================================================================================================
 PresentScheduler::PresentScheduler(
     Device* pDevice)
     :
     m_pDevice(pDevice),
     m_pSignalQueue(nullptr),
+    m_idleJobTop(0),
+    m_activeJobQueue(pDevice->GetPlatform()),
     m_workerActive(false)
 {
+    static_assert(JobPoolSize >= (2 * MaxSwapChainLength), "The present job pool is too small.");
+
     for (uint32 deviceIndex = 0; deviceIndex < XdmaMaxDevices; deviceIndex++)
     {
         m_pPresentQueues[deviceIndex] = nullptr;
     }
+
+    // Every job starts out idle, stacked in index order.
+    for (uint32 idx = 0; idx < JobPoolSize; ++idx)
+    {
+        m_idleJobNext[idx].store((idx + 1 < JobPoolSize) ? (idx + 1) : InvalidJobIndex, std::memory_order_relaxed);
+    }
 }
 
 // =====================================================================================================================
@@ -137,20 +104,6 @@ PresentScheduler::~PresentScheduler()
             m_pPresentQueues[deviceIndex] = nullptr;
         }
     }
-
-    for (auto iter = m_idleJobList.Begin(); iter.IsValid(); )
-    {
-        PresentSchedulerJob*const pJob = iter.Get();
-        m_idleJobList.Erase(&iter);
-        pJob->DestroyInternal(m_pDevice);
-    }
-
-    for (auto iter = m_activeJobList.Begin(); iter.IsValid(); )
-    {
-        PresentSchedulerJob*const pJob = iter.Get();
-        m_activeJobList.Erase(&iter);
-        pJob->DestroyInternal(m_pDevice);
-    }
 }
 
 // =====================================================================================================================
@@ -158,11 +111,12 @@ Result PresentScheduler::Init(
     IDevice*const pSlaveDevices[],
     void*         pPlacementAddr)
 {
-    Result result = m_idleJobMutex.Init();
+    Result result = m_idleJobSemaphore.Init(JobPoolSize, JobPoolSize);
 
     if (result == Result::Success)
     {
-        result = m_activeJobMutex.Init();
+        // Every job in the active queue comes from the pool, so pushes can never find the queue full.
+        result = m_activeJobQueue.Init(JobPoolSize);
     }
 
     if (result == Result::Success)
@@ -310,6 +264,11 @@ Result PresentScheduler::Present(
             }
         }
 
+        if ((result != Result::Success) && (pJob != nullptr))
+        {
+            ReturnIdleJob(pJob);
+        }
+
         if (result != Result::Success)
         {
             // If we failed to queue the job we must clean up some state to prevent the swap chain from deadlocking.
@@ -359,24 +318,59 @@ Result PresentScheduler::WaitIdle()
 }
 
 // =====================================================================================================================
-// A thread-safe helper function to reuse an idle PresentSchedulerJob or create a new one.
+// A thread-safe helper function to take a job from the idle pool. This only blocks if every job is in use.
 Result PresentScheduler::GetIdleJob(
     PresentSchedulerJob** ppJob)
 {
-    Result    result = Result::Success;
-    MutexAuto lock(&m_idleJobMutex);
+    // Acquiring the semaphore reserves one of the jobs in the idle stack for us, so the stack can't be empty below.
+    const Result result = m_idleJobSemaphore.Wait(UINT32_MAX);
 
-    if (m_idleJobList.IsEmpty())
+    if (result == Result::Success)
     {
-        result = PresentSchedulerJob::CreateInternal(m_pDevice, ppJob);
+        uint64 top = m_idleJobTop.load(std::memory_order_acquire);
+        uint32 idx = InvalidJobIndex;
+
+        while (true)
+        {
+            idx = static_cast<uint32>(top);
+            PAL_ASSERT(idx < JobPoolSize);
+
+            // The counter makes the swap fail if another thread popped and pushed this job back since we read top, in
+            // which case the next index we read may be stale.
+            const uint64 next = (((top >> 32) + 1) << 32) | m_idleJobNext[idx].load(std::memory_order_relaxed);
+
+            if (m_idleJobTop.compare_exchange_weak(top, next, std::memory_order_acquire, std::memory_order_acquire))
+            {
+                break;
+            }
+        }
+
+        *ppJob = &m_jobPool[idx];
     }
-    else
+
+    return result;
+}
+
+// =====================================================================================================================
+// A thread-safe helper function to put a job back into the idle pool.
+void PresentScheduler::ReturnIdleJob(
+    PresentSchedulerJob* pJob)
+{
+    const uint32 idx = static_cast<uint32>(pJob - &m_jobPool[0]);
+    PAL_ASSERT(idx < JobPoolSize);
+
+    uint64 top  = m_idleJobTop.load(std::memory_order_relaxed);
+    uint64 next = 0;
+
+    do
     {
-        *ppJob = m_idleJobList.Front();
-        m_idleJobList.Erase((*ppJob)->ListNode());
+        m_idleJobNext[idx].store(static_cast<uint32>(top), std::memory_order_relaxed);
+        next = (((top >> 32) + 1) << 32) | idx;
     }
+    while (m_idleJobTop.compare_exchange_weak(top, next, std::memory_order_release, std::memory_order_relaxed) ==
+           false);
 
-    return result;
+    m_idleJobSemaphore.Post();
 }
 
 // =====================================================================================================================
@@ -384,11 +378,9 @@ Result PresentScheduler::GetIdleJob(
 void PresentScheduler::EnqueueJob(
     PresentSchedulerJob* pJob)
 {
-    m_activeJobMutex.Lock();
-    m_activeJobList.PushBack(pJob->ListNode());
-    m_activeJobMutex.Unlock();
+    const bool pushed = m_activeJobQueue.Push(pJob);
+    PAL_ASSERT(pushed);
 
-    // Post after we unlock the mutex to prevent the worker thread from blocking if it wakes up too quickly.
     m_activeJobSemaphore.Post();
 }
 
@@ -404,18 +396,19 @@ void PresentScheduler::RunWorkerThread()
 
         if (result == Result::Success)
         {
-            m_activeJobMutex.Lock();
-            PresentSchedulerJob*const pJob = m_activeJobList.Front();
-            m_activeJobList.Erase(pJob->ListNode());
+            // Each post follows a completed push, but a producer which claimed an earlier slot may still be writing it.
+            // It's only a few instructions away from publishing, so yield until it does.
+            PresentSchedulerJob* pJob = nullptr;
 
-            m_activeJobMutex.Unlock();
+            while (m_activeJobQueue.Pop(&pJob) == false)
+            {
+                YieldThread();
+            }
 
             switch (pJob->GetType())
             {
             case PresentJobType::Terminate:
-                m_idleJobMutex.Lock();
-                m_idleJobList.PushBack(pJob->ListNode());
-                m_idleJobMutex.Unlock();
+                ReturnIdleJob(pJob);
 
                 // We've been asked to kill this thread.
                 m_workerActive = false;
@@ -423,9 +416,7 @@ void PresentScheduler::RunWorkerThread()
                 break;
 
             case PresentJobType::Notify:
-                m_idleJobMutex.Lock();
-                m_idleJobList.PushBack(pJob->ListNode());
-                m_idleJobMutex.Unlock();
+                ReturnIdleJob(pJob);
 
                 m_workerThreadNotify.Post();
                 break;
@@ -436,9 +427,7 @@ void PresentScheduler::RunWorkerThread()
                     PAL_ALERT(IsErrorResult(presentResult));
                 }
 
-                m_idleJobMutex.Lock();
-                m_idleJobList.PushBack(pJob->ListNode());
-                m_idleJobMutex.Unlock();
+                ReturnIdleJob(pJob);
                 break;
 
             default:
@@ -25,8 +25,7 @@
 
 #pragma once
 
-#include "palIntrusiveList.h"
-#include "palMutex.h"
+#include "palLockFreeRingBuffer.h"
 #include "palQueue.h"
 #include "palSemaphore.h"
 #include "palThread.h"
@@ -35,6 +34,7 @@ namespace Pal
 {
 
 class Device;
+class Platform;
 class SwapChain;
 
 // Tells the worker thread how to interpret a job.
@@ -46,18 +46,15 @@ enum class PresentJobType : uint32
 };
 
 // =====================================================================================================================
-// A helper class to encapsulate all objects and data needed for each asynchronous present scheduler job. This class
-// uses the Create/Destroy pattern but only provides "Internal" versions because the present scheduler will never have
-// the opportunity to place an instance of this class into preallocated memory.
+// A helper class to encapsulate all objects and data needed for each asynchronous present scheduler job. Jobs are
+// embedded in a fixed-size pool inside their present scheduler and recycled, so they are never created or destroyed
+// on their own.
 class PresentSchedulerJob
 {
-    typedef Util::IntrusiveListNode<PresentSchedulerJob> Node;
-
 public:
-    static Result CreateInternal(Device* pDevice, PresentSchedulerJob** ppPresentSchedulerJob);
-    void DestroyInternal(Device* pDevice);
+    PresentSchedulerJob();
+    ~PresentSchedulerJob() { }
 
-    Node* ListNode() { return &m_node; }
     void SetType(PresentJobType type) { m_type = type; }
     PresentJobType GetType() const { return m_type; }
 
@@ -68,13 +65,11 @@ public:
     IQueue* GetQueue() const { return m_pQueue; }
 
 private:
-    PresentSchedulerJob();
-    ~PresentSchedulerJob();
-
-    Node                 m_node;            // The present scheduler maintains intrusive lists of jobs.
     PresentJobType       m_type;            // How to interpret this job (e.g., execute a present).
     PresentSwapChainInfo m_presentInfo;     // All of the information for a present.
     IQueue*              m_pQueue;          // Internal queue of the same device as the original presentation queue.
+
+    PAL_DISALLOW_COPY_AND_ASSIGN(PresentSchedulerJob);
 };
 
 // =====================================================================================================================
@@ -84,8 +79,6 @@ private:
 // swap chain present modes require CPU-side synchronization so an internal thread may be used to hide the stalls.
 class PresentScheduler
 {
-    typedef Util::IntrusiveList<PresentSchedulerJob> JobList;
-
 public:
     // Present schedulers use the Create/Destroy pattern. The Create functions are in the OS-specific classes.
     void Destroy() { this->~PresentScheduler(); }
@@ -125,16 +118,30 @@ protected:
 
 private:
     Result GetIdleJob(PresentSchedulerJob** ppJob);
+    void ReturnIdleJob(PresentSchedulerJob* pJob);
     void EnqueueJob(PresentSchedulerJob* pJob);
 
+    // A present job can only be outstanding while its swap chain image is, but the worker thread recycles each job
+    // slightly after it lets the swap chain reuse the image. Twice MaxSwapChainLength leaves plenty of room for that
+    // and for the Notify and Terminate jobs; GetIdleJob blocks if the pool ever does run dry.
+    static constexpr uint32 JobPoolSize     = 32;
+    static constexpr uint32 InvalidJobIndex = UINT32_MAX;
+
     // All of this state is used to store and process asynchronous presentation requests. If all presents can be inlined
-    // none of it will be used and the worker thread will never be started.
+    // none of it will be used and the worker thread will never be started. No locks are taken to pass jobs around: the
+    // idle jobs form a lock-free stack and the active jobs flow through a lock-free ring buffer. The semaphores only
+    // enter the kernel when a thread actually has to sleep.
+
+    PresentSchedulerJob m_jobPool[JobPoolSize];
+    std::atomic<uint32> m_idleJobNext[JobPoolSize]; // For each idle job, the index of the idle job below it.
+    std::atomic<uint64> m_idleJobTop;               // The top idle job's index in the low 32 bits and a counter in
+                                                    // the high 32 bits which is bumped by every change to prevent ABA.
+    Util::Semaphore     m_idleJobSemaphore;         // Counts the jobs in the idle stack.
+
+    Util::MpscRingBuffer<PresentSchedulerJob*, Platform> m_activeJobQueue; // Passes jobs from application threads to
+                                                                           // the worker thread.
 
-    JobList         m_idleJobList;        // Idle job objects which are waiting to be reused.
-    Util::Mutex     m_idleJobMutex;       // Protects access to m_idleJobList.
-    JobList         m_activeJobList;      // Passes jobs from application threads to the worker thread.
-    Util::Mutex     m_activeJobMutex;     // Protects access to m_activeJobList.
-    Util::Semaphore m_activeJobSemaphore; // Signaled when a job is added to m_activeJobList.
+    Util::Semaphore m_activeJobSemaphore; // Signaled when a job is added to m_activeJobQueue.
     Util::Semaphore m_workerThreadNotify; // Signaled when the worker thread completes a Notify job.
     Util::Thread    m_workerThread;       // The driver thread that executes presents later on.
     volatile bool   m_workerActive;       // If the driver thread has been created.
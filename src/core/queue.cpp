@@ -312,8 +312,24 @@ Result Queue::SubmitInternal(
 {
     Result result = Result::Success;
 
+#if PAL_DEVELOPER_CPU_EVENTS
+    Developer::QueueSubmitCpuData cpuData = {};
+    cpuData.pQueue         = this;
+    cpuData.cmdBufferCount = submitInfo.cmdBufferCount;
+    cpuData.gpuMemRefCount = submitInfo.gpuMemRefCount;
+    cpuData.cpuTimestamp   = GetPerfCpuTime();
+
+    m_pDevice->DeveloperCb(Developer::CallbackType::QueueSubmitBegin, &cpuData);
+#endif
+
     InternalSubmitInfo internalSubmitInfo = {};
 
+#if PAL_DEVELOPER_CPU_EVENTS
+    // The OS layer reports the resource list time straight into this submission's payload. It stays zero if the
+    // submission is batched, because it then reaches the OS after this function returns.
+    internalSubmitInfo.pResourceListCpuTime = &cpuData.updateResourceListCpuTime;
+#endif
+
     for (uint32 idx = 0; (idx < submitInfo.cmdBufferCount) && (result == Result::Success); ++idx)
     {
         // Pre-process the command buffers before submission.
@@ -375,6 +391,12 @@ Result Queue::SubmitInternal(
         m_pQueueContext->PostProcessSubmit();
     }
 
+#if PAL_DEVELOPER_CPU_EVENTS
+    cpuData.cpuTimestamp = GetPerfCpuTime();
+
+    m_pDevice->DeveloperCb(Developer::CallbackType::QueueSubmitEnd, &cpuData);
+#endif
+
     return result;
 }
 
@@ -1189,6 +1211,11 @@ Result Queue::EnqueueSubmit(
         cmdData.submit.internalSubmitInfo = internalSubmitInfo;
         cmdData.submit.pDynamicMem        = nullptr;
 
+#if PAL_DEVELOPER_CPU_EVENTS
+        // The submitting call's payload is gone by the time this batched submission reaches the OS.
+        cmdData.submit.internalSubmitInfo.pResourceListCpuTime = nullptr;
+#endif
+
         // The submitInfo structure we are batching-up needs to have its own copies of the command buffer and memory
         // reference lists, because there's no guarantee those user arrays will remain valid once we become unstalled.
         const bool   hasCmdBufInfo       = ((submitInfo.pCmdBufInfoList != nullptr) && (submitInfo.cmdBufferCount > 0));
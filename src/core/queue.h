@@ -73,6 +73,11 @@ struct InternalSubmitInfo
     uint64*                 pWaitPoints;          // timeline semaphore wait points array.
     IQueueSemaphore**       ppSignalSemaphores;   // Array of semaphores that have to signal after the submission.
     IQueueSemaphore**       ppWaitSemaphores;     // Array of semaphores that have to wait after the submission.
+
+#if PAL_DEVELOPER_CPU_EVENTS
+    int64*                  pResourceListCpuTime; // If non-null, OsSubmit writes the CPU time it spent building the
+                                                  // resource list here.
+#endif
 };
 
 // Enumerates the types of Queue commands which could be batched-up if the Queue is stalled on a Semaphore.
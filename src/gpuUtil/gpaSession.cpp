@@ -2488,19 +2488,25 @@ Result GpaSession::AddCodeObjectLoadEvent(
 
     const auto& info = pPipeline->GetInfo();
 
+    // A pipeline reports its code allocation first, optionally followed by a private register/performance data
+    // allocation.
+    constexpr size_t MaxPipelineAllocations = 2;
+
     size_t numGpuAllocations = 0;
-    GpuMemSubAllocInfo gpuSubAlloc = { };
+    GpuMemSubAllocInfo gpuSubAllocs[MaxPipelineAllocations] = { };
 
     Result result = pPipeline->QueryAllocationInfo(&numGpuAllocations, nullptr);
 
     if (result == Result::Success)
     {
-        PAL_ASSERT(numGpuAllocations == 1);
-        result = pPipeline->QueryAllocationInfo(&numGpuAllocations, &gpuSubAlloc);
+        PAL_ASSERT((numGpuAllocations >= 1) && (numGpuAllocations <= MaxPipelineAllocations));
+        result = pPipeline->QueryAllocationInfo(&numGpuAllocations, &gpuSubAllocs[0]);
     }
 
     if (result == Result::Success)
     {
+        const GpuMemSubAllocInfo& gpuSubAlloc = gpuSubAllocs[0];
+
         CodeObjectLoadEventRecord record = { };
         record.eventType      = eventType;
         record.baseAddress    = (gpuSubAlloc.pGpuMemory->Desc().gpuVirtAddr + gpuSubAlloc.offset);
@@ -29,6 +29,11 @@ using namespace Pal;
 
 namespace GpuUtil
 {
+
+// Number of bytes of the SPM ring that GetSpmTraceResults() transposes at a time. Sized so that a block of samples stays
+// resident in the L2 cache while all of its counters are extracted.
+constexpr uint32 SpmTransposeBlockBytes = 64 * 1024;
+
 // =====================================================================================================================
 // Sets this sample's results gpu mem. This is the ultimate destination of the perf experiment results.
 void GpaSession::PerfSample::SetSampleMemoryProperties(
@@ -356,7 +361,6 @@ Result GpaSession::TraceSample::GetSpmTraceResults(
     Result result = Result::Success;
 
     const size_t NumMetadataBytes         = 32;
-    const gpusize SampleSizeInQWords      = m_pSpmTraceLayout->sampleSizeInBytes / sizeof(uint64);
     const gpusize SampleSizeInWords       = m_pSpmTraceLayout->sampleSizeInBytes / sizeof(uint16);
     const size_t TimestampDataSizeInBytes = m_numSpmSamples * sizeof(gpusize);
     const gpusize CounterDataSizeInBytes  = m_numSpmSamples * sizeof(uint16); // Size of data written for one counter.
@@ -371,21 +375,9 @@ Result GpaSession::TraceSample::GetSpmTraceResults(
     void* pSrcBufferStart = Util::VoidPtrInc(m_pPerfExpResults,
                                              static_cast<size_t>(m_pSpmTraceLayout->offset));
 
-    // Extract timestamps from m_perfExpResults
-    uint32 numSpmDwords = static_cast<uint32*>(pSrcBufferStart)[0];
-
     // Move to the actual start of the Spm data. The first dword is the wptr. There are 32 bytes of
     // reserved fields after which the data begins.
-    void* pSrcDataStart = Util::VoidPtrInc(pSrcBufferStart, NumMetadataBytes);
-    uint64* pTimestamp = static_cast<uint64*>(pSrcDataStart);
-
-    for (int32 sample = 0; sample < m_numSpmSamples; ++sample)
-    {
-        // RGP Spm output: Write the timestamps.
-        static_cast<uint64*>(pDstBuffer)[sample] = *pTimestamp;
-
-        pTimestamp += SampleSizeInQWords;
-    }
+    const void* pSrcDataStart = Util::VoidPtrInc(pSrcBufferStart, NumMetadataBytes);
 
     // Beginning of the SpmCounterInfo section.
     SpmCounterInfo* pCounterInfo =
@@ -404,30 +396,41 @@ Result GpaSession::TraceSample::GetSpmTraceResults(
         curCounterDataOffset += CounterDataSizeInBytes;
     }
 
-    // Read pointer points to the first segment of the first sample.
-    uint16* pSample = static_cast<uint16*>(pSrcDataStart);
-
-    // Index within the SPM ring buffer, which is considered an array of uint16.
-    gpusize index = 0;
-    gpusize offset = 0;
+    // The ring holds one sample after another, each with every counter at a fixed offset, while RGP wants all samples
+    // of one counter next to each other. Transposing one counter at a time walks the whole ring once per counter, which
+    // for long captures with many counters is dominated by cache misses. Instead, transpose a block of samples at a
+    // time: the block's source lines stay cached while every counter is extracted from them, and each counter receives
+    // a contiguous run of values.
+    const uint32 samplesPerBlock = Util::Max(SpmTransposeBlockBytes / m_pSpmTraceLayout->sampleSizeInBytes, 1u);
+    const uint32 numSamples      = static_cast<uint32>(m_numSpmSamples);
 
-    // Write pointer points to the beginning ofthe first counter data.
-    uint16* pDstCounterData = static_cast<uint16*>(Util::VoidPtrInc(pDstBuffer, CounterDataOffset));
+    const uint16* pSample         = static_cast<const uint16*>(pSrcDataStart);
+    uint64*       pDstTimestamps  = static_cast<uint64*>(pDstBuffer);
+    uint16*       pDstCounterData = static_cast<uint16*>(Util::VoidPtrInc(pDstBuffer, CounterDataOffset));
 
-    for (uint32 counter = 0; counter < m_numSpmCounters; counter++)
+    for (uint32 firstSample = 0; firstSample < numSamples; firstSample += samplesPerBlock)
     {
-        offset = m_pSpmTraceLayout->counterData[counter].offset;
+        const uint32  blockSamples = Util::Min(samplesPerBlock, numSamples - firstSample);
+        const uint16* pBlock       = pSample + (firstSample * SampleSizeInWords);
 
-        for (int32 sample = 0; sample < m_numSpmSamples; sample++)
+        // RGP Spm output: Write the timestamps, which are the first QWORD of every sample.
+        for (uint32 sample = 0; sample < blockSamples; ++sample)
         {
-            index = offset + (sample * SampleSizeInWords);
+            memcpy(&pDstTimestamps[firstSample + sample], pBlock + (sample * SampleSizeInWords), sizeof(uint64));
+        }
 
-            // RGP SPM OUTPUT: write the delta values of the current counter for all samples.
-            (*pDstCounterData) = pSample[index];
-            pDstCounterData++;
+        // RGP SPM OUTPUT: write the delta values of every counter for the samples in this block.
+        for (uint32 counter = 0; counter < m_numSpmCounters; counter++)
+        {
+            const uint16* pSrc = pBlock + m_pSpmTraceLayout->counterData[counter].offset;
+            uint16*       pDst = pDstCounterData + (static_cast<size_t>(counter) * numSamples) + firstSample;
 
-        } // Iterate over samples.
-    } // Iterate over counters.
+            for (uint32 sample = 0; sample < blockSamples; ++sample)
+            {
+                pDst[sample] = pSrc[sample * SampleSizeInWords];
+            }
+        }
+    }
 
     return result;
 }
@@ -23,15 +23,19 @@
  *
  **********************************************************************************************************************/
 
-#include "palDequeImpl.h"
 #include "palGpuEvent.h"
 #include "palGpuEventPool.h"
+#include "palVectorImpl.h"
 
 using namespace Pal;
+using namespace Util;
 
 namespace GpuUtil
 {
 
+// Smallest number of events created at once when the pool needs to grow.
+constexpr uint32 MinEventsPerSlab = 32;
+
 // =====================================================================================================================
 GpuEventPool::GpuEventPool(
     IPlatform* pPlatform,
@@ -39,27 +43,25 @@ GpuEventPool::GpuEventPool(
     :
     m_pPlatform(pPlatform),
     m_pDevice(pDevice),
-    m_availableEvents(m_pPlatform),
-    m_busyEvents(m_pPlatform)
+    m_events(m_pPlatform),
+    m_slabs(m_pPlatform),
+    m_numBusyEvents(0),
+    m_eventSize(0)
 {
 }
 
 // =====================================================================================================================
 GpuEventPool::~GpuEventPool()
 {
-    while (m_busyEvents.NumElements() > 0)
+    for (uint32 i = 0; i < m_events.NumElements(); i++)
     {
-        IGpuEvent* pEvent = nullptr;
-        m_busyEvents.PopFront(&pEvent);
-        pEvent->Destroy();
-        PAL_SAFE_FREE(pEvent, m_pPlatform);
+        m_events.At(i)->Destroy();
     }
-    while (m_availableEvents.NumElements() > 0)
+
+    // The events were placement-created in the slabs, so only the slabs themselves need to be freed.
+    for (uint32 i = 0; i < m_slabs.NumElements(); i++)
     {
-        IGpuEvent* pEvent = nullptr;
-        m_availableEvents.PopFront(&pEvent);
-        pEvent->Destroy();
-        PAL_SAFE_FREE(pEvent, m_pPlatform);
+        PAL_FREE(m_slabs.At(i), m_pPlatform);
     }
 }
 
@@ -67,39 +69,70 @@ GpuEventPool::~GpuEventPool()
 Result GpuEventPool::Init(
     uint32 defaultCapacity)
 {
-    // Pre-allocate some gpuEvents for this pool.
-    GpuEventCreateInfo createInfo  = {};
+    const GpuEventCreateInfo createInfo = {};
 
     Result result = Result::Success;
-    const size_t eventSize = m_pDevice->GetGpuEventSize(createInfo, &result);
+    m_eventSize   = Pow2Align(m_pDevice->GetGpuEventSize(createInfo, &result), sizeof(uint64));
+
+    // Pre-allocate a single slab holding the default number of events.
+    if ((result == Result::Success) && (defaultCapacity > 0))
+    {
+        result = CreateSlab(defaultCapacity);
+    }
+
+    PAL_ASSERT((result != Result::Success) || (m_events.NumElements() == defaultCapacity));
+
+    return result;
+}
+
+// =====================================================================================================================
+// Allocates one block of CPU memory large enough for numEvents GpuEvent objects and creates the events inside of it.
+// The new events are appended to the available portion of the event list.
+Result GpuEventPool::CreateSlab(
+    uint32 numEvents)
+{
+    PAL_ASSERT(m_eventSize > 0);
+
+    Result result = m_events.Reserve(m_events.NumElements() + numEvents);
+
+    if (result == Result::Success)
+    {
+        result = m_slabs.Reserve(m_slabs.NumElements() + 1);
+    }
+
+    void* pSlab = nullptr;
 
     if (result == Result::Success)
     {
-        for (uint32 i = 0; i < defaultCapacity; i++)
+        pSlab = PAL_MALLOC(m_eventSize * numEvents, m_pPlatform, SystemAllocType::AllocObject);
+
+        if (pSlab == nullptr)
         {
             result = Result::ErrorOutOfMemory;
-            void* pMemory = PAL_MALLOC(eventSize,
-                                       m_pPlatform,
-                                       Util::SystemAllocType::AllocObject);
+        }
+    }
 
+    if (result == Result::Success)
+    {
+        // Neither PushBack can fail because the space was reserved above.
+        m_slabs.PushBack(pSlab);
+
+        const GpuEventCreateInfo createInfo = {};
+
+        for (uint32 i = 0; (result == Result::Success) && (i < numEvents); i++)
+        {
             IGpuEvent* pEvent = nullptr;
-            if (pMemory != nullptr)
+            result = m_pDevice->CreateGpuEvent(createInfo, VoidPtrInc(pSlab, m_eventSize * i), &pEvent);
+
+            if (result == Result::Success)
             {
-                result = m_pDevice->CreateGpuEvent(createInfo, pMemory, &pEvent);
-
-                if (result == Result::Success)
-                {
-                    result = m_availableEvents.PushBack(pEvent);
-                }
-                else
-                {
-                    PAL_SAFE_FREE(pMemory, m_pPlatform);
-                }
+                m_events.PushBack(pEvent);
             }
         }
-    }
 
-    PAL_ASSERT(m_availableEvents.NumElements() == defaultCapacity);
+        // If event creation failed part way through, the events that were created stay in the pool and the slab is
+        // kept alive until the pool is destroyed.
+    }
 
     return result;
 }
@@ -107,17 +140,9 @@ Result GpuEventPool::Init(
 // =====================================================================================================================
 Result GpuEventPool::Reset()
 {
-    Result result = Result::Success;
+    m_numBusyEvents = 0;
 
-    while (m_busyEvents.NumElements() > 0)
-    {
-        IGpuEvent* pEvent = nullptr;
-        m_busyEvents.PopFront(&pEvent);
-        m_availableEvents.PushBack(pEvent);
-    }
-
-    PAL_ASSERT(m_busyEvents.NumElements() == 0);
-    return result;
+    return Result::Success;
 }
 
 // =====================================================================================================================
@@ -126,39 +151,26 @@ Result GpuEventPool::AcquireEvent(
 {
     Result result = Result::Success;
 
-    if (m_availableEvents.NumElements() > 0)
+    if (m_numBusyEvents == m_events.NumElements())
     {
-        result = m_availableEvents.PopFront(ppEvent);
-    }
-    else
-    {
-        // Create gpuEvent for this pool.
-        GpuEventCreateInfo createInfo  = {};
-
-        const size_t eventSize = m_pDevice->GetGpuEventSize(createInfo, &result);
+        if (m_eventSize == 0)
+        {
+            // The pool was never initialized, so we still need to query the event size.
+            result = Init(0);
+        }
 
+        // Grow the pool geometrically so that the number of slabs stays logarithmic in the number of events.
         if (result == Result::Success)
         {
-            result = Result::ErrorOutOfMemory;
-            void* pMemory = PAL_MALLOC(eventSize,
-                                       m_pPlatform,
-                                       Util::SystemAllocType::AllocObject);
-
-            if (pMemory != nullptr)
-            {
-                result = m_pDevice->CreateGpuEvent(createInfo, pMemory, ppEvent);
-
-                if (result != Result::Success)
-                {
-                    PAL_SAFE_FREE(pMemory, m_pPlatform);
-                }
-            }
+            result = CreateSlab(Max(MinEventsPerSlab, m_events.NumElements()));
         }
     }
 
-    if (result == Result::Success)
+    // A partially created slab may still have produced some usable events.
+    if (m_numBusyEvents < m_events.NumElements())
     {
-        result = m_busyEvents.PushBack(*ppEvent);
+        (*ppEvent) = m_events.At(m_numBusyEvents++);
+        result     = Result::Success;
     }
 
     return result;
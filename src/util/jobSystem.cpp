@@ -0,0 +1,710 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2014-2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#include "palDequeImpl.h"
+#include "palJobSystem.h"
+#include "palSysUtil.h"
+#include "palVectorImpl.h"
+
+namespace Util
+{
+
+// Number of jobs each worker can queue locally if the client doesn't specify a size.
+constexpr uint32 DefaultJobQueueSize = 1024;
+
+// Number of times an idle worker yields before it goes to sleep.
+constexpr uint32 MaxIdleSpins = 64;
+
+// Assumed size of a CPU cache line, used to keep the two ends of a worker's deque from sharing a line.
+constexpr size_t CacheLineSize = 64;
+
+// =====================================================================================================================
+// A worker and its Chase-Lev deque. The owner pushes and pops at the bottom; other threads steal from the top. The
+// deque has a fixed capacity: when it is full, jobs spill into the JobSystem's shared queue.
+struct JobSystem::Worker
+{
+    JobSystem*          pJobSystem;
+    uint32              index;
+    uint32              ccx;           // Core complex this worker prefers to steal from.
+    uint64              affinityMask;  // Logical processors this worker's thread is pinned to, or zero.
+    Thread              thread;
+    Job*                pJobs;         // Circular buffer of (mask + 1) jobs.
+    int64               mask;
+
+    uint8               padding0[CacheLineSize];
+    std::atomic<int64>  top;           // Index of the oldest job. Advanced by thieves and by the owner's last pop.
+    uint8               padding1[CacheLineSize];
+    std::atomic<int64>  bottom;        // Index one past the newest job. Written only by the owner.
+    uint8               padding2[CacheLineSize];
+
+    // Pushes a job onto the bottom of the deque. Must be called from the owning thread. Returns false if full.
+    bool Push(
+        const Job& job)
+    {
+        const int64 b = bottom.load(std::memory_order_relaxed);
+        const int64 t = top.load(std::memory_order_acquire);
+
+        bool pushed = false;
+
+        if ((b - t) <= mask)
+        {
+            pJobs[b & mask] = job;
+            bottom.store(b + 1, std::memory_order_release);
+            pushed = true;
+        }
+
+        return pushed;
+    }
+
+    // Pops the newest job from the bottom of the deque. Must be called from the owning thread.
+    bool Pop(
+        Job* pJob)
+    {
+        const int64 b = bottom.load(std::memory_order_relaxed) - 1;
+        bottom.store(b, std::memory_order_relaxed);
+
+        // The store to bottom must be visible to thieves before top is read, otherwise both could take the last job.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        int64 t      = top.load(std::memory_order_relaxed);
+        bool  popped = false;
+
+        if (t <= b)
+        {
+            (*pJob) = pJobs[b & mask];
+            popped  = true;
+
+            if (t == b)
+            {
+                // This is the last job, so race the thieves for it.
+                popped = top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+                bottom.store(b + 1, std::memory_order_relaxed);
+            }
+        }
+        else
+        {
+            // The deque was empty.
+            bottom.store(b + 1, std::memory_order_relaxed);
+        }
+
+        return popped;
+    }
+
+    // Steals the oldest job from the top of the deque. May be called from any thread.
+    bool Steal(
+        Job* pJob)
+    {
+        int64 t = top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64 b = bottom.load(std::memory_order_acquire);
+
+        bool stolen = false;
+
+        if (t < b)
+        {
+            // The owner never overwrites the slot at top while it is unclaimed, because Push() keeps fewer than
+            // (mask + 1) jobs in flight.
+            const Job job = pJobs[t & mask];
+
+            if (top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            {
+                (*pJob) = job;
+                stolen  = true;
+            }
+        }
+
+        return stolen;
+    }
+
+    bool IsEmpty() const
+    {
+        return (bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed));
+    }
+};
+
+// =====================================================================================================================
+JobSystem::~JobSystem()
+{
+    Shutdown();
+
+    if (m_pWorkers != nullptr)
+    {
+        // All of the workers' job buffers were carved out of the first worker's allocation.
+        PAL_SAFE_FREE(m_pWorkers[0].pJobs, &m_allocator);
+        PAL_SAFE_DELETE_ARRAY(m_pWorkers, &m_allocator);
+    }
+
+    if (m_workerKeyValid)
+    {
+        DeleteThreadLocalKey(m_workerKey);
+    }
+}
+
+// =====================================================================================================================
+Result JobSystem::Init(
+    const JobSystemCreateInfo& createInfo)
+{
+    PAL_ASSERT(m_pWorkers == nullptr);
+
+    SystemInfo systemInfo = { };
+    const bool hasSystemInfo = (QuerySystemInfo(&systemInfo) == Result::Success);
+
+    m_clientThreads = (createInfo.flags.clientThreads != 0);
+    m_numWorkers    = createInfo.numWorkers;
+
+    if (m_numWorkers == 0)
+    {
+        // Leave one logical core for the thread which submits the jobs.
+        m_numWorkers = hasSystemInfo ? (Max(systemInfo.cpuLogicalCoreCount, 2u) - 1) : 1;
+    }
+
+    const uint32 jobQueueSize = Pow2Pad((createInfo.jobQueueSize != 0) ? createInfo.jobQueueSize : DefaultJobQueueSize);
+
+    // Only pin our own threads: the client is in charge of the placement of client-supplied threads.
+    uint32 numCcx = 0;
+
+    if ((createInfo.flags.ccxAffinity != 0) &&
+        (m_clientThreads == false)          &&
+        hasSystemInfo                       &&
+        (systemInfo.cpuType == CpuType::AmdRyzen))
+    {
+        while ((numCcx < RyzenMaxCcxCount) && (systemInfo.cpuArchInfo.amdRyzen.affinityMask[numCcx] != 0))
+        {
+            numCcx++;
+        }
+    }
+
+    Result result = m_sharedLock.Init();
+
+    if (result == Result::Success)
+    {
+        result = m_deferredLock.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_waitCondition.Init();
+    }
+
+    if (result == Result::Success)
+    {
+        result = m_wakeup.Init(Semaphore::MaximumCountLimit, 0);
+    }
+
+    if (result == Result::Success)
+    {
+        result           = CreateThreadLocalKey(&m_workerKey);
+        m_workerKeyValid = (result == Result::Success);
+    }
+
+    Job* pJobs = nullptr;
+
+    if (result == Result::Success)
+    {
+        m_pWorkers = PAL_NEW_ARRAY(Worker, m_numWorkers, &m_allocator, AllocInternal);
+        pJobs      = static_cast<Job*>(PAL_MALLOC(sizeof(Job) * jobQueueSize * m_numWorkers,
+                                                  &m_allocator,
+                                                  AllocInternal));
+
+        if ((m_pWorkers == nullptr) || (pJobs == nullptr))
+        {
+            PAL_SAFE_FREE(pJobs, &m_allocator);
+            PAL_SAFE_DELETE_ARRAY(m_pWorkers, &m_allocator);
+            result = Result::ErrorOutOfMemory;
+        }
+    }
+
+    if (result == Result::Success)
+    {
+        for (uint32 idx = 0; idx < m_numWorkers; ++idx)
+        {
+            Worker*const pWorker = &m_pWorkers[idx];
+
+            pWorker->pJobSystem   = this;
+            pWorker->index        = idx;
+            pWorker->ccx          = (numCcx > 0) ? (idx % numCcx) : 0;
+            pWorker->affinityMask = (numCcx > 0) ? systemInfo.cpuArchInfo.amdRyzen.affinityMask[pWorker->ccx] : 0;
+            pWorker->pJobs        = pJobs + (idx * jobQueueSize);
+            pWorker->mask         = jobQueueSize - 1;
+            pWorker->top.store(0, std::memory_order_relaxed);
+            pWorker->bottom.store(0, std::memory_order_relaxed);
+        }
+
+        for (uint32 idx = 0; (m_clientThreads == false) && (idx < m_numWorkers); ++idx)
+        {
+            Worker*const pWorker = &m_pWorkers[idx];
+
+            result = pWorker->thread.Begin(&WorkerThreadFunc, pWorker);
+
+            if (result != Result::Success)
+            {
+                break;
+            }
+
+            if (pWorker->affinityMask != 0)
+            {
+                // Running unpinned is still correct, so a failure here is not fatal.
+                const Result affinityResult = pWorker->thread.SetAffinityMask(pWorker->affinityMask);
+                PAL_ALERT(affinityResult != Result::Success);
+            }
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+void JobSystem::Shutdown()
+{
+    if ((m_pWorkers != nullptr) && (m_shutdown.exchange(true) == false))
+    {
+        m_wakeup.Post(m_numWorkers);
+
+        for (uint32 idx = 0; (m_clientThreads == false) && (idx < m_numWorkers); ++idx)
+        {
+            // Join() does nothing for threads which failed to start.
+            m_pWorkers[idx].thread.Join();
+        }
+    }
+}
+
+// =====================================================================================================================
+Result JobSystem::Submit(
+    const JobInfo& info)
+{
+    Result result = Result::Success;
+
+    if (info.pfnJob == nullptr)
+    {
+        result = Result::ErrorInvalidValue;
+    }
+    else
+    {
+        const Job job = { info.pfnJob, info.pData, info.pCounter };
+
+        if (job.pCounter != nullptr)
+        {
+            job.pCounter->m_pending.fetch_add(1, std::memory_order_relaxed);
+        }
+
+        bool deferred          = false;
+        bool waitForDependency = false;
+
+        if ((info.pDependency != nullptr) && (info.pDependency->IsDone() == false))
+        {
+            // The dependency is checked again under the lock: counters only reach zero under this lock, so the thread
+            // which finishes the dependency's last job is guaranteed to see this job if we defer it.
+            MutexAuto lock(&m_deferredLock);
+
+            if (info.pDependency->IsDone() == false)
+            {
+                const DeferredJob deferredJob = { job, info.pDependency };
+
+                deferred          = (m_deferredJobs.PushBack(deferredJob) == Result::Success);
+                waitForDependency = (deferred == false);
+            }
+        }
+
+        if (waitForDependency)
+        {
+            // Out of memory: fall back to waiting for the dependency on this thread.
+            Wait(info.pDependency);
+        }
+
+        if (deferred == false)
+        {
+            Enqueue(job);
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+void JobSystem::Wait(
+    const JobCounter* pCounter)
+{
+    PAL_ASSERT(pCounter != nullptr);
+
+    Worker*const pWorker = CurrentWorker();
+
+    uint32 idleSpins = 0;
+
+    // Help out while there are queued jobs, which also guarantees progress when every worker is waiting on a counter.
+    while (pCounter->IsDone() == false)
+    {
+        if (RunOneJob(pWorker))
+        {
+            idleSpins = 0;
+        }
+        else if (++idleSpins < MaxIdleSpins)
+        {
+            YieldThread();
+        }
+        else
+        {
+            MutexAuto lock(&m_deferredLock);
+
+            m_numWaiters.fetch_add(1, std::memory_order_seq_cst);
+
+            // Counters only reach zero under this lock, and WakeWorkers() takes it before waking us once it sees us in
+            // m_numWaiters, so neither a finished counter nor a newly queued job can be missed before we sleep.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if ((pCounter->IsDone() == false) && (HasQueuedJobs() == false))
+            {
+                m_waitCondition.Wait(&m_deferredLock, UINT32_MAX);
+            }
+
+            m_numWaiters.fetch_sub(1, std::memory_order_relaxed);
+
+            idleSpins = 0;
+        }
+    }
+}
+
+// =====================================================================================================================
+void JobSystem::RunWorker(
+    uint32 workerIndex)
+{
+    PAL_ASSERT(m_clientThreads && (workerIndex < m_numWorkers));
+
+    WorkerLoop(&m_pWorkers[workerIndex]);
+}
+
+// =====================================================================================================================
+void JobSystem::WorkerThreadFunc(
+    void* pParameter)
+{
+    Worker*const pWorker = static_cast<Worker*>(pParameter);
+
+    pWorker->pJobSystem->WorkerLoop(pWorker);
+}
+
+// =====================================================================================================================
+// Runs jobs until Shutdown() is called and no queued job is left.
+void JobSystem::WorkerLoop(
+    Worker* pWorker)
+{
+    SetThreadLocalValue(m_workerKey, pWorker);
+
+    uint32 idleSpins = 0;
+
+    while (true)
+    {
+        if (RunOneJob(pWorker))
+        {
+            idleSpins = 0;
+        }
+        else if (m_shutdown.load(std::memory_order_acquire))
+        {
+            break;
+        }
+        else if (++idleSpins < MaxIdleSpins)
+        {
+            YieldThread();
+        }
+        else
+        {
+            m_numSleeping.fetch_add(1, std::memory_order_seq_cst);
+
+            // Look for work once more now that we are counted as sleeping. A job queued before this point is seen
+            // here; a job queued after it sees us in m_numSleeping and posts m_wakeup, so no wakeup can be lost.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            if ((HasQueuedJobs() == false) && (m_shutdown.load(std::memory_order_acquire) == false))
+            {
+                m_wakeup.Wait(UINT32_MAX);
+            }
+
+            m_numSleeping.fetch_sub(1, std::memory_order_relaxed);
+
+            idleSpins = 0;
+        }
+    }
+
+    SetThreadLocalValue(m_workerKey, nullptr);
+}
+
+// =====================================================================================================================
+// Finds and runs one queued job. Returns false if no job was found.
+bool JobSystem::RunOneJob(
+    Worker* pWorker)
+{
+    Job        job   = { };
+    const bool found = FindJob(pWorker, &job);
+
+    if (found)
+    {
+        Execute(job);
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Looks for a job in the calling worker's own deque, then in the shared queue, and finally in other workers' deques.
+// Workers on the same core complex are robbed first so that stolen jobs are more likely to find their data in a shared
+// L3 cache. The worker is null when called from a thread which isn't one of this JobSystem's workers.
+bool JobSystem::FindJob(
+    Worker* pWorker,
+    Job*    pJob)
+{
+    bool found = (pWorker != nullptr) && pWorker->Pop(pJob);
+
+    if ((found == false) && (m_numSharedJobs.load(std::memory_order_relaxed) > 0))
+    {
+        MutexAuto lock(&m_sharedLock);
+
+        if (m_sharedJobs.NumElements() > 0)
+        {
+            found = (m_sharedJobs.PopFront(pJob) == Result::Success);
+            m_numSharedJobs.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+
+    const uint32 first = (pWorker != nullptr) ? (pWorker->index + 1) : 0;
+
+    for (uint32 pass = 0; (found == false) && (pass < 2); ++pass)
+    {
+        for (uint32 i = 0; (found == false) && (i < m_numWorkers); ++i)
+        {
+            Worker*const pVictim = &m_pWorkers[(first + i) % m_numWorkers];
+
+            // The first pass only visits workers on the caller's core complex, the second pass visits the rest.
+            const bool sameCcx = (pWorker == nullptr) || (pVictim->ccx == pWorker->ccx);
+
+            if ((pVictim != pWorker) && (sameCcx == (pass == 0)) && (pVictim->IsEmpty() == false))
+            {
+                found = pVictim->Steal(pJob);
+            }
+        }
+    }
+
+    return found;
+}
+
+// =====================================================================================================================
+// Returns true if any worker's deque or the shared queue holds a job.
+bool JobSystem::HasQueuedJobs() const
+{
+    bool queued = (m_numSharedJobs.load(std::memory_order_relaxed) > 0);
+
+    for (uint32 idx = 0; (queued == false) && (idx < m_numWorkers); ++idx)
+    {
+        queued = (m_pWorkers[idx].IsEmpty() == false);
+    }
+
+    return queued;
+}
+
+// =====================================================================================================================
+// Queues a job whose dependency is satisfied, preferring the calling worker's own deque.
+void JobSystem::Enqueue(
+    const Job& job)
+{
+    Worker*const pWorker = CurrentWorker();
+
+    bool queued = (pWorker != nullptr) && pWorker->Push(job);
+
+    if (queued == false)
+    {
+        MutexAuto lock(&m_sharedLock);
+
+        queued = (m_sharedJobs.PushBack(job) == Result::Success);
+
+        if (queued)
+        {
+            m_numSharedJobs.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    if (queued)
+    {
+        WakeWorkers(1);
+    }
+    else
+    {
+        // Out of memory: run the job right away rather than dropping it.
+        Execute(job);
+    }
+}
+
+// =====================================================================================================================
+// Runs a job and, if it was the last one pending on its counter, releases the jobs which depend on that counter.
+void JobSystem::Execute(
+    const Job& job)
+{
+    job.pfnJob(job.pData);
+
+    if (job.pCounter != nullptr)
+    {
+        // Only the decrement which may finish the counter needs the lock; all of the others are done lock-free.
+        uint32 pending = job.pCounter->m_pending.load(std::memory_order_relaxed);
+
+        while ((pending > 1) &&
+               (job.pCounter->m_pending.compare_exchange_weak(pending,
+                                                              pending - 1,
+                                                              std::memory_order_acq_rel,
+                                                              std::memory_order_relaxed) == false))
+        {
+        }
+
+        if (pending <= 1)
+        {
+            FinishCounter(job.pCounter);
+        }
+    }
+}
+
+// =====================================================================================================================
+// Drops what may be the last pending job of a counter. The counter may be destroyed by a waiter as soon as it is done,
+// so it is never dereferenced after the decrement: the deferred jobs which depend on it are marked as ready in the same
+// critical section, which also keeps Submit() from deferring another job on the counter in between.
+void JobSystem::FinishCounter(
+    JobCounter* pCounter)
+{
+    bool released = false;
+
+    {
+        MutexAuto lock(&m_deferredLock);
+
+        if (pCounter->m_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            if (m_numWaiters.load(std::memory_order_relaxed) > 0)
+            {
+                m_waitCondition.WakeAll();
+            }
+
+            for (uint32 idx = 0; idx < m_deferredJobs.NumElements(); ++idx)
+            {
+                DeferredJob& deferredJob = m_deferredJobs.At(idx);
+
+                if (deferredJob.pDependency == pCounter)
+                {
+                    deferredJob.pDependency = nullptr;
+                    released                = true;
+                }
+            }
+        }
+    }
+
+    if (released)
+    {
+        ReleaseDeferredJobs();
+    }
+}
+
+// =====================================================================================================================
+// Queues every deferred job which has been marked as ready. The deferred list is compacted in a single pass under the
+// lock; the released jobs are queued outside of it because queueing may end up running a job, which may release other
+// jobs.
+void JobSystem::ReleaseDeferredJobs()
+{
+    Vector<Job, 16, IndirectAllocator> releasedJobs(&m_allocator);
+
+    bool retry = true;
+
+    while (retry)
+    {
+        retry = false;
+
+        {
+            MutexAuto lock(&m_deferredLock);
+
+            const uint32 numDeferred = m_deferredJobs.NumElements();
+            uint32       numKept     = 0;
+
+            for (uint32 idx = 0; idx < numDeferred; ++idx)
+            {
+                const DeferredJob& deferredJob = m_deferredJobs.At(idx);
+
+                bool released = false;
+
+                if (deferredJob.pDependency == nullptr)
+                {
+                    // Out of memory: keep the job deferred and pick it up on another pass.
+                    released = (releasedJobs.PushBack(deferredJob.job) == Result::Success);
+                    retry    = (released == false);
+                }
+
+                if (released == false)
+                {
+                    if (numKept != idx)
+                    {
+                        m_deferredJobs.At(numKept) = deferredJob;
+                    }
+
+                    numKept++;
+                }
+            }
+
+            for (uint32 idx = numKept; idx < numDeferred; ++idx)
+            {
+                DeferredJob unused = { };
+                m_deferredJobs.PopBack(&unused);
+            }
+        }
+
+        for (uint32 idx = 0; idx < releasedJobs.NumElements(); ++idx)
+        {
+            Enqueue(releasedJobs.At(idx));
+        }
+
+        releasedJobs.Clear();
+    }
+}
+
+// =====================================================================================================================
+// Wakes sleeping workers, and any threads blocked in Wait(), after a job has been queued.
+void JobSystem::WakeWorkers(
+    uint32 count)
+{
+    // The job was published with a release store, which may be reordered after the loads below. This fence pairs with
+    // the ones in WorkerLoop() and Wait(): either the sleeper sees the new job, or we see the sleeper.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    const uint32 numSleeping = m_numSleeping.load(std::memory_order_relaxed);
+
+    if (numSleeping > 0)
+    {
+        m_wakeup.Post(Min(count, numSleeping));
+    }
+
+    if (m_numWaiters.load(std::memory_order_relaxed) > 0)
+    {
+        MutexAuto lock(&m_deferredLock);
+        m_waitCondition.WakeAll();
+    }
+}
+
+// =====================================================================================================================
+// Returns the Worker which runs on the calling thread, or null if the calling thread isn't one of our workers.
+JobSystem::Worker* JobSystem::CurrentWorker() const
+{
+    return m_workerKeyValid ? static_cast<Worker*>(GetThreadLocalValue(m_workerKey)) : nullptr;
+}
+
+} // Util
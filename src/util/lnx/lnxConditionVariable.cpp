@@ -26,38 +26,33 @@
 #include "palConditionVariable.h"
 #include "palMutex.h"
 #include "palSysMemory.h"
-#include "util/lnx/lnxTimeout.h"
+#include "util/lnx/lnxFutex.h"
 #include <errno.h>
+#include <limits.h>
 
 namespace Util
 {
 
 // =====================================================================================================================
-// Frees the pthreads condition variable this object encapsulates.
+// The condition variable owns no OS objects.
 ConditionVariable::~ConditionVariable()
 {
-    pthread_cond_destroy(&m_osCondVariable);
 }
 
 // =====================================================================================================================
-// Initializes the pthreads condition variable this object encapsulates.  Returns ErrorUnknown if the pthread
-// initialization call fails.
+// A futex needs no initialization beyond the constructor.  This is kept for interface compatibility.
 Result ConditionVariable::Init()
 {
-    Result result = Result::ErrorUnknown;
-
-    if (pthread_cond_init(&m_osCondVariable, nullptr) == 0)
-    {
-        result = Result::Success;
-    }
-
-    return result;
+    return Result::Success;
 }
 
 // =====================================================================================================================
 // Atomically releases the given mutex object and goes to sleep on the condition variable.  Once we awake from this
 // sleep, reacquire the critical section.  Returns false if the specified number of milliseconds elapse before it is
 // awoken.
+//
+// The wake sequence is sampled while the mutex is still held, so a wake issued after the caller's predicate changes
+// either changes the futex word before we sleep or wakes us.  Like pthread_cond_wait(), this may wake spuriously.
 bool ConditionVariable::Wait(
     Mutex* pMutex,
     uint32 milliseconds)  // Can be set to 0xFFFFFFFF to wait forever.
@@ -66,29 +61,22 @@ bool ConditionVariable::Wait(
 
     if (pMutex != nullptr)
     {
-        Mutex::MutexData*const pOsMutex  = pMutex->GetMutexData();
-        pthread_cond_t*const   pOsCndVar = &m_osCondVariable;
+        const uint32 sequence = __atomic_load_n(&m_sequence, __ATOMIC_RELAXED);
 
         constexpr uint32 Infinite = 0xFFFFFFFF;
-        if (milliseconds == Infinite)
-        {
-            // Wait on the condition variable indefinitely.
-            const int32 ret = pthread_cond_wait(pOsCndVar, pOsMutex);
-            PAL_ASSERT(ret == 0);
+        timespec         timeout  = {};
+        timeout.tv_sec  = milliseconds / 1000;
+        timeout.tv_nsec = (milliseconds % 1000) * 1000 * 1000;
+
+        pMutex->Unlock();
 
-            result = true;
-        }
-        else
-        {
-            timespec timeout = {};
-            ComputeTimeoutExpiration(&timeout, milliseconds * 1000 * 1000);
+        const int32 ret = FutexWait(&m_sequence, sequence, (milliseconds == Infinite) ? nullptr : &timeout);
+        PAL_ASSERT((ret == 0) || (ret == EAGAIN) || (ret == EINTR) || (ret == ETIMEDOUT));
 
-            // Wait on the condition variable until a timeout occurs.
-            const int32 ret = pthread_cond_timedwait(pOsCndVar, pOsMutex, &timeout);
-            PAL_ASSERT((ret == 0) || (ret == ETIMEDOUT));
+        result = (ret != ETIMEDOUT);
 
-            result = (ret == 0);
-        }
+        // Other threads may have been woken along with us, so the mutex must be taken as contended.
+        pMutex->LockContended();
     }
 
     return result;
@@ -98,16 +86,16 @@ bool ConditionVariable::Wait(
 // Wakes up one thread that is waiting on this condition variable.
 void ConditionVariable::WakeOne()
 {
-    const int32 ret = pthread_cond_signal(&m_osCondVariable);
-    PAL_ASSERT(ret == 0);
+    __atomic_add_fetch(&m_sequence, 1, __ATOMIC_SEQ_CST);
+    FutexWake(&m_sequence, 1);
 }
 
 // =====================================================================================================================
 // Wakes up all threads that are waiting on this condition variable.
 void ConditionVariable::WakeAll()
 {
-    const int32 ret = pthread_cond_broadcast(&m_osCondVariable);
-    PAL_ASSERT(ret == 0);
+    __atomic_add_fetch(&m_sequence, 1, __ATOMIC_SEQ_CST);
+    FutexWake(&m_sequence, INT_MAX);
 }
 
 } // Util
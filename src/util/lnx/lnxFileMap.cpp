@@ -27,8 +27,10 @@
 #include "palAssert.h"
 #include "palFile.h"
 #include "core/os/lnx/lnxHeaders.h"
+#include <cerrno>
 #include <cstdio>
 #include <unistd.h>
+#include <sys/file.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -42,6 +44,7 @@ FileMapping::FileMapping()
     :
     m_fileHandle(InvalidFd),
     m_writeable(false),
+    m_pFileName(nullptr),
     m_pSystemName(nullptr)
 {
 
@@ -109,6 +112,7 @@ void FileMapping::Close()
     if (IsValid())
     {
         close(m_fileHandle);
+        m_fileHandle = InvalidFd;
     }
 }
 
@@ -120,6 +124,61 @@ bool FileMapping::Flush()
     return true;
 }
 
+// =====================================================================================================================
+// Places an advisory lock on the current file handle, retrying if the wait is interrupted by a signal.
+Result FileMapping::Lock(
+    bool exclusive)  // whether to take an exclusive lock instead of a shared one
+{
+    Result result = Result::ErrorUnknown;
+
+    if (IsValid())
+    {
+        int ret = 0;
+
+        do
+        {
+            ret = flock(m_fileHandle, (exclusive ? LOCK_EX : LOCK_SH));
+        }
+        while ((ret != 0) && (errno == EINTR));
+
+        if (ret == 0)
+        {
+            result = Result::Success;
+        }
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Releases an advisory lock on the current file handle
+void FileMapping::Unlock()
+{
+    if (IsValid())
+    {
+        flock(m_fileHandle, LOCK_UN);
+    }
+}
+
+// =====================================================================================================================
+// Compares the file behind the current file handle with the file the mapping's file name now refers to
+bool FileMapping::IsFileReplaced() const
+{
+    bool replaced = true;
+
+    struct stat mappedStat = {};
+    struct stat namedStat  = {};
+
+    if (IsValid()                                &&
+        (fstat(m_fileHandle, &mappedStat) == 0) &&
+        (stat(m_pFileName, &namedStat) == 0))
+    {
+        replaced = ((mappedStat.st_dev != namedStat.st_dev) || (mappedStat.st_ino != namedStat.st_ino));
+    }
+
+    return replaced;
+}
+
 // =====================================================================================================================
 FileView::FileView()
     :
@@ -0,0 +1,62 @@
+/*
+ ***********************************************************************************************************************
+ *
+ *  Copyright (c) 2014-2019 Advanced Micro Devices, Inc. All Rights Reserved.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in all
+ *  copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ *  SOFTWARE.
+ *
+ **********************************************************************************************************************/
+
+#pragma once
+
+#include "palUtil.h"
+
+#include <errno.h>
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace Util
+{
+
+// =====================================================================================================================
+// Sleeps until *pWord is woken by FutexWake(), unless *pWord no longer equals expected when the kernel checks it.  A
+// null pTimeout waits forever, otherwise it is a relative timeout.  Returns zero if woken, or EAGAIN, ETIMEDOUT or
+// EINTR.  Spurious wakeups are possible, so callers must re-check the condition they are waiting on.
+inline int32 FutexWait(
+    volatile uint32* pWord,
+    uint32           expected,
+    const timespec*  pTimeout)
+{
+    const long ret = syscall(SYS_futex, pWord, FUTEX_WAIT_PRIVATE, expected, pTimeout, nullptr, 0);
+
+    return (ret == 0) ? 0 : errno;
+}
+
+// =====================================================================================================================
+// Wakes up to count threads sleeping in FutexWait() on pWord.
+inline void FutexWake(
+    volatile uint32* pWord,
+    int32            count)
+{
+    syscall(SYS_futex, pWord, FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+}
+
+} // Util
@@ -24,31 +24,151 @@
  **********************************************************************************************************************/
 
 #include "palMutex.h"
+#include "palInlineFuncs.h"
 #include "palSysMemory.h"
+#include "util/lnx/lnxFutex.h"
 #include <errno.h>
+#include <limits.h>
 #include <sched.h>
+#include <unistd.h>
+
+#if PAL_LOCK_CONTENTION_STATS
+#include "palDbgPrint.h"
+#include "palSysUtil.h"
+#include <dlfcn.h>
+#endif
 
 namespace Util
 {
 
+// Mutex lock word states.
+constexpr uint32 MutexUnlocked  = 0; // Nobody owns the mutex.
+constexpr uint32 MutexLocked    = 1; // Owned, and nobody is asleep waiting for it.
+constexpr uint32 MutexContended = 2; // Owned, and other threads may be asleep waiting for it.
+
+// RWLock state values.  Any other value is the number of readers holding the lock.
+constexpr uint32 RWLockFree         = 0;
+constexpr uint32 RWLockWriterLocked = 0x80000000;
+
+// Upper bound on the number of times a contended lock request polls the lock before going to sleep.  Most of PAL's
+// locks are held for a few hundred cycles at most, so a short spin avoids the two syscalls of a sleep and a wake.
+constexpr int32 MaxLockSpinCount = 100;
+
+#if PAL_LOCK_CONTENTION_STATS
+// Contention statistics are kept in a fixed-size, open-addressed table keyed by lock call site.  Samples from sites
+// which don't fit in the table are dropped.
+struct LockSiteEntry
+{
+    volatile uint64 site;
+    volatile uint64 contentions;
+    volatile uint64 sleeps;
+    volatile uint64 waitTicks;
+};
+
+constexpr uint32 LockSiteTableSize = 1024;
+constexpr uint32 LockReportSites   = 16;
+
+static LockSiteEntry   g_lockSites[LockSiteTableSize] = {};
+static volatile uint64 g_droppedLockSamples           = 0;
+
 // =====================================================================================================================
-// Frees the pthreads mutex this object encapsulates.
-Mutex::~Mutex()
+// Accumulates one contended lock acquisition into the call site table.
+static void RecordLockContention(
+    const void* pSite,
+    int64       startTicks,
+    bool        slept)
 {
-    if (m_initialized)
+    const uint64 site = reinterpret_cast<uint64>(pSite);
+    uint32       slot = static_cast<uint32>((site * 0x9E3779B97F4A7C15ull) >> 32) % LockSiteTableSize;
+
+    LockSiteEntry* pEntry = nullptr;
+    for (uint32 probe = 0; (probe < LockSiteTableSize) && (pEntry == nullptr); ++probe)
+    {
+        LockSiteEntry*const pSlot = &g_lockSites[slot];
+        const uint64        owner = AtomicCompareAndSwap64(&pSlot->site, 0, site);
+
+        if ((owner == 0) || (owner == site))
+        {
+            pEntry = pSlot;
+        }
+
+        slot = (slot + 1) % LockSiteTableSize;
+    }
+
+    if (pEntry != nullptr)
     {
-        const int ret = pthread_mutex_destroy(&m_osMutex);
-        PAL_ASSERT(ret == 0);
+        AtomicAdd64(&pEntry->contentions, 1);
+        AtomicAdd64(&pEntry->sleeps, slept ? 1 : 0);
+        AtomicAdd64(&pEntry->waitTicks, static_cast<uint64>(GetPerfCpuTime() - startTicks));
+    }
+    else
+    {
+        AtomicAdd64(&g_droppedLockSamples, 1);
     }
 }
+#endif
 
 // =====================================================================================================================
-// Initializes the pthreads mutex this object encapsulates.
-Result Mutex::Init()
+// Tells the CPU we're in a spin-wait loop so that it can yield resources to a sibling hyperthread.
+static void CpuRelax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#endif
+}
+
+// =====================================================================================================================
+// Spinning only helps if the lock owner can run while we spin.
+static bool CanSpin()
 {
-    m_initialized = m_initialized || (pthread_mutex_init(&m_osMutex, nullptr) == 0);
+    static const bool canSpin = (sysconf(_SC_NPROCESSORS_ONLN) > 1);
+
+    return canSpin;
+}
+
+// =====================================================================================================================
+// Polls tryAcquire() for a bounded number of iterations, returning true if it succeeded.  The bound adapts to how long
+// past contended acquisitions of this lock had to spin, in the same way as glibc's adaptive mutexes: a lock which is
+// normally released quickly gets up to MaxLockSpinCount polls, while one which never is quickly stops spinning.
+template <typename TryAcquireFunc>
+static bool AdaptiveSpin(
+    volatile uint32* pSpinEstimate,
+    TryAcquireFunc   tryAcquire)
+{
+    bool acquired = false;
+
+    if (CanSpin())
+    {
+        const int32 estimate = static_cast<int32>(__atomic_load_n(pSpinEstimate, __ATOMIC_RELAXED));
+        const int32 maxSpins = Min(MaxLockSpinCount, (estimate * 2) + 10);
+
+        int32 spins = 0;
+        while ((acquired == false) && (spins < maxSpins))
+        {
+            ++spins;
+            CpuRelax();
+            acquired = tryAcquire();
+        }
+
+        // Racing updates of the estimate are harmless: it is only a hint.
+        __atomic_store_n(pSpinEstimate, static_cast<uint32>(estimate + ((spins - estimate) / 8)), __ATOMIC_RELAXED);
+    }
 
-    return m_initialized ? Result::Success : Result::ErrorUnknown;
+    return acquired;
+}
+
+// =====================================================================================================================
+// The mutex owns no OS objects, but destroying a mutex which is still held is a bug.
+Mutex::~Mutex()
+{
+    PAL_ASSERT(m_lockWord == MutexUnlocked);
+}
+
+// =====================================================================================================================
+// A futex needs no initialization beyond the constructor.  This is kept for interface compatibility.
+Result Mutex::Init()
+{
+    return Result::Success;
 }
 
 // =====================================================================================================================
@@ -56,8 +176,49 @@ Result Mutex::Init()
 // acquires it.
 void Mutex::Lock()
 {
-    const int ret = pthread_mutex_lock(&m_osMutex);
-    PAL_ASSERT(ret == 0);
+    if (__sync_val_compare_and_swap(&m_lockWord, MutexUnlocked, MutexLocked) != MutexUnlocked)
+    {
+        LockSlow(__builtin_return_address(0));
+    }
+}
+
+// =====================================================================================================================
+// Contended path of Lock(): spins for a while in case the owner is about to release the mutex, then sleeps on the
+// futex.  This is the classic three-state futex mutex from Drepper's "Futexes Are Tricky".
+void Mutex::LockSlow(
+    const void* pSite)
+{
+#if PAL_LOCK_CONTENTION_STATS
+    const int64 startTicks = GetPerfCpuTime();
+#endif
+
+    const bool acquired = AdaptiveSpin(
+        &m_spinEstimate,
+        [this]() -> bool
+        {
+            return (__atomic_load_n(&m_lockWord, __ATOMIC_RELAXED) == MutexUnlocked) &&
+                   (__sync_val_compare_and_swap(&m_lockWord, MutexUnlocked, MutexLocked) == MutexUnlocked);
+        });
+
+    if (acquired == false)
+    {
+        LockContended();
+    }
+
+#if PAL_LOCK_CONTENTION_STATS
+    RecordLockContention(pSite, startTicks, (acquired == false));
+#endif
+}
+
+// =====================================================================================================================
+// Acquires the mutex, marking it as contended so that the eventual Unlock() wakes the next sleeper.  Once a thread has
+// slept it can't know whether anyone else is still asleep, so it must always take the mutex in this state.
+void Mutex::LockContended()
+{
+    while (__atomic_exchange_n(&m_lockWord, MutexContended, __ATOMIC_ACQUIRE) != MutexUnlocked)
+    {
+        FutexWait(&m_lockWord, MutexContended, nullptr);
+    }
 }
 
 // =====================================================================================================================
@@ -65,38 +226,34 @@ void Mutex::Lock()
 // Returns true if the mutex was successfully acquired.
 bool Mutex::TryLock()
 {
-    const int ret = pthread_mutex_trylock(&m_osMutex);
-    PAL_ASSERT((ret == 0) || (ret == EBUSY));
-
-    return (ret == 0);
+    return (__sync_val_compare_and_swap(&m_lockWord, MutexUnlocked, MutexLocked) == MutexUnlocked);
 }
 
 // =====================================================================================================================
-// Releases the mutex.
+// Releases the mutex.  The kernel is only entered if a waiter might be asleep.
 void Mutex::Unlock()
 {
-    const int ret = pthread_mutex_unlock(&m_osMutex);
-    PAL_ASSERT(ret == 0);
+    const uint32 prevState = __atomic_exchange_n(&m_lockWord, MutexUnlocked, __ATOMIC_RELEASE);
+    PAL_ASSERT(prevState != MutexUnlocked);
+
+    if (prevState == MutexContended)
+    {
+        FutexWake(&m_lockWord, 1);
+    }
 }
 
 // =====================================================================================================================
-// Initializes pthread rwlock.
+// A futex needs no initialization beyond the constructor.  This is kept for interface compatibility.
 Result RWLock::Init()
 {
-    m_initialized = m_initialized || (pthread_rwlock_init(&m_osRWLock, nullptr) == 0);
-
-    return m_initialized ? Result::Success : Result::ErrorUnknown;
+    return Result::Success;
 }
 
 // =====================================================================================================================
-// Destroys pthread rwlock.
+// The rw lock owns no OS objects, but destroying a rw lock which is still held is a bug.
 RWLock::~RWLock()
 {
-    if (m_initialized)
-    {
-        const int ret = pthread_rwlock_destroy(&m_osRWLock);
-        PAL_ASSERT(ret == 0);
-    }
+    PAL_ASSERT(m_state == RWLockFree);
 }
 
 // =====================================================================================================================
@@ -104,8 +261,10 @@ RWLock::~RWLock()
 // If it is contended, wait for rw lock to become available, then enter it.
 void RWLock::LockForRead()
 {
-    const int ret = pthread_rwlock_rdlock(&m_osRWLock);
-    PAL_ASSERT(ret == 0);
+    if (TryLockForRead() == false)
+    {
+        LockSlow(false, __builtin_return_address(0));
+    }
 }
 
 // =====================================================================================================================
@@ -113,8 +272,77 @@ void RWLock::LockForRead()
 // If it is contended, wait for rw lock to become available, then enter it.
 void RWLock::LockForWrite()
 {
-    const int ret = pthread_rwlock_wrlock(&m_osRWLock);
-    PAL_ASSERT(ret == 0);
+    if (TryLockForWrite() == false)
+    {
+        LockSlow(true, __builtin_return_address(0));
+    }
+}
+
+// =====================================================================================================================
+// Contended path of LockForRead() and LockForWrite(): spins for a while, then sleeps until the lock is released.
+//
+// Readers and writers sleep on separate futex words so that releasing the lock to a writer wakes only one thread.
+// Sleepers first set their waiting flag, then sample their wake sequence, then retry the lock.  Releasers update
+// m_state, then clear the flag and bump the wake sequence if the flag was set.  All of these are sequentially
+// consistent, so either the releaser sees the flag and changes the futex word, or the sleeper's retry sees the release.
+// Like Mutex::LockContended(), a thread which has slept can't know whether others are still asleep, so it always sets
+// the flag again.  Like the default pthread rw lock, readers are preferred over writers.
+void RWLock::LockSlow(
+    bool        exclusive,
+    const void* pSite)
+{
+#if PAL_LOCK_CONTENTION_STATS
+    const int64 startTicks = GetPerfCpuTime();
+#endif
+
+    auto tryAcquire = [this, exclusive]() -> bool
+    {
+        return exclusive ? TryLockForWrite() : TryLockForRead();
+    };
+
+    const bool acquired = AdaptiveSpin(&m_spinEstimate, tryAcquire);
+
+    if (acquired == false)
+    {
+        volatile uint32*const pWaiting      = exclusive ? &m_writersWaiting     : &m_readersWaiting;
+        volatile uint32*const pWakeSequence = exclusive ? &m_writerWakeSequence : &m_readerWakeSequence;
+
+        bool locked = false;
+        while (locked == false)
+        {
+            __atomic_store_n(pWaiting, 1, __ATOMIC_SEQ_CST);
+            const uint32 sequence = __atomic_load_n(pWakeSequence, __ATOMIC_SEQ_CST);
+
+            locked = tryAcquire();
+            if (locked == false)
+            {
+                FutexWait(pWakeSequence, sequence, nullptr);
+            }
+        }
+    }
+
+#if PAL_LOCK_CONTENTION_STATS
+    RecordLockContention(pSite, startTicks, (acquired == false));
+#endif
+}
+
+// =====================================================================================================================
+// Wakes one sleeping writer and, if requested, every sleeping reader so that they can retry the lock.  Must be called
+// after m_state is updated.  A writer which loses the retry goes back to sleep and is woken by the next release.
+void RWLock::WakeSleepers(
+    bool wakeReaders)
+{
+    if (wakeReaders && (__atomic_exchange_n(&m_readersWaiting, 0, __ATOMIC_SEQ_CST) != 0))
+    {
+        __atomic_add_fetch(&m_readerWakeSequence, 1, __ATOMIC_SEQ_CST);
+        FutexWake(&m_readerWakeSequence, INT_MAX);
+    }
+
+    if (__atomic_exchange_n(&m_writersWaiting, 0, __ATOMIC_SEQ_CST) != 0)
+    {
+        __atomic_add_fetch(&m_writerWakeSequence, 1, __ATOMIC_SEQ_CST);
+        FutexWake(&m_writerWakeSequence, 1);
+    }
 }
 
 // =====================================================================================================================
@@ -122,37 +350,49 @@ void RWLock::LockForWrite()
 // Does not wait for the rw lock to become available.
 bool RWLock::TryLockForRead()
 {
-    const int ret = pthread_rwlock_tryrdlock(&m_osRWLock);
-    PAL_ASSERT((ret == 0) || (ret == EBUSY));
+    uint32 state    = __atomic_load_n(&m_state, __ATOMIC_RELAXED);
+    bool   acquired = false;
+
+    // Other readers only make the compare-and-swap fail spuriously, so keep retrying until a writer shows up.
+    while ((acquired == false) && (state != RWLockWriterLocked))
+    {
+        PAL_ASSERT((state + 1) < RWLockWriterLocked);
+        acquired = __atomic_compare_exchange_n(&m_state, &state, state + 1, true, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED);
+    }
 
-    return (ret == 0);
+    return acquired;
 }
 
 // =====================================================================================================================
-// Tries to acquire a rw lock in readonly mode if it is not contended.
+// Tries to acquire a rw lock in readwrite mode if it is not contended.
 // Does not wait for the rw lock to become available.
 bool RWLock::TryLockForWrite()
 {
-    const int ret = pthread_rwlock_trywrlock(&m_osRWLock);
-    PAL_ASSERT((ret == 0) || (ret == EBUSY));
-
-    return (ret == 0);
+    return (__sync_val_compare_and_swap(&m_state, RWLockFree, RWLockWriterLocked) == RWLockFree);
 }
 
 // =====================================================================================================================
-// Release the rw lock which is previously contended.
+// Release the rw lock which is previously contended.  Only writers can be waiting on readers, so there is nothing to
+// wake until the last reader leaves.
 void RWLock::UnlockForRead()
 {
-    const int ret = pthread_rwlock_unlock(&m_osRWLock);
-    PAL_ASSERT(ret == 0);
+    const uint32 prevState = __atomic_fetch_sub(&m_state, 1, __ATOMIC_SEQ_CST);
+    PAL_ASSERT((prevState != RWLockFree) && (prevState != RWLockWriterLocked));
+
+    if (prevState == 1)
+    {
+        WakeSleepers(false);
+    }
 }
 
 // =====================================================================================================================
 // Release the rw lock which is previously contended.
 void RWLock::UnlockForWrite()
 {
-    const int ret = pthread_rwlock_unlock(&m_osRWLock);
-    PAL_ASSERT(ret == 0);
+    const uint32 prevState = __atomic_exchange_n(&m_state, RWLockFree, __ATOMIC_SEQ_CST);
+    PAL_ASSERT(prevState == RWLockWriterLocked);
+
+    WakeSleepers(true);
 }
 
 // =====================================================================================================================
@@ -199,6 +439,19 @@ uint32 AtomicCompareAndSwap(
     return __sync_val_compare_and_swap(pTarget, oldValue, newValue);
 }
 
+// =====================================================================================================================
+// Thread-safe method to compare and swap two 64-bit integers.  Returns the value at (*pTarget) before this method was
+// called.
+uint64 AtomicCompareAndSwap64(
+    volatile uint64* pTarget,
+    uint64           oldValue,
+    uint64           newValue)
+{
+    PAL_ASSERT(IsPow2Aligned(reinterpret_cast<size_t>(pTarget), sizeof(uint64)));
+
+    return __sync_val_compare_and_swap(pTarget, oldValue, newValue);
+}
+
 // =====================================================================================================================
 // Thread-safe method to exchange a 32-bit integer.  Returns the value at (*pTarget) before this method was called.
 uint32 AtomicExchange(
@@ -246,4 +499,86 @@ uint64 AtomicAdd64(
     return __sync_add_and_fetch(pAddend, value);
 }
 
+#if PAL_LOCK_CONTENTION_STATS
+// =====================================================================================================================
+// Copies the lock call sites with the largest total wait time into pStats, hottest first.  Returns the number of
+// entries written.
+uint32 GetLockContentionStats(
+    LockSiteStats* pStats,
+    uint32         maxSites)
+{
+    uint32 numSites = 0;
+
+    for (uint32 idx = 0; idx < LockSiteTableSize; ++idx)
+    {
+        const LockSiteEntry& entry = g_lockSites[idx];
+
+        if (entry.site != 0)
+        {
+            LockSiteStats stats = {};
+            stats.pSite       = reinterpret_cast<const void*>(entry.site);
+            stats.contentions = entry.contentions;
+            stats.sleeps      = entry.sleeps;
+            stats.waitTicks   = entry.waitTicks;
+
+            // Insertion sort into the output array, dropping whatever falls off the end.
+            uint32 pos = Min(numSites, maxSites);
+            while ((pos > 0) && (pStats[pos - 1].waitTicks < stats.waitTicks))
+            {
+                if (pos < maxSites)
+                {
+                    pStats[pos] = pStats[pos - 1];
+                }
+                --pos;
+            }
+
+            if (pos < maxSites)
+            {
+                pStats[pos] = stats;
+                numSites    = Min(numSites + 1, maxSites);
+            }
+        }
+    }
+
+    return numSites;
+}
+
+// =====================================================================================================================
+// Prints the hottest lock call sites.  Sites are reported as module and offset so that they can be resolved with
+// addr2line even when PAL's symbols aren't exported.
+void ReportLockContention()
+{
+    LockSiteStats stats[LockReportSites] = {};
+    const uint32  numSites   = GetLockContentionStats(&stats[0], LockReportSites);
+    const double  ticksPerMs = static_cast<double>(GetPerfFrequency()) / 1000.0;
+
+    PAL_DPINFO("Lock contention report: %u hottest sites, %llu samples dropped",
+               numSites,
+               static_cast<unsigned long long>(g_droppedLockSamples));
+
+    for (uint32 idx = 0; idx < numSites; ++idx)
+    {
+        Dl_info     info    = {};
+        const char* pModule = "?";
+        const char* pSymbol = "?";
+        size_t      offset  = 0;
+
+        if (dladdr(stats[idx].pSite, &info) != 0)
+        {
+            pModule = (info.dli_fname != nullptr) ? info.dli_fname : pModule;
+            pSymbol = (info.dli_sname != nullptr) ? info.dli_sname : pSymbol;
+            offset  = reinterpret_cast<size_t>(stats[idx].pSite) - reinterpret_cast<size_t>(info.dli_fbase);
+        }
+
+        PAL_DPINFO("  %s+0x%zx (%s): %llu contended, %llu slept, %.3f ms waiting",
+                   pModule,
+                   offset,
+                   pSymbol,
+                   static_cast<unsigned long long>(stats[idx].contentions),
+                   static_cast<unsigned long long>(stats[idx].sleeps),
+                   static_cast<double>(stats[idx].waitTicks) / ticksPerMs);
+    }
+}
+#endif
+
 } // Util
@@ -23,8 +23,11 @@
  *
  **********************************************************************************************************************/
 
+#include "palInlineFuncs.h"
 #include "palSysMemory.h"
+#include <cstdio>
 #include <cstdlib>
+#include <cstring>
 #include <unistd.h>
 #include <sys/mman.h>
 
@@ -102,10 +105,37 @@ Result VirtualReserve(
 
     if (result == Result::Success)
     {
-        void* pMemory = mmap(pMem, sizeInBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        // mmap only guarantees page alignment. If a stricter alignment was requested we over-reserve by the alignment
+        // and trim the unaligned head and the unused tail afterwards.
+        const size_t pageSize     = VirtualPageSize();
+        const bool   overReserve  = (pMem == nullptr) && (alignment > pageSize);
+        const size_t reserveBytes = overReserve ? (sizeInBytes + alignment) : sizeInBytes;
+
+        void* pMemory = mmap(pMem, reserveBytes, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
 
         if ((pMemory != nullptr) && (pMemory != MAP_FAILED))
         {
+            if (overReserve)
+            {
+                PAL_ASSERT(IsPowerOfTwo(alignment));
+
+                void*const   pAligned  = VoidPtrAlign(pMemory, alignment);
+                const size_t headBytes = VoidPtrDiff(pAligned, pMemory);
+                const size_t tailBytes = reserveBytes - headBytes - sizeInBytes;
+
+                if (headBytes > 0)
+                {
+                    munmap(pMemory, headBytes);
+                }
+
+                if (tailBytes > 0)
+                {
+                    munmap(VoidPtrInc(pAligned, sizeInBytes), tailBytes);
+                }
+
+                pMemory = pAligned;
+            }
+
             PAL_ASSERT(ppOut != nullptr);
             (*ppOut) = pMemory;
         }
@@ -216,6 +246,130 @@ Result VirtualRelease(
     return result;
 }
 
+// =====================================================================================================================
+// Returns the transparent huge page size, or zero if transparent huge pages are unavailable or disabled.
+static size_t QueryLargePageSize()
+{
+    size_t largePageSize = 0;
+    char   mode[128]     = {};
+
+    FILE* pFile = fopen("/sys/kernel/mm/transparent_hugepage/enabled", "r");
+
+    if (pFile != nullptr)
+    {
+        if (fgets(mode, sizeof(mode), pFile) == nullptr)
+        {
+            mode[0] = '\0';
+        }
+        fclose(pFile);
+    }
+
+    // The active mode is bracketed, e.g. "always [madvise] never". We need either "always" or "madvise" to be active.
+    if ((mode[0] != '\0') && (strstr(mode, "[never]") == nullptr))
+    {
+        pFile = fopen("/sys/kernel/mm/transparent_hugepage/hpage_pmd_size", "r");
+
+        if (pFile != nullptr)
+        {
+            unsigned long long size = 0;
+
+            if (fscanf(pFile, "%llu", &size) == 1)
+            {
+                largePageSize = static_cast<size_t>(size);
+            }
+            fclose(pFile);
+        }
+    }
+
+    return largePageSize;
+}
+
+// =====================================================================================================================
+// Returns the transparent huge page size, or zero if large pages can't be used.
+size_t VirtualLargePageSize()
+{
+    static const size_t LargePageSize = QueryLargePageSize();
+
+    return LargePageSize;
+}
+
+// =====================================================================================================================
+// Advises the kernel to back the specified committed range with transparent huge pages.
+Result VirtualAdviseLargePages(
+    void*  pMem,
+    size_t sizeInBytes)
+{
+    Result result = Result::Success;
+
+    if (sizeInBytes == 0)
+    {
+        result = Result::ErrorInvalidValue;
+    }
+    else if (pMem == nullptr)
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+    else if (VirtualLargePageSize() == 0)
+    {
+        result = Result::Unsupported;
+    }
+
+    if (result == Result::Success)
+    {
+#if defined(MADV_HUGEPAGE)
+        if (madvise(pMem, sizeInBytes, MADV_HUGEPAGE) != 0)
+        {
+            result = Result::Unsupported;
+        }
+#else
+        result = Result::Unsupported;
+#endif
+    }
+
+    return result;
+}
+
+// =====================================================================================================================
+// Pre-faults the specified committed range. Newer kernels can populate the whole range in one call; otherwise we fall
+// back to touching each page. The touch rewrites the existing value so the range may already contain client data.
+Result VirtualPrefault(
+    void*  pMem,
+    size_t sizeInBytes)
+{
+    Result result = Result::Success;
+
+    if (sizeInBytes == 0)
+    {
+        result = Result::ErrorInvalidValue;
+    }
+    else if (pMem == nullptr)
+    {
+        result = Result::ErrorInvalidPointer;
+    }
+
+    if (result == Result::Success)
+    {
+        bool populated = false;
+
+#if defined(MADV_POPULATE_WRITE)
+        populated = (madvise(pMem, sizeInBytes, MADV_POPULATE_WRITE) == 0);
+#endif
+
+        if (populated == false)
+        {
+            const size_t pageSize = VirtualPageSize();
+
+            for (size_t offset = 0; offset < sizeInBytes; offset += pageSize)
+            {
+                volatile uint8*const pByte = static_cast<volatile uint8*>(VoidPtrInc(pMem, offset));
+                (*pByte) = (*pByte);
+            }
+        }
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 void* GenericAllocator::Alloc(
     const AllocInfo& allocInfo)
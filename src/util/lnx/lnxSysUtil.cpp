@@ -301,6 +301,26 @@ int64 GetPerfCpuTime()
     return time;
 }
 
+// =====================================================================================================================
+// Suspends execution of the calling thread for at least the specified number of microseconds.
+void SleepMicroseconds(
+    uint32 microseconds)
+{
+    constexpr uint64 NanosecsPerMicrosec = 1000;
+    constexpr uint64 NanosecsPerSec      = 1000000000;
+
+    const uint64 nanoseconds = microseconds * NanosecsPerMicrosec;
+
+    timespec sleepTime = { };
+    sleepTime.tv_sec  = static_cast<time_t>(nanoseconds / NanosecsPerSec);
+    sleepTime.tv_nsec = static_cast<long>(nanoseconds % NanosecsPerSec);
+
+    // nanosleep() returns early if interrupted by a signal, in which case it reports the remaining time to sleep.
+    while ((nanosleep(&sleepTime, &sleepTime) != 0) && (errno == EINTR))
+    {
+    }
+}
+
 // =====================================================================================================================
 bool KeyTranslate(
     int      input,
@@ -159,6 +159,35 @@ bool Thread::IsCurrentThread() const
     return (pthread_equal(pthread_self(), m_threadId) != 0);
 }
 
+// =====================================================================================================================
+// Restricts the thread encapsulated by this object to the logical processors set in the given mask.
+Result Thread::SetAffinityMask(
+    uint64 affinityMask)
+{
+    PAL_ASSERT(affinityMask != 0);
+
+    Result result = Result::ErrorUnavailable;
+
+    if ((m_threadStatus == Result::Success) || (m_threadStatus == Result::Unsupported))
+    {
+        cpu_set_t cpuSet;
+        CPU_ZERO(&cpuSet);
+
+        for (uint32 cpu = 0; cpu < (sizeof(affinityMask) * 8); ++cpu)
+        {
+            if ((affinityMask & (1ull << cpu)) != 0)
+            {
+                CPU_SET(cpu, &cpuSet);
+            }
+        }
+
+        result = (pthread_setaffinity_np(m_threadId, sizeof(cpuSet), &cpuSet) == 0) ? Result::Success
+                                                                                    : Result::ErrorUnknown;
+    }
+
+    return result;
+}
+
 // =====================================================================================================================
 // Bootstraps the given thread object by launching the client's start function.
 void* Thread::StartThread(